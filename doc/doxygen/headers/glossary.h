@@ -2373,6 +2373,13 @@
  *   @note The usual warning about the missing type safety of @p void pointers are
  *   obviously in place here; responsibility for correctness of types etc
  *   lies entirely with the user of the pointer.
+ *
+ *   @note Since most programs do not use user data, the memory for it is only
+ *   allocated the first time user data is set on a line, quad, or hex,
+ *   respectively, and it is released again by Triangulation::clear_user_data().
+ *   Until then, all user indices are zero and all user pointers are null.
+ *   The allocation is thread-safe, so user data of different objects may be
+ *   set concurrently, for example from within WorkStream::run().
  * </dd>
  *
  *
@@ -1398,6 +1398,31 @@ namespace Utilities
           const unsigned int mpi_tag = 0);
 
 
+    /**
+     * Start the computation of the sum over all processors of the value
+     * @p t and return immediately. This function corresponds to the
+     * `MPI_Iallreduce` function and is the "immediate" counterpart of the
+     * sum() function above: it returns a Future object whose Future::get()
+     * function waits for the reduction to complete and then returns the
+     * result on all processors. In between, the calling process can do
+     * other work, allowing to overlap the latency of the global reduction
+     * with computations.
+     *
+     * This function is collective over all processors given in the
+     * @ref GlossMPICommunicator "communicator".
+     * As with all non-blocking collective operations, all processes need
+     * to start the reductions on a given communicator in the same order.
+     * If deal.II is not configured for use of MPI, or if MPI has not been
+     * initialized, the returned object simply returns the value of @p t.
+     *
+     * @note This function is only implemented for types natively supported
+     * by MPI, i.e., those for which mpi_type_id_for_type is defined.
+     */
+    template <typename T>
+    Future<T>
+    isum(const T &t, const MPI_Comm mpi_communicator);
+
+
     /**
      * Given a partitioned index set space, compute the owning MPI process rank
      * of each element of a second index set according to the partitioned index
@@ -2397,6 +2422,52 @@ namespace Utilities
 
 
 
+    template <typename T>
+    Future<T>
+    isum(const T &t, const MPI_Comm mpi_communicator)
+    {
+#  ifdef DEAL_II_WITH_MPI
+      if (job_supports_mpi())
+        {
+          // The send and receive buffers as well as the request must stay
+          // at a fixed memory location until the reduction has completed,
+          // so keep them in an object shared by the two lambda functions
+          // of the Future:
+          struct Reduction
+          {
+            T           local_value;
+            T           result;
+            MPI_Request request;
+          };
+          const std::shared_ptr<Reduction> reduction =
+            std::make_shared<Reduction>();
+          reduction->local_value = t;
+
+          const int ierr = MPI_Iallreduce(&reduction->local_value,
+                                          &reduction->result,
+                                          1,
+                                          mpi_type_id_for_type<T>,
+                                          MPI_SUM,
+                                          mpi_communicator,
+                                          &reduction->request);
+          AssertThrowMPI(ierr);
+
+          auto wait = [reduction]() {
+            const int ierr = MPI_Wait(&reduction->request, MPI_STATUS_IGNORE);
+            AssertThrowMPI(ierr);
+          };
+          auto get = [reduction]() { return reduction->result; };
+
+          return Future<T>(wait, get);
+        }
+#  else
+      (void)mpi_communicator;
+#  endif
+      return Future<T>([]() {}, [t]() { return t; });
+    }
+
+
+
 #  ifdef DEAL_II_WITH_MPI
     template <class Iterator, typename Number>
     std::pair<Number, typename numbers::NumberTraits<Number>::real_type>
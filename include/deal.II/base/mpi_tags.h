@@ -148,6 +148,14 @@ namespace Utilities
 
           // GridTools::internal::distributed_compute_point_locations
           distributed_compute_point_locations,
+
+          // LinearAlgebra::distributed::Vector::update_ghost_values_finish()
+          // with exchange via shared memory
+          vector_sm_update_ghost_values_done,
+
+          // LinearAlgebra::distributed::Vector::compress_finish() with
+          // exchange via shared memory
+          vector_sm_compress_done,
         };
       } // namespace Tags
     }   // namespace internal
@@ -484,6 +484,60 @@ namespace Utilities
       bool
       ghost_indices_initialized() const;
 
+      /**
+       * Set up MPI distributed-graph communicators (via
+       * MPI_Dist_graph_create_adjacent) that connect this process with the
+       * processes it exchanges ghost data with, and switch the data exchange
+       * of export_to_ghosted_array_start() and
+       * import_from_ghosted_array_start() from individual point-to-point
+       * messages to a single MPI_Ineighbor_alltoallv call. This gives the MPI
+       * library the complete communication pattern, which it can use to
+       * optimize the exchange, e.g., for processes on the same node.
+       *
+       * This is a collective operation on the communicator of this object
+       * and must be called after the ghost indices have been set; setting new
+       * owned or ghost indices switches back to point-to-point
+       * messages. Since neighborhood collectives are collective on the whole
+       * communicator, all processes must call the start and finish functions
+       * of the data exchange in the same order, including processes without
+       * any ghost or import indices. The communication channel argument of
+       * these functions has no effect in this mode, and the persistent
+       * variants, e.g., export_to_ghosted_array_init_persistent(), cannot be
+       * used.
+       */
+      void
+      setup_neighborhood_communication();
+
+      /**
+       * Return whether the data exchange uses neighborhood collectives, see
+       * setup_neighborhood_communication().
+       */
+      bool
+      uses_neighborhood_collectives() const;
+
+      /**
+       * Create a new communicator with the same processes as
+       * get_mpi_communicator(), but in which the MPI library may assign new
+       * ranks to the processes in order to place processes that exchange a
+       * lot of ghost data close to each other, e.g., on the same node. The
+       * communicator is created with MPI_Dist_graph_create_adjacent() with
+       * reordering enabled, using the number of ghost and import indices
+       * between two processes as the weight of their connection. Whether
+       * ranks are actually reordered depends on the MPI implementation.
+       *
+       * Since the ranks of the new communicator differ from the ranks of the
+       * current one, this object cannot be used with it. Rather, the
+       * communicator is meant to be used to set up the problem from scratch,
+       * e.g., by creating the triangulation on it, using the communication
+       * pattern of a first setup with the original communicator. The caller
+       * is responsible for freeing the communicator with
+       * Utilities::MPI::free_communicator().
+       *
+       * This is a collective operation on the communicator of this object.
+       */
+      MPI_Comm
+      create_reordered_communicator() const;
+
 #ifdef DEAL_II_WITH_MPI
       /**
        * Start the exportation of the data in a locally owned array to the
@@ -552,6 +606,34 @@ namespace Utilities
         const ArrayView<Number, MemorySpaceType> &ghost_array,
         std::vector<MPI_Request>                 &requests) const;
 
+      /**
+       * Same as export_to_ghosted_array_start(), but the data is sent with a
+       * different number type @p TransportNumber, e.g., in single precision
+       * for a vector in double precision. The entries of the @p
+       * locally_owned_array are converted while being packed into @p
+       * temporary_storage, and @p ghost_array receives the data in the
+       * transport type. The size of @p ghost_array must equal
+       * n_ghost_indices(). The communication is completed by calling
+       * export_to_ghosted_array_finish() with @p ghost_array, after which the
+       * caller can convert the ghost values back to the original type. If
+       * setup_neighborhood_communication() has been called, the data is
+       * exchanged with a neighborhood collective as in
+       * export_to_ghosted_array_start().
+       *
+       * This functionality is used in
+       * LinearAlgebra::distributed::Vector::update_ghost_values() to reduce
+       * the amount of data sent over the network, see
+       * LinearAlgebra::distributed::Vector::set_ghost_exchange_precision().
+       */
+      template <typename Number, typename TransportNumber>
+      void
+      export_to_ghosted_array_start_with_conversion(
+        const unsigned int                communication_channel,
+        const ArrayView<const Number>    &locally_owned_array,
+        const ArrayView<TransportNumber> &temporary_storage,
+        const ArrayView<TransportNumber> &ghost_array,
+        std::vector<MPI_Request>         &requests) const;
+
       /**
        * Start importing the data on an array indexed by the ghost indices of
        * this class that is later accumulated into a locally owned array with
@@ -640,6 +722,113 @@ namespace Utilities
         const ArrayView<Number, MemorySpaceType>       &locally_owned_storage,
         const ArrayView<Number, MemorySpaceType>       &ghost_array,
         std::vector<MPI_Request>                       &requests) const;
+
+      /**
+       * Set up persistent MPI requests (via MPI_Send_init and MPI_Recv_init)
+       * for the data exchange performed by export_to_ghosted_array_start() and
+       * export_to_ghosted_array_finish(). Since the communication pattern of
+       * a partitioner is fixed, the requests can be created once and then be
+       * re-activated with export_to_ghosted_array_start_persistent() for
+       * every subsequent exchange, which avoids the setup of the messages in
+       * the MPI library during each exchange.
+       *
+       * The persistent requests are bound to the memory locations of @p
+       * temporary_storage and @p ghost_array, i.e., the same arrays must be
+       * passed to all subsequent start and finish calls, and the arrays must
+       * not be reallocated as long as the requests exist. The requests must
+       * be released with MPI_Request_free() by the caller once they are not
+       * needed any more.
+       *
+       * @param communication_channel Sets an offset to the MPI tags as in
+       * export_to_ghosted_array_start().
+       *
+       * @param temporary_storage A temporary storage array of length
+       * n_import_indices() from which the packed data is sent.
+       *
+       * @param ghost_array The array that will receive the exported data,
+       * with the same size requirements as in
+       * export_to_ghosted_array_start().
+       *
+       * @param requests An empty vector that is filled with the persistent
+       * requests.
+       */
+      template <typename Number>
+      void
+      export_to_ghosted_array_init_persistent(
+        const unsigned int        communication_channel,
+        const ArrayView<Number>  &temporary_storage,
+        const ArrayView<Number>  &ghost_array,
+        std::vector<MPI_Request> &requests) const;
+
+      /**
+       * Start the exportation of the data in a locally owned array to the
+       * ghost entries using the persistent requests set up by
+       * export_to_ghosted_array_init_persistent(). The @p temporary_storage
+       * must be the same array as passed to that function.
+       */
+      template <typename Number>
+      void
+      export_to_ghosted_array_start_persistent(
+        const ArrayView<const Number> &locally_owned_array,
+        const ArrayView<Number>       &temporary_storage,
+        std::vector<MPI_Request>      &requests) const;
+
+      /**
+       * Finish the exportation started by
+       * export_to_ghosted_array_start_persistent(). As opposed to
+       * export_to_ghosted_array_finish(), the requests are not freed but stay
+       * available for the next exchange.
+       */
+      template <typename Number>
+      void
+      export_to_ghosted_array_finish_persistent(
+        const ArrayView<Number>  &ghost_array,
+        std::vector<MPI_Request> &requests) const;
+
+      /**
+       * Set up persistent MPI requests for the data exchange performed by
+       * import_from_ghosted_array_start() and
+       * import_from_ghosted_array_finish(), see
+       * export_to_ghosted_array_init_persistent() for the requirements on the
+       * arrays and the requests.
+       */
+      template <typename Number>
+      void
+      import_from_ghosted_array_init_persistent(
+        const unsigned int        communication_channel,
+        const ArrayView<Number>  &ghost_array,
+        const ArrayView<Number>  &temporary_storage,
+        std::vector<MPI_Request> &requests) const;
+
+      /**
+       * Start importing the data on an array indexed by the ghost indices of
+       * this class using the persistent requests set up by
+       * import_from_ghosted_array_init_persistent(). The @p ghost_array must
+       * be the same array as passed to that function.
+       */
+      template <typename Number>
+      void
+      import_from_ghosted_array_start_persistent(
+        const VectorOperation::values vector_operation,
+        const ArrayView<Number>      &ghost_array,
+        std::vector<MPI_Request>     &requests) const;
+
+      /**
+       * Finish the import started by
+       * import_from_ghosted_array_start_persistent(), combining the received
+       * data into @p locally_owned_storage according to @p vector_operation
+       * and setting the ghost entries to zero. As opposed to
+       * import_from_ghosted_array_finish(), the requests are not freed but
+       * stay available for the next exchange.
+       */
+      template <typename Number>
+      void
+      import_from_ghosted_array_finish_persistent(
+        const VectorOperation::values  vector_operation,
+        const ArrayView<const Number> &temporary_storage,
+        const ArrayView<Number>       &locally_owned_storage,
+        const ArrayView<Number>       &ghost_array,
+        std::vector<MPI_Request>      &requests) const;
 #endif
 
       /**
@@ -679,6 +868,51 @@ namespace Utilities
       void
       initialize_import_indices_plain_dev() const;
 
+#ifdef DEAL_II_WITH_MPI
+      /**
+       * Pack the locally owned entries to be sent to the @p i-th import
+       * target into the buffer starting at @p temp_array_ptr, converting
+       * them to the @p TransportNumber type if necessary.
+       */
+      template <typename Number, typename TransportNumber>
+      void
+      pack_export_data(const unsigned int i,
+                       const Number      *locally_owned_array,
+                       TransportNumber   *temp_array_ptr) const;
+
+      /**
+       * In case the ghost data was received into a ghost array associated
+       * with a larger ghost index set, move the entries to their final
+       * positions and clear the remaining entries.
+       */
+      template <typename Number, typename MemorySpaceType>
+      void
+      move_ghost_data_to_larger_set(
+        const ArrayView<Number, MemorySpaceType> &ghost_array) const;
+
+      /**
+       * In case the ghost array is associated with a larger ghost index set,
+       * move the entries to be sent to the @p i-th ghost target into a
+       * contiguous range starting at @p ghost_array_ptr.
+       */
+      template <typename Number, typename MemorySpaceType>
+      void
+      compact_ghost_data_for_import(
+        const unsigned int                        i,
+        const ArrayView<Number, MemorySpaceType> &ghost_array,
+        Number                                   *ghost_array_ptr) const;
+
+      /**
+       * Combine the imported data starting at @p read_position with the
+       * locally owned entries according to @p vector_operation.
+       */
+      template <typename Number>
+      void
+      accumulate_import_data(const VectorOperation::values vector_operation,
+                             const Number                 *read_position,
+                             Number *locally_owned_array) const;
+#endif
+
       /**
        * The global size of the vector over all processors
        */
@@ -791,6 +1025,61 @@ namespace Utilities
        * A variable storing whether the ghost indices have been explicitly set.
        */
       bool have_ghost_indices;
+
+      /**
+       * The distributed-graph communicators and the message layout used for
+       * the data exchange with neighborhood collectives, see
+       * setup_neighborhood_communication().
+       */
+      struct NeighborhoodCommunication
+      {
+        /**
+         * Destructor. Frees the communicators.
+         */
+        ~NeighborhoodCommunication();
+
+        /**
+         * Communicator with the owners of the ghost indices as sources and
+         * the processes that import locally owned indices as destinations,
+         * i.e., the direction of export_to_ghosted_array_start().
+         */
+        MPI_Comm export_communicator = MPI_COMM_NULL;
+
+        /**
+         * Communicator with the reverse direction of the
+         * @p export_communicator, used in import_from_ghosted_array_start().
+         */
+        MPI_Comm import_communicator = MPI_COMM_NULL;
+
+        /**
+         * The number of ghost indices owned by each of the ghost targets.
+         */
+        std::vector<int> ghost_counts;
+
+        /**
+         * The offsets of the ghost indices of each ghost target within the
+         * ghost array.
+         */
+        std::vector<int> ghost_offsets;
+
+        /**
+         * The number of imported indices for each of the import targets.
+         */
+        std::vector<int> import_counts;
+
+        /**
+         * The offsets of the imported indices of each import target within
+         * the temporary storage array.
+         */
+        std::vector<int> import_offsets;
+      };
+
+      /**
+       * The data for the neighborhood collectives, only set if
+       * setup_neighborhood_communication() has been called.
+       */
+      std::shared_ptr<const NeighborhoodCommunication>
+        neighborhood_communication;
     };
 
 
@@ -988,6 +1277,14 @@ namespace Utilities
       return have_ghost_indices;
     }
 
+
+
+    inline bool
+    Partitioner::uses_neighborhood_collectives() const
+    {
+      return neighborhood_communication != nullptr;
+    }
+
 #endif // ifndef DOXYGEN
 
   } // end of namespace MPI
@@ -17,6 +17,7 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/mpi.h>
 #include <deal.II/base/mpi_tags.h>
 #include <deal.II/base/partitioner.h>
 
@@ -36,6 +37,39 @@ namespace Utilities
 
 #  ifdef DEAL_II_WITH_MPI
 
+    template <typename Number, typename TransportNumber>
+    void
+    Partitioner::pack_export_data(const unsigned int i,
+                                  const Number      *locally_owned_array,
+                                  TransportNumber   *temp_array_ptr) const
+    {
+      // copy the data to be sent to the import_data field
+      std::vector<std::pair<unsigned int, unsigned int>>::const_iterator
+        my_imports =
+          import_indices_data.begin() + import_indices_chunks_by_rank_data[i],
+        end_my_imports = import_indices_data.begin() +
+                         import_indices_chunks_by_rank_data[i + 1];
+      unsigned int index = 0;
+      for (; my_imports != end_my_imports; ++my_imports)
+        {
+          const unsigned int chunk_size =
+            my_imports->second - my_imports->first;
+          if constexpr (std::is_same_v<Number, TransportNumber>)
+            std::memcpy(temp_array_ptr + index,
+                        locally_owned_array + my_imports->first,
+                        chunk_size * sizeof(Number));
+          else
+            std::copy(locally_owned_array + my_imports->first,
+                      locally_owned_array + my_imports->second,
+                      temp_array_ptr + index);
+          index += chunk_size;
+        }
+
+      AssertDimension(index, import_targets_data[i].second);
+    }
+
+
+
     template <typename Number, typename MemorySpaceType>
     void
     Partitioner::export_to_ghosted_array_start(
@@ -71,8 +105,13 @@ namespace Utilities
 
       // Need to send and receive the data. Use non-blocking communication,
       // where it is usually less overhead to first initiate the receive and
-      // then actually send the data
-      requests.resize(n_import_targets + n_ghost_targets);
+      // then actually send the data. With neighborhood collectives, a single
+      // request covers all messages.
+      const bool use_neighborhood_collectives =
+        neighborhood_communication != nullptr;
+      requests.resize(use_neighborhood_collectives ?
+                        1 :
+                        n_import_targets + n_ghost_targets);
 
       // as a ghost array pointer, put the data at the end of the given ghost
       // array in case we want to fill only a subset of the ghosts so that we
@@ -86,8 +125,11 @@ namespace Utilities
         use_larger_set ? ghost_array.data() + n_ghost_indices_in_larger_set -
                            n_ghost_indices() :
                          ghost_array.data();
+      Number *const ghost_receive_ptr = ghost_array_ptr;
 
-      for (unsigned int i = 0; i < n_ghost_targets; ++i)
+      for (unsigned int i = 0;
+           i < (use_neighborhood_collectives ? 0 : n_ghost_targets);
+           ++i)
         {
           // allow writing into ghost indices even though we are in a
           // const function
@@ -139,41 +181,135 @@ namespace Utilities
             }
           else
 #    endif
-            {
-              // copy the data to be sent to the import_data field
-              std::vector<std::pair<unsigned int, unsigned int>>::const_iterator
-                my_imports = import_indices_data.begin() +
-                             import_indices_chunks_by_rank_data[i],
-                end_my_imports = import_indices_data.begin() +
-                                 import_indices_chunks_by_rank_data[i + 1];
-              unsigned int index = 0;
-              for (; my_imports != end_my_imports; ++my_imports)
-                {
-                  const unsigned int chunk_size =
-                    my_imports->second - my_imports->first;
-                  {
-                    std::memcpy(temp_array_ptr + index,
-                                locally_owned_array.data() + my_imports->first,
-                                chunk_size * sizeof(Number));
-                  }
-                  index += chunk_size;
-                }
+            pack_export_data(i, locally_owned_array.data(), temp_array_ptr);
 
-              AssertDimension(index, import_targets_data[i].second);
+          // start the send operations
+          if (use_neighborhood_collectives == false)
+            {
+              const int ierr =
+                MPI_Isend(temp_array_ptr,
+                          import_targets_data[i].second * sizeof(Number),
+                          MPI_BYTE,
+                          import_targets_data[i].first,
+                          mpi_tag,
+                          communicator,
+                          &requests[n_ghost_targets + i]);
+              AssertThrowMPI(ierr);
             }
+          temp_array_ptr += import_targets_data[i].second;
+        }
 
-          // start the send operations
+      // with neighborhood collectives, exchange all data at once after
+      // packing
+      if (use_neighborhood_collectives)
+        {
+          const int ierr = MPI_Ineighbor_alltoallv(
+            temporary_storage.data(),
+            neighborhood_communication->import_counts.data(),
+            neighborhood_communication->import_offsets.data(),
+            Utilities::MPI::mpi_type_id_for_type<Number>,
+            ghost_receive_ptr,
+            neighborhood_communication->ghost_counts.data(),
+            neighborhood_communication->ghost_offsets.data(),
+            Utilities::MPI::mpi_type_id_for_type<Number>,
+            neighborhood_communication->export_communicator,
+            requests.data());
+          AssertThrowMPI(ierr);
+        }
+    }
+
+
+
+    template <typename Number, typename TransportNumber>
+    void
+    Partitioner::export_to_ghosted_array_start_with_conversion(
+      const unsigned int                communication_channel,
+      const ArrayView<const Number>    &locally_owned_array,
+      const ArrayView<TransportNumber> &temporary_storage,
+      const ArrayView<TransportNumber> &ghost_array,
+      std::vector<MPI_Request>         &requests) const
+    {
+      AssertDimension(temporary_storage.size(), n_import_indices());
+      AssertIndexRange(communication_channel, 200);
+      AssertDimension(ghost_array.size(), n_ghost_indices());
+
+      const unsigned int n_import_targets = import_targets_data.size();
+      const unsigned int n_ghost_targets  = ghost_targets_data.size();
+
+      if (n_import_targets > 0)
+        AssertDimension(locally_owned_array.size(), locally_owned_size());
+
+      Assert(requests.empty(),
+             ExcMessage("Another operation seems to still be running. "
+                        "Call update_ghost_values_finish() first."));
+
+      const unsigned int mpi_tag =
+        Utilities::MPI::internal::Tags::partitioner_export_start +
+        communication_channel;
+      Assert(mpi_tag <= Utilities::MPI::internal::Tags::partitioner_export_end,
+             ExcInternalError());
+
+      // with neighborhood collectives, a single request covers all messages
+      // as in export_to_ghosted_array_start()
+      const bool use_neighborhood_collectives =
+        neighborhood_communication != nullptr;
+      requests.resize(use_neighborhood_collectives ?
+                        1 :
+                        n_import_targets + n_ghost_targets);
+
+      TransportNumber *ghost_array_ptr = ghost_array.data();
+      for (unsigned int i = 0;
+           i < (use_neighborhood_collectives ? 0 : n_ghost_targets);
+           ++i)
+        {
           const int ierr =
-            MPI_Isend(temp_array_ptr,
-                      import_targets_data[i].second * sizeof(Number),
+            MPI_Irecv(ghost_array_ptr,
+                      ghost_targets_data[i].second * sizeof(TransportNumber),
                       MPI_BYTE,
-                      import_targets_data[i].first,
+                      ghost_targets_data[i].first,
                       mpi_tag,
                       communicator,
-                      &requests[n_ghost_targets + i]);
+                      &requests[i]);
           AssertThrowMPI(ierr);
+          ghost_array_ptr += ghost_targets_data[i].second;
+        }
+
+      TransportNumber *temp_array_ptr = temporary_storage.data();
+      for (unsigned int i = 0; i < n_import_targets; ++i)
+        {
+          // convert the data to the transport type while packing
+          pack_export_data(i, locally_owned_array.data(), temp_array_ptr);
+
+          if (use_neighborhood_collectives == false)
+            {
+              const int ierr = MPI_Isend(temp_array_ptr,
+                                         import_targets_data[i].second *
+                                           sizeof(TransportNumber),
+                                         MPI_BYTE,
+                                         import_targets_data[i].first,
+                                         mpi_tag,
+                                         communicator,
+                                         &requests[n_ghost_targets + i]);
+              AssertThrowMPI(ierr);
+            }
           temp_array_ptr += import_targets_data[i].second;
         }
+
+      if (use_neighborhood_collectives)
+        {
+          const int ierr = MPI_Ineighbor_alltoallv(
+            temporary_storage.data(),
+            neighborhood_communication->import_counts.data(),
+            neighborhood_communication->import_offsets.data(),
+            Utilities::MPI::mpi_type_id_for_type<TransportNumber>,
+            ghost_array.data(),
+            neighborhood_communication->ghost_counts.data(),
+            neighborhood_communication->ghost_offsets.data(),
+            Utilities::MPI::mpi_type_id_for_type<TransportNumber>,
+            neighborhood_communication->export_communicator,
+            requests.data());
+          AssertThrowMPI(ierr);
+        }
     }
 
 
@@ -192,7 +328,9 @@ namespace Utilities
 
       // wait for both sends and receives to complete, even though only
       // receives are really necessary. this gives (much) better performance
-      AssertDimension(ghost_targets().size() + import_targets().size(),
+      AssertDimension(uses_neighborhood_collectives() ?
+                        1 :
+                        ghost_targets().size() + import_targets().size(),
                       requests.size());
       if (requests.size() > 0)
         {
@@ -202,6 +340,16 @@ namespace Utilities
         }
       requests.resize(0);
 
+      move_ghost_data_to_larger_set(ghost_array);
+    }
+
+
+
+    template <typename Number, typename MemorySpaceType>
+    void
+    Partitioner::move_ghost_data_to_larger_set(
+      const ArrayView<Number, MemorySpaceType> &ghost_array) const
+    {
       // in case we only sent a subset of indices, we now need to move the data
       // to the correct positions and delete the old content
       if (n_ghost_indices_in_larger_set > n_ghost_indices() &&
@@ -287,6 +435,81 @@ namespace Utilities
 
 
 
+    template <typename Number, typename MemorySpaceType>
+    void
+    Partitioner::compact_ghost_data_for_import(
+      const unsigned int                        i,
+      const ArrayView<Number, MemorySpaceType> &ghost_array,
+      Number                                   *ghost_array_ptr) const
+    {
+      // in case we only sent a subset of indices, we now need to move the
+      // data to the correct positions and delete the old content
+      if (n_ghost_indices_in_larger_set > n_ghost_indices() &&
+          ghost_array.size() == n_ghost_indices_in_larger_set)
+        {
+          std::vector<std::pair<unsigned int, unsigned int>>::const_iterator
+            my_ghosts = ghost_indices_subset_data.begin() +
+                        ghost_indices_subset_chunks_by_rank_data[i],
+            end_my_ghosts = ghost_indices_subset_data.begin() +
+                            ghost_indices_subset_chunks_by_rank_data[i + 1];
+          unsigned int offset = 0;
+          for (; my_ghosts != end_my_ghosts; ++my_ghosts)
+            {
+              const unsigned int chunk_size =
+                my_ghosts->second - my_ghosts->first;
+              if (ghost_array_ptr + offset !=
+                  ghost_array.data() + my_ghosts->first)
+                {
+                  if constexpr (std::is_same_v<MemorySpaceType,
+                                               MemorySpace::Host>)
+                    {
+                      if (offset > my_ghosts->first)
+                        std::copy_backward(ghost_array.data() +
+                                             my_ghosts->first,
+                                           ghost_array_ptr + my_ghosts->second,
+                                           ghost_array.data() + offset);
+                      else
+                        std::copy(ghost_array.data() + my_ghosts->first,
+                                  ghost_array.data() + my_ghosts->second,
+                                  ghost_array_ptr + offset);
+                      std::fill(std::max(ghost_array.data() + my_ghosts->first,
+                                         ghost_array_ptr + offset + chunk_size),
+                                ghost_array.data() + my_ghosts->second,
+                                Number{});
+                    }
+                  else
+                    {
+                      Kokkos::View<Number *, MemorySpace::Default::kokkos_space>
+                        copy("copy", chunk_size);
+                      Kokkos::deep_copy(
+                        copy,
+                        Kokkos::View<Number *,
+                                     MemorySpace::Default::kokkos_space>(
+                          ghost_array.data() + my_ghosts->first, chunk_size));
+                      Kokkos::deep_copy(
+                        Kokkos::View<Number *,
+                                     MemorySpace::Default::kokkos_space>(
+                          ghost_array_ptr + offset, chunk_size),
+                        copy);
+                      Kokkos::deep_copy(
+                        Kokkos::View<Number *,
+                                     MemorySpace::Default::kokkos_space>(
+                          std::max(ghost_array.data() + my_ghosts->first,
+                                   ghost_array_ptr + offset + chunk_size),
+                          (ghost_array.data() + my_ghosts->second -
+                           std::max(ghost_array.data() + my_ghosts->first,
+                                    ghost_array_ptr + offset + chunk_size))),
+                        0);
+                    }
+                }
+              offset += chunk_size;
+            }
+          AssertDimension(offset, ghost_targets_data[i].second);
+        }
+    }
+
+
+
     template <typename Number, typename MemorySpaceType>
     void
     Partitioner::import_from_ghosted_array_start(
@@ -316,8 +539,12 @@ namespace Utilities
           return;
 
       // nothing to do when we neither have import
-      // nor ghost indices.
-      if (n_ghost_indices() == 0 && n_import_indices() == 0)
+      // nor ghost indices, unless all processes need to take part in the
+      // neighborhood collective
+      const bool use_neighborhood_collectives =
+        neighborhood_communication != nullptr;
+      if (n_ghost_indices() == 0 && n_import_indices() == 0 &&
+          use_neighborhood_collectives == false)
         return;
 
       const unsigned int n_import_targets = import_targets_data.size();
@@ -336,11 +563,15 @@ namespace Utilities
         communication_channel;
       Assert(mpi_tag <= Utilities::MPI::internal::Tags::partitioner_import_end,
              ExcInternalError());
-      requests.resize(n_import_targets + n_ghost_targets);
+      requests.resize(use_neighborhood_collectives ?
+                        1 :
+                        n_import_targets + n_ghost_targets);
 
       // initiate the receive operations
       Number *temp_array_ptr = temporary_storage.data();
-      for (unsigned int i = 0; i < n_import_targets; ++i)
+      for (unsigned int i = 0;
+           i < (use_neighborhood_collectives ? 0 : n_import_targets);
+           ++i)
         {
           AssertThrow(
             static_cast<std::size_t>(import_targets_data[i].second) *
@@ -369,75 +600,7 @@ namespace Utilities
       Number *ghost_array_ptr = ghost_array.data();
       for (unsigned int i = 0; i < n_ghost_targets; ++i)
         {
-          // in case we only sent a subset of indices, we now need to move the
-          // data to the correct positions and delete the old content
-          if (n_ghost_indices_in_larger_set > n_ghost_indices() &&
-              ghost_array.size() == n_ghost_indices_in_larger_set)
-            {
-              std::vector<std::pair<unsigned int, unsigned int>>::const_iterator
-                my_ghosts = ghost_indices_subset_data.begin() +
-                            ghost_indices_subset_chunks_by_rank_data[i],
-                end_my_ghosts = ghost_indices_subset_data.begin() +
-                                ghost_indices_subset_chunks_by_rank_data[i + 1];
-              unsigned int offset = 0;
-              for (; my_ghosts != end_my_ghosts; ++my_ghosts)
-                {
-                  const unsigned int chunk_size =
-                    my_ghosts->second - my_ghosts->first;
-                  if (ghost_array_ptr + offset !=
-                      ghost_array.data() + my_ghosts->first)
-                    {
-                      if constexpr (std::is_same_v<MemorySpaceType,
-                                                   MemorySpace::Host>)
-                        {
-                          if (offset > my_ghosts->first)
-                            std::copy_backward(ghost_array.data() +
-                                                 my_ghosts->first,
-                                               ghost_array_ptr +
-                                                 my_ghosts->second,
-                                               ghost_array.data() + offset);
-                          else
-                            std::copy(ghost_array.data() + my_ghosts->first,
-                                      ghost_array.data() + my_ghosts->second,
-                                      ghost_array_ptr + offset);
-                          std::fill(
-                            std::max(ghost_array.data() + my_ghosts->first,
-                                     ghost_array_ptr + offset + chunk_size),
-                            ghost_array.data() + my_ghosts->second,
-                            Number{});
-                        }
-                      else
-                        {
-                          Kokkos::View<Number *,
-                                       MemorySpace::Default::kokkos_space>
-                            copy("copy", chunk_size);
-                          Kokkos::deep_copy(
-                            copy,
-                            Kokkos::View<Number *,
-                                         MemorySpace::Default::kokkos_space>(
-                              ghost_array.data() + my_ghosts->first,
-                              chunk_size));
-                          Kokkos::deep_copy(
-                            Kokkos::View<Number *,
-                                         MemorySpace::Default::kokkos_space>(
-                              ghost_array_ptr + offset, chunk_size),
-                            copy);
-                          Kokkos::deep_copy(
-                            Kokkos::View<Number *,
-                                         MemorySpace::Default::kokkos_space>(
-                              std::max(ghost_array.data() + my_ghosts->first,
-                                       ghost_array_ptr + offset + chunk_size),
-                              (ghost_array.data() + my_ghosts->second -
-                               std::max(ghost_array.data() + my_ghosts->first,
-                                        ghost_array_ptr + offset +
-                                          chunk_size))),
-                            0);
-                        }
-                    }
-                  offset += chunk_size;
-                }
-              AssertDimension(offset, ghost_targets_data[i].second);
-            }
+          compact_ghost_data_for_import(i, ghost_array, ghost_array_ptr);
 
           AssertThrow(
             static_cast<std::size_t>(ghost_targets_data[i].second) *
@@ -448,18 +611,39 @@ namespace Utilities
                        "exceeds this value. This is not supported."));
           if (std::is_same_v<MemorySpaceType, MemorySpace::Default>)
             Kokkos::fence();
-          const int ierr =
-            MPI_Isend(ghost_array_ptr,
-                      ghost_targets_data[i].second * sizeof(Number),
-                      MPI_BYTE,
-                      ghost_targets_data[i].first,
-                      mpi_tag,
-                      communicator,
-                      &requests[n_import_targets + i]);
-          AssertThrowMPI(ierr);
+          if (use_neighborhood_collectives == false)
+            {
+              const int ierr =
+                MPI_Isend(ghost_array_ptr,
+                          ghost_targets_data[i].second * sizeof(Number),
+                          MPI_BYTE,
+                          ghost_targets_data[i].first,
+                          mpi_tag,
+                          communicator,
+                          &requests[n_import_targets + i]);
+              AssertThrowMPI(ierr);
+            }
 
           ghost_array_ptr += ghost_targets_data[i].second;
         }
+
+      // with neighborhood collectives, the data to be sent has been moved to
+      // the front of the ghost array, so send it all at once
+      if (use_neighborhood_collectives)
+        {
+          const int ierr = MPI_Ineighbor_alltoallv(
+            ghost_array.data(),
+            neighborhood_communication->ghost_counts.data(),
+            neighborhood_communication->ghost_offsets.data(),
+            Utilities::MPI::mpi_type_id_for_type<Number>,
+            temporary_storage.data(),
+            neighborhood_communication->import_counts.data(),
+            neighborhood_communication->import_offsets.data(),
+            Utilities::MPI::mpi_type_id_for_type<Number>,
+            neighborhood_communication->import_communicator,
+            requests.data());
+          AssertThrowMPI(ierr);
+        }
     }
 
 
@@ -526,6 +710,69 @@ namespace Utilities
 
 
 
+    template <typename Number>
+    void
+    Partitioner::accumulate_import_data(
+      const VectorOperation::values vector_operation,
+      const Number                 *read_position,
+      Number                       *locally_owned_array) const
+    {
+      // If the operation is no insertion, add the imported data to the
+      // local values. For insert, nothing is done here (but in debug
+      // mode we assert that the specified value is either zero or
+      // matches with the ones already present
+      if (vector_operation == VectorOperation::add)
+        for (const auto &import_range : import_indices_data)
+          for (unsigned int j = import_range.first; j < import_range.second;
+               j++)
+            locally_owned_array[j] += *read_position++;
+      else if (vector_operation == VectorOperation::min)
+        for (const auto &import_range : import_indices_data)
+          for (unsigned int j = import_range.first; j < import_range.second;
+               j++)
+            {
+              locally_owned_array[j] =
+                internal::get_min(*read_position, locally_owned_array[j]);
+              ++read_position;
+            }
+      else if (vector_operation == VectorOperation::max)
+        for (const auto &import_range : import_indices_data)
+          for (unsigned int j = import_range.first; j < import_range.second;
+               j++)
+            {
+              locally_owned_array[j] =
+                internal::get_max(*read_position, locally_owned_array[j]);
+              ++read_position;
+            }
+      else
+        for (const auto &import_range : import_indices_data)
+          for (unsigned int j = import_range.first; j < import_range.second;
+               j++, read_position++)
+            // Below we use relatively large precision in units in the
+            // last place (ULP) as this Assert can be easily triggered
+            // in p::d::SolutionTransfer. The rationale is that during
+            // interpolation on two elements sharing the face, values on
+            // this face obtained from each side might be different due
+            // to additions being done in different order. If the local
+            // value is zero, it indicates that the local process has
+            // not set the value during the cell loop and its value can
+            // be safely overridden.
+            Assert(*read_position == Number() ||
+                     internal::get_abs(locally_owned_array[j] -
+                                       *read_position) <=
+                       internal::get_abs(locally_owned_array[j] +
+                                         *read_position) *
+                         100000. *
+                         std::numeric_limits<typename numbers::NumberTraits<
+                           Number>::real_type>::epsilon(),
+                   typename dealii::LinearAlgebra::distributed::Vector<
+                     Number>::ExcNonMatchingElements(*read_position,
+                                                     locally_owned_array[j],
+                                                     my_pid));
+    }
+
+
+
     template <typename Number, typename MemorySpaceType>
     void
     Partitioner::import_from_ghosted_array_finish(
@@ -562,8 +809,12 @@ namespace Utilities
             return;
           }
 
+      const bool use_neighborhood_collectives =
+        neighborhood_communication != nullptr;
+
       // nothing to do when we neither have import nor ghost indices.
-      if (n_ghost_indices() == 0 && n_import_indices() == 0)
+      if (n_ghost_indices() == 0 && n_import_indices() == 0 &&
+          use_neighborhood_collectives == false)
         return;
 
       const unsigned int n_import_targets = import_targets_data.size();
@@ -581,14 +832,29 @@ namespace Utilities
 #    endif
 
       if (vector_operation != VectorOperation::insert)
-        AssertDimension(n_ghost_targets + n_import_targets, requests.size());
+        AssertDimension(use_neighborhood_collectives ?
+                          1 :
+                          n_ghost_targets + n_import_targets,
+                        requests.size());
+
+      // the neighborhood collective completes sends and receives at once
+      if (use_neighborhood_collectives && requests.size() > 0)
+        {
+          const int ierr = MPI_Wait(requests.data(), MPI_STATUS_IGNORE);
+          AssertThrowMPI(ierr);
+        }
+
       // first wait for the receive to complete
       if (requests.size() > 0 && n_import_targets > 0)
         {
           AssertDimension(locally_owned_array.size(), locally_owned_size());
-          const int ierr =
-            MPI_Waitall(n_import_targets, requests.data(), MPI_STATUSES_IGNORE);
-          AssertThrowMPI(ierr);
+          if (use_neighborhood_collectives == false)
+            {
+              const int ierr = MPI_Waitall(n_import_targets,
+                                           requests.data(),
+                                           MPI_STATUSES_IGNORE);
+              AssertThrowMPI(ierr);
+            }
 
           const Number *read_position = temporary_storage.data();
 #    if defined(DEAL_II_MPI_WITH_DEVICE_SUPPORT)
@@ -687,81 +953,30 @@ namespace Utilities
           else
 #    endif
             {
-              // If the operation is no insertion, add the imported data to the
-              // local values. For insert, nothing is done here (but in debug
-              // mode we assert that the specified value is either zero or
-              // matches with the ones already present
-              if (vector_operation == VectorOperation::add)
-                for (const auto &import_range : import_indices_data)
-                  for (unsigned int j = import_range.first;
-                       j < import_range.second;
-                       j++)
-                    locally_owned_array[j] += *read_position++;
-              else if (vector_operation == VectorOperation::min)
-                for (const auto &import_range : import_indices_data)
-                  for (unsigned int j = import_range.first;
-                       j < import_range.second;
-                       j++)
-                    {
-                      locally_owned_array[j] =
-                        internal::get_min(*read_position,
-                                          locally_owned_array[j]);
-                      ++read_position;
-                    }
-              else if (vector_operation == VectorOperation::max)
-                for (const auto &import_range : import_indices_data)
-                  for (unsigned int j = import_range.first;
-                       j < import_range.second;
-                       j++)
-                    {
-                      locally_owned_array[j] =
-                        internal::get_max(*read_position,
-                                          locally_owned_array[j]);
-                      ++read_position;
-                    }
-              else
-                for (const auto &import_range : import_indices_data)
-                  for (unsigned int j = import_range.first;
-                       j < import_range.second;
-                       j++, read_position++)
-                    // Below we use relatively large precision in units in the
-                    // last place (ULP) as this Assert can be easily triggered
-                    // in p::d::SolutionTransfer. The rationale is that during
-                    // interpolation on two elements sharing the face, values on
-                    // this face obtained from each side might be different due
-                    // to additions being done in different order. If the local
-                    // value is zero, it indicates that the local process has
-                    // not set the value during the cell loop and its value can
-                    // be safely overridden.
-                    Assert(
-                      *read_position == Number() ||
-                        internal::get_abs(locally_owned_array[j] -
-                                          *read_position) <=
-                          internal::get_abs(locally_owned_array[j] +
-                                            *read_position) *
-                            100000. *
-                            std::numeric_limits<typename numbers::NumberTraits<
-                              Number>::real_type>::epsilon(),
-                      typename dealii::LinearAlgebra::distributed::Vector<
-                        Number>::ExcNonMatchingElements(*read_position,
-                                                        locally_owned_array[j],
-                                                        my_pid));
+              accumulate_import_data(vector_operation,
+                                     read_position,
+                                     locally_owned_array.data());
+              read_position += n_import_indices();
             }
 
           AssertDimension(read_position - temporary_storage.data(),
                           n_import_indices());
         }
 
-      // wait for the send operations to complete
-      if (requests.size() > 0 && n_ghost_targets > 0)
+      // wait for the send operations to complete, unless this has already
+      // been done for the neighborhood collective
+      if (use_neighborhood_collectives == false)
         {
-          const int ierr = MPI_Waitall(n_ghost_targets,
-                                       &requests[n_import_targets],
-                                       MPI_STATUSES_IGNORE);
-          AssertThrowMPI(ierr);
+          if (requests.size() > 0 && n_ghost_targets > 0)
+            {
+              const int ierr = MPI_Waitall(n_ghost_targets,
+                                           &requests[n_import_targets],
+                                           MPI_STATUSES_IGNORE);
+              AssertThrowMPI(ierr);
+            }
+          else
+            AssertDimension(n_ghost_indices(), 0);
         }
-      else
-        AssertDimension(n_ghost_indices(), 0);
 
       // clear the ghost array in case we did not yet do that in the _start
       // function
@@ -791,6 +1006,334 @@ namespace Utilities
     }
 
 
+
+
+    template <typename Number>
+    void
+    Partitioner::export_to_ghosted_array_init_persistent(
+      const unsigned int        communication_channel,
+      const ArrayView<Number>  &temporary_storage,
+      const ArrayView<Number>  &ghost_array,
+      std::vector<MPI_Request> &requests) const
+    {
+      AssertDimension(temporary_storage.size(), n_import_indices());
+      AssertIndexRange(communication_channel, 200);
+      Assert(ghost_array.size() == n_ghost_indices() ||
+               ghost_array.size() == n_ghost_indices_in_larger_set,
+             ExcGhostIndexArrayHasWrongSize(ghost_array.size(),
+                                            n_ghost_indices(),
+                                            n_ghost_indices_in_larger_set));
+      Assert(requests.empty(),
+             ExcMessage("The persistent requests must be freed before they "
+                        "can be set up again."));
+      Assert(uses_neighborhood_collectives() == false,
+             ExcMessage("Persistent requests cannot be combined with "
+                        "neighborhood collectives."));
+
+      const unsigned int n_import_targets = import_targets_data.size();
+      const unsigned int n_ghost_targets  = ghost_targets_data.size();
+
+      const unsigned int mpi_tag =
+        Utilities::MPI::internal::Tags::partitioner_export_start +
+        communication_channel;
+      Assert(mpi_tag <= Utilities::MPI::internal::Tags::partitioner_export_end,
+             ExcInternalError());
+
+      requests.resize(n_import_targets + n_ghost_targets);
+
+      // same layout of the receive buffers as in
+      // export_to_ghosted_array_start()
+      AssertIndexRange(n_ghost_indices(), n_ghost_indices_in_larger_set + 1);
+      const bool use_larger_set =
+        (n_ghost_indices_in_larger_set > n_ghost_indices() &&
+         ghost_array.size() == n_ghost_indices_in_larger_set);
+      Number *ghost_array_ptr =
+        use_larger_set ? ghost_array.data() + n_ghost_indices_in_larger_set -
+                           n_ghost_indices() :
+                         ghost_array.data();
+
+      for (unsigned int i = 0; i < n_ghost_targets; ++i)
+        {
+          const int ierr =
+            MPI_Recv_init(ghost_array_ptr,
+                          ghost_targets_data[i].second * sizeof(Number),
+                          MPI_BYTE,
+                          ghost_targets_data[i].first,
+                          mpi_tag,
+                          communicator,
+                          &requests[i]);
+          AssertThrowMPI(ierr);
+          ghost_array_ptr += ghost_targets_data[i].second;
+        }
+
+      Number *temp_array_ptr = temporary_storage.data();
+      for (unsigned int i = 0; i < n_import_targets; ++i)
+        {
+          const int ierr =
+            MPI_Send_init(temp_array_ptr,
+                          import_targets_data[i].second * sizeof(Number),
+                          MPI_BYTE,
+                          import_targets_data[i].first,
+                          mpi_tag,
+                          communicator,
+                          &requests[n_ghost_targets + i]);
+          AssertThrowMPI(ierr);
+          temp_array_ptr += import_targets_data[i].second;
+        }
+    }
+
+
+
+    template <typename Number>
+    void
+    Partitioner::export_to_ghosted_array_start_persistent(
+      const ArrayView<const Number> &locally_owned_array,
+      const ArrayView<Number>       &temporary_storage,
+      std::vector<MPI_Request>      &requests) const
+    {
+      AssertDimension(temporary_storage.size(), n_import_indices());
+
+      const unsigned int n_import_targets = import_targets_data.size();
+      const unsigned int n_ghost_targets  = ghost_targets_data.size();
+
+      AssertDimension(requests.size(), n_import_targets + n_ghost_targets);
+      if (n_import_targets > 0)
+        AssertDimension(locally_owned_array.size(), locally_owned_size());
+
+      if (n_ghost_targets > 0)
+        {
+          const int ierr = MPI_Startall(n_ghost_targets, requests.data());
+          AssertThrowMPI(ierr);
+        }
+
+      Number *temp_array_ptr = temporary_storage.data();
+      for (unsigned int i = 0; i < n_import_targets; ++i)
+        {
+          pack_export_data(i, locally_owned_array.data(), temp_array_ptr);
+
+          const int ierr = MPI_Start(&requests[n_ghost_targets + i]);
+          AssertThrowMPI(ierr);
+          temp_array_ptr += import_targets_data[i].second;
+        }
+    }
+
+
+
+    template <typename Number>
+    void
+    Partitioner::export_to_ghosted_array_finish_persistent(
+      const ArrayView<Number>  &ghost_array,
+      std::vector<MPI_Request> &requests) const
+    {
+      Assert(ghost_array.size() == n_ghost_indices() ||
+               ghost_array.size() == n_ghost_indices_in_larger_set,
+             ExcGhostIndexArrayHasWrongSize(ghost_array.size(),
+                                            n_ghost_indices(),
+                                            n_ghost_indices_in_larger_set));
+      AssertDimension(ghost_targets().size() + import_targets().size(),
+                      requests.size());
+
+      // waiting for persistent requests leaves them intact, but inactive
+      if (requests.size() > 0)
+        {
+          const int ierr =
+            MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+          AssertThrowMPI(ierr);
+        }
+
+      move_ghost_data_to_larger_set(ghost_array);
+    }
+
+
+
+    template <typename Number>
+    void
+    Partitioner::import_from_ghosted_array_init_persistent(
+      const unsigned int        communication_channel,
+      const ArrayView<Number>  &ghost_array,
+      const ArrayView<Number>  &temporary_storage,
+      std::vector<MPI_Request> &requests) const
+    {
+      AssertDimension(temporary_storage.size(), n_import_indices());
+      AssertIndexRange(communication_channel, 200);
+      Assert(ghost_array.size() == n_ghost_indices() ||
+               ghost_array.size() == n_ghost_indices_in_larger_set,
+             ExcGhostIndexArrayHasWrongSize(ghost_array.size(),
+                                            n_ghost_indices(),
+                                            n_ghost_indices_in_larger_set));
+      Assert(requests.empty(),
+             ExcMessage("The persistent requests must be freed before they "
+                        "can be set up again."));
+      Assert(uses_neighborhood_collectives() == false,
+             ExcMessage("Persistent requests cannot be combined with "
+                        "neighborhood collectives."));
+
+      const unsigned int n_import_targets = import_targets_data.size();
+      const unsigned int n_ghost_targets  = ghost_targets_data.size();
+
+      const unsigned int mpi_tag =
+        Utilities::MPI::internal::Tags::partitioner_import_start +
+        communication_channel;
+      Assert(mpi_tag <= Utilities::MPI::internal::Tags::partitioner_import_end,
+             ExcInternalError());
+
+      requests.resize(n_import_targets + n_ghost_targets);
+
+      Number *temp_array_ptr = temporary_storage.data();
+      for (unsigned int i = 0; i < n_import_targets; ++i)
+        {
+          AssertThrow(
+            static_cast<std::size_t>(import_targets_data[i].second) *
+                sizeof(Number) <
+              static_cast<std::size_t>(std::numeric_limits<int>::max()),
+            ExcMessage("Index overflow: Maximum message size in MPI is 2GB. "
+                       "The number of ghost entries times the size of 'Number' "
+                       "exceeds this value. This is not supported."));
+          const int ierr =
+            MPI_Recv_init(temp_array_ptr,
+                          import_targets_data[i].second * sizeof(Number),
+                          MPI_BYTE,
+                          import_targets_data[i].first,
+                          mpi_tag,
+                          communicator,
+                          &requests[i]);
+          AssertThrowMPI(ierr);
+          temp_array_ptr += import_targets_data[i].second;
+        }
+
+      // the data of each ghost target is sent from the front of the ghost
+      // array, see compact_ghost_data_for_import()
+      Number *ghost_array_ptr = ghost_array.data();
+      for (unsigned int i = 0; i < n_ghost_targets; ++i)
+        {
+          AssertThrow(
+            static_cast<std::size_t>(ghost_targets_data[i].second) *
+                sizeof(Number) <
+              static_cast<std::size_t>(std::numeric_limits<int>::max()),
+            ExcMessage("Index overflow: Maximum message size in MPI is 2GB. "
+                       "The number of ghost entries times the size of 'Number' "
+                       "exceeds this value. This is not supported."));
+          const int ierr =
+            MPI_Send_init(ghost_array_ptr,
+                          ghost_targets_data[i].second * sizeof(Number),
+                          MPI_BYTE,
+                          ghost_targets_data[i].first,
+                          mpi_tag,
+                          communicator,
+                          &requests[n_import_targets + i]);
+          AssertThrowMPI(ierr);
+          ghost_array_ptr += ghost_targets_data[i].second;
+        }
+    }
+
+
+
+    template <typename Number>
+    void
+    Partitioner::import_from_ghosted_array_start_persistent(
+      const VectorOperation::values vector_operation,
+      const ArrayView<Number>      &ghost_array,
+      std::vector<MPI_Request>     &requests) const
+    {
+      Assert(ghost_array.size() == n_ghost_indices() ||
+               ghost_array.size() == n_ghost_indices_in_larger_set,
+             ExcGhostIndexArrayHasWrongSize(ghost_array.size(),
+                                            n_ghost_indices(),
+                                            n_ghost_indices_in_larger_set));
+
+      (void)vector_operation;
+
+      // same logic as in import_from_ghosted_array_start()
+      if constexpr (running_in_debug_mode() == false)
+        if (vector_operation == VectorOperation::insert)
+          return;
+
+      if (n_ghost_indices() == 0 && n_import_indices() == 0)
+        return;
+
+      const unsigned int n_import_targets = import_targets_data.size();
+      const unsigned int n_ghost_targets  = ghost_targets_data.size();
+
+      AssertDimension(requests.size(), n_import_targets + n_ghost_targets);
+
+      if (n_import_targets > 0)
+        {
+          const int ierr = MPI_Startall(n_import_targets, requests.data());
+          AssertThrowMPI(ierr);
+        }
+
+      Number *ghost_array_ptr = ghost_array.data();
+      for (unsigned int i = 0; i < n_ghost_targets; ++i)
+        {
+          compact_ghost_data_for_import(i, ghost_array, ghost_array_ptr);
+
+          const int ierr = MPI_Start(&requests[n_import_targets + i]);
+          AssertThrowMPI(ierr);
+          ghost_array_ptr += ghost_targets_data[i].second;
+        }
+    }
+
+
+
+    template <typename Number>
+    void
+    Partitioner::import_from_ghosted_array_finish_persistent(
+      const VectorOperation::values  vector_operation,
+      const ArrayView<const Number> &temporary_storage,
+      const ArrayView<Number>       &locally_owned_array,
+      const ArrayView<Number>       &ghost_array,
+      std::vector<MPI_Request>      &requests) const
+    {
+      AssertDimension(temporary_storage.size(), n_import_indices());
+      Assert(ghost_array.size() == n_ghost_indices() ||
+               ghost_array.size() == n_ghost_indices_in_larger_set,
+             ExcGhostIndexArrayHasWrongSize(ghost_array.size(),
+                                            n_ghost_indices(),
+                                            n_ghost_indices_in_larger_set));
+
+      // in optimized mode, no communication was started for insert, so only
+      // clear the ghosts
+      if constexpr (running_in_debug_mode() == false)
+        if (vector_operation == VectorOperation::insert)
+          {
+            std::fill(ghost_array.begin(), ghost_array.end(), Number());
+            return;
+          }
+
+      if (n_ghost_indices() == 0 && n_import_indices() == 0)
+        return;
+
+      const unsigned int n_import_targets = import_targets_data.size();
+      const unsigned int n_ghost_targets  = ghost_targets_data.size();
+
+      AssertDimension(requests.size(), n_import_targets + n_ghost_targets);
+
+      if (n_import_targets > 0)
+        {
+          AssertDimension(locally_owned_array.size(), locally_owned_size());
+          const int ierr =
+            MPI_Waitall(n_import_targets, requests.data(), MPI_STATUSES_IGNORE);
+          AssertThrowMPI(ierr);
+
+          accumulate_import_data(vector_operation,
+                                 temporary_storage.data(),
+                                 locally_owned_array.data());
+        }
+
+      if (n_ghost_targets > 0)
+        {
+          const int ierr = MPI_Waitall(n_ghost_targets,
+                                       &requests[n_import_targets],
+                                       MPI_STATUSES_IGNORE);
+          AssertThrowMPI(ierr);
+        }
+
+      std::fill(ghost_array.data(),
+                ghost_array.data() + n_ghost_indices(),
+                Number());
+    }
+
+
 #  endif // ifdef DEAL_II_WITH_MPI
 #endif   // ifndef DOXYGEN
 
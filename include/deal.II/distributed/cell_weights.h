@@ -203,6 +203,36 @@ namespace parallel
     static WeightingFunction
     ndofs_weighting(const std::vector<std::pair<float, float>> &coefficients);
 
+    /**
+     * Choose the weight $w_K$ of each cell $K$ by the index $i$ of the finite
+     * element within the hp::FECollection of the DoFHandler that will be
+     * assigned to $K$: \f[ w_K = w_i, \f] where $w_i$ is given by the
+     * entry $i$ of @p weights. This allows to balance the load according to
+     * the cost of each element as measured by the application, e.g., by
+     * MatrixFreeTools::measure_cost_per_fe_index():
+     * @code
+     * const std::vector<double> costs =
+     *   MatrixFreeTools::measure_cost_per_fe_index(matrix_free,
+     *                                              cell_operation,
+     *                                              dst,
+     *                                              src);
+     *
+     * // weight the cheapest element with 100
+     * const double min_cost = *std::min_element(costs.begin(), costs.end());
+     * std::vector<float> weights;
+     * for (const double cost : costs)
+     *   weights.push_back(100. * cost / min_cost);
+     *
+     * parallel::CellWeights<dim> cell_weights(
+     *   dof_handler, parallel::CellWeights<dim>::fe_index_weighting(weights));
+     * @endcode
+     *
+     * The right hand side will be rounded to the nearest integer since cell
+     * weights are required to be integers.
+     */
+    static WeightingFunction
+    fe_index_weighting(const std::vector<float> &weights);
+
     /**
      * @}
      */
@@ -120,7 +120,8 @@ namespace parallel
        *
        * The constructor requires that exactly one of
        * <code>partition_auto</code>, <code>partition_metis</code>,
-       * <code>partition_zorder</code>, <code>partition_zoltan</code> and
+       * <code>partition_zorder</code>, <code>partition_zoltan</code>,
+       * <code>partition_hilbert</code> and
        * <code>partition_custom_signal</code> is set. If
        * <code>partition_auto</code> is chosen, it will use
        * <code>partition_zoltan</code> (if available), then
@@ -220,6 +221,20 @@ namespace parallel
          */
         partition_custom_signal = 0x4,
 
+        /**
+         * Partition active cells by cutting a Hilbert space filling curve
+         * through the cell centers into pieces of equal size, or of equal
+         * weight if the <code>weight</code> signal of the triangulation is
+         * used. See GridTools::partition_triangulation_hilbert() for
+         * details.
+         *
+         * In contrast to <code>partition_zorder</code>, the curve does not
+         * depend on the order of the coarse cells, and in contrast to
+         * <code>partition_metis</code> and <code>partition_zoltan</code>, no
+         * external graph partitioner is required.
+         */
+        partition_hilbert = 0x5,
+
         /**
          * This flag needs to be set to use the geometric multigrid
          * functionality. This option requires additional computation and
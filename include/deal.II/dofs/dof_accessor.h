@@ -32,6 +32,7 @@
 
 #include <boost/container/small_vector.hpp>
 
+#include <algorithm>
 #include <limits>
 #include <set>
 #include <type_traits>
@@ -2020,6 +2021,13 @@ public:
   /**
    * Set the DoF indices of this cell to the given values. This function
    * bypasses the DoF cache, if one exists for the given DoF handler class.
+   *
+   * @note If the DoFHandler stores the DoF indices of all active cells in a
+   *   cache (see DoFHandler::enable_cell_dof_indices_cache()), this function
+   *   discards the cache, since the indices of neighboring cells may change
+   *   as well. This modifies the DoFHandler object, and so this function
+   *   must then not be called while other threads access the same
+   *   DoFHandler, for example to read the DoF indices of other cells.
    */
   void
   set_dof_indices(const std::vector<types::global_dof_index> &dof_indices);
@@ -3414,6 +3422,43 @@ namespace internal
 
 
 
+      /**
+       * If the DoFHandler of the given @p cell caches the DoF indices of its
+       * active cells (see DoFHandler::enable_cell_dof_indices_cache()),
+       * copy the cached indices of the cell into @p dof_indices and return
+       * true. Return false if no cache entry of the right size is available,
+       * in which case the indices need to be gathered from the objects of
+       * the cell.
+       */
+      template <int dim,
+                int spacedim,
+                bool level_dof_access,
+                typename DoFIndicesType>
+      static bool
+      get_cached_cell_dof_indices(
+        const dealii::DoFCellAccessor<dim, spacedim, level_dof_access> &cell,
+        DoFIndicesType &dof_indices)
+      {
+        const auto &cache_ptr = cell.dof_handler->cell_dof_cache_ptr;
+        const unsigned int level = cell.level();
+        if (level >= cache_ptr.size() || cache_ptr[level].empty())
+          return false;
+
+        const auto begin = cache_ptr[level][cell.index()];
+        const auto end   = cache_ptr[level][cell.index() + 1];
+        if (end - begin != dof_indices.size())
+          return false;
+
+        const types::global_dof_index *cached_indices =
+          cell.dof_handler->cell_dof_cache_indices[level].data();
+        std::copy(cached_indices + begin,
+                  cached_indices + end,
+                  dof_indices.begin());
+        return true;
+      }
+
+
+
       template <int dim, int spacedim, bool level_dof_access, int structdim>
       static void
       set_dof_indices(
@@ -724,6 +724,42 @@ public:
   bool
   has_active_dofs() const;
 
+  /**
+   * Enable or disable a cache that stores the global DoF indices of all
+   * active, non-artificial cells contiguously, one cell after the other.
+   *
+   * Without this cache, DoFCellAccessor::get_dof_indices() gathers the
+   * indices of a cell from the separate arrays for vertices, lines, quads,
+   * and the cell itself, adjusting the indices for non-standard line and
+   * face orientations. With the cache, the indices are instead copied from
+   * a single array. This is used transparently by
+   * DoFCellAccessor::get_dof_indices(), DoFCellAccessor::get_dof_values(),
+   * DoFCellAccessor::set_dof_values(), and
+   * DoFCellAccessor::distribute_local_to_global(), and thus speeds up
+   * matrix-based assembly loops that query the DoF indices of every cell
+   * many times (e.g., in every Newton iteration) on the same mesh.
+   *
+   * The cache is filled by distribute_dofs() and renumber_dofs(), or
+   * immediately by this function if DoFs have already been distributed.
+   * It is discarded when the triangulation is refined or coarsened, and is
+   * only rebuilt by the next call to distribute_dofs(). The cache is not
+   * written by save() but is rebuilt by load().
+   *
+   * @note The cache requires memory for the product of the number of active
+   *   cells and the number of DoFs per cell, which is typically several
+   *   times the memory needed to store the DoF indices without it. It is
+   *   therefore disabled by default.
+   */
+  void
+  enable_cell_dof_indices_cache(const bool enable = true);
+
+  /**
+   * Return whether the DoF indices of active cells are currently available
+   * from the cache described in enable_cell_dof_indices_cache().
+   */
+  bool
+  has_cell_dof_indices_cache() const;
+
   /**
    * After distribute_dofs() with an FESystem element, the block structure of
    * global and level vectors is stored in a BlockInfo object accessible with
@@ -1556,6 +1592,31 @@ private:
    */
   mutable std::vector<std::vector<types::fe_index>> hp_cell_future_fe_indices;
 
+  /**
+   * Whether the DoF indices of active cells should be cached, see
+   * enable_cell_dof_indices_cache().
+   */
+  bool cell_dof_indices_cache_enabled;
+
+  /**
+   * Pointer to the first cached DoF index of each cell (identified by level
+   * and level index) in cell_dof_cache_indices (CRS scheme). The range is
+   * empty for cells that are not active or artificial. The vector of a level
+   * is empty if no cache is available for the cells on this level.
+   *
+   * Unlike the other CRS pointers of this class, which are of type
+   * offset_type, these are 64-bit numbers, since the number of DoF indices
+   * of all cells of a level can exceed the range of a 32-bit integer.
+   */
+  mutable std::vector<std::vector<std::size_t>> cell_dof_cache_ptr;
+
+  /**
+   * The cached DoF indices of the active cells on each level, in the order
+   * returned by DoFCellAccessor::get_dof_indices().
+   */
+  mutable std::vector<std::vector<types::global_dof_index>>
+    cell_dof_cache_indices;
+
   /**
    * An array to store the indices for level degrees of freedom located at
    * vertices.
@@ -1606,6 +1667,19 @@ private:
   void
   clear_mg_space();
 
+  /**
+   * Release the cached DoF indices of active cells.
+   */
+  void
+  clear_cell_dof_indices_cache() const;
+
+  /**
+   * Fill the cache of DoF indices of active cells if it is enabled and DoFs
+   * have been distributed.
+   */
+  void
+  update_cell_dof_indices_cache();
+
   /**
    * Set up DoFHandler policy.
    */
@@ -1811,6 +1885,15 @@ inline bool DoFHandler<dim, spacedim>::has_active_dofs() const
 
 
 
+template <int dim, int spacedim>
+DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
+inline bool DoFHandler<dim, spacedim>::has_cell_dof_indices_cache() const
+{
+  return cell_dof_cache_ptr.size() > 0;
+}
+
+
+
 template <int dim, int spacedim>
 DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
 inline types::global_dof_index DoFHandler<dim, spacedim>::n_dofs() const
@@ -2108,6 +2191,8 @@ void DoFHandler<dim, spacedim>::load(Archive &ar, const unsigned int)
                     "DoFHandler previously stored (" +
                     policy_name + ")."));
     }
+
+  this->update_cell_dof_indices_cache();
 }
 
 
@@ -942,6 +942,73 @@ namespace DoFRenumbering
     const std::vector<typename DoFHandler<dim, spacedim>::level_cell_iterator>
       &cell_order);
 
+  /**
+   * Renumber the degrees of freedom for data locality by first ordering the
+   * cells with the (reverse) Cuthill-McKee algorithm applied to the graph of
+   * cells that share a face, and then numbering the degrees of freedom cell
+   * by cell in this order, each one when it is encountered first (as in
+   * cell_wise()).
+   *
+   * The result is similar to the one of Cuthill_McKee() in that degrees of
+   * freedom that couple are numbered close to each other, which reduces the
+   * bandwidth of matrices and improves the cache efficiency of
+   * matrix-vector products and of incomplete factorizations. However, this
+   * function works on the graph of cells rather than the graph of degrees of
+   * freedom: it builds neither a sparsity pattern of the degrees of freedom
+   * nor constraints, and the graph it works on is smaller by the number of
+   * degrees of freedom per cell. It is therefore considerably cheaper than
+   * Cuthill_McKee() for higher order elements and large meshes. The
+   * neighbors of the cells are determined in parallel using the task-based
+   * parallelization of the library.
+   *
+   * A similar locality-preserving numbering can be obtained by passing the
+   * cells in the order given by a space-filling curve to cell_wise(), e.g.,
+   * the one computed by GridTools::compute_active_cell_hilbert_order().
+   *
+   * @param dof_handler The DoFHandler object to work on.
+   * @param reversed_numbering Whether to use the reverse Cuthill-McKee
+   *   ordering of the cells (the default) or the original one.
+   *
+   * <h4> Operation in parallel </h4>
+   *
+   * As for Cuthill_McKee(), if the given DoFHandler uses a parallel
+   * triangulation, each process only orders its locally owned cells, using
+   * the faces between them, and renumbers its locally owned degrees of
+   * freedom within the set of indices it owned before, without any
+   * communication.
+   */
+  template <int dim, int spacedim>
+  void
+  cell_graph_Cuthill_McKee(DoFHandler<dim, spacedim> &dof_handler,
+                           const bool reversed_numbering = true);
+
+  /**
+   * Like the previous function, but for the level degrees of freedom of the
+   * given @p level of a multigrid hierarchy. The graph is built from the
+   * faces between the (locally owned) cells of this level.
+   */
+  template <int dim, int spacedim>
+  void
+  cell_graph_Cuthill_McKee(DoFHandler<dim, spacedim> &dof_handler,
+                           const unsigned int         level,
+                           const bool reversed_numbering = true);
+
+  /**
+   * Compute the renumbering vector needed by the cell_graph_Cuthill_McKee()
+   * functions, for the active degrees of freedom if @p level is
+   * numbers::invalid_unsigned_int and for the level degrees of freedom of
+   * the given @p level otherwise. This function does not perform the
+   * renumbering on the DoFHandler but only returns the renumbering vector,
+   * which has one entry per locally owned (level) degree of freedom.
+   */
+  template <int dim, int spacedim>
+  void
+  compute_cell_graph_Cuthill_McKee(
+    std::vector<types::global_dof_index> &new_dof_indices,
+    const DoFHandler<dim, spacedim>      &dof_handler,
+    const bool                            reversed_numbering = true,
+    const unsigned int level = numbers::invalid_unsigned_int);
+
   /**
    * @}
    */
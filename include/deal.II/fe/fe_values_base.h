@@ -53,6 +53,18 @@
 
 DEAL_II_NAMESPACE_OPEN
 
+// Forward declarations
+#ifndef DOXYGEN
+namespace internal
+{
+  namespace MatrixFreeFunctions
+  {
+    template <typename Number>
+    struct ShapeInfo;
+  }
+} // namespace internal
+#endif
+
 /**
  * FEValues, FEFaceValues and FESubfaceValues objects are interfaces to finite
  * element and mapping classes on the one hand side, to cells and quadrature
@@ -1743,6 +1755,22 @@ protected:
                                                                      spacedim>
     finite_element_output;
 
+  /**
+   * For scalar elements whose shape functions are tensor products of
+   * one-dimensional polynomials, like FE_Q or FE_DGQ, used with a
+   * quadrature formula that is the tensor product of the same
+   * one-dimensional formula in all directions, this object holds the values
+   * and derivatives of the one-dimensional shape functions in the
+   * one-dimensional quadrature points. It is set up by FEValues and allows
+   * get_function_values() and get_function_gradients() to evaluate finite
+   * element functions with sum factorization, at a cost proportional to
+   * $k^{d+1}$ rather than $k^{2d}$ for elements of degree $k$. Empty
+   * otherwise.
+   */
+  std::unique_ptr<
+    const dealii::internal::MatrixFreeFunctions::ShapeInfo<double>>
+    tensor_product_shape_info;
+
 
   /**
    * Original update flags handed to the constructor of FEValues.
@@ -28,6 +28,10 @@
 #include <boost/container/small_vector.hpp>
 #include <boost/signals2/connection.hpp>
 
+#include <atomic>
+#include <memory>
+#include <mutex>
+
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -49,6 +53,13 @@ class DoFHandler;
  * in terms of the MappingQ::compute_mapping_support_points() function,
  * which is used in all operations of MappingQ. The information of the
  * mapping is pre-computed by the MappingQCache::initialize() function.
+ * Alternatively, the function MappingQCache::initialize_on_demand() sets up
+ * the cache such that the mapping support points of a cell are only
+ * computed the first time they are requested, e.g., by FEValues::reinit(),
+ * and then re-used by all subsequent requests. This avoids the repeated
+ * evaluation of the manifold description on curved meshes in case several
+ * FEValues, FEFaceValues, or FEInterfaceValues objects (possibly on several
+ * threads) visit the same cells.
  *
  * The use of this class is discussed extensively in step-65.
  */
@@ -124,6 +135,43 @@ public:
                const typename Triangulation<dim, spacedim>::cell_iterator &)>
                &compute_points_on_cell);
 
+  /**
+   * Set up the data cache such that the mapping support points of a cell of
+   * the given triangulation are computed by the given @p mapping the first
+   * time they are needed, rather than for all cells up front as done by the
+   * initialize() functions. All later requests for the same cell, from any
+   * FEValues, FEFaceValues, or FEInterfaceValues object using this mapping
+   * or one of its copies, re-use the cached points. The cache may be
+   * accessed by several threads concurrently.
+   *
+   * In contrast to the initialize() functions, the cache does not need to be
+   * set up again after the triangulation has changed: Upon the signal
+   * Triangulation::Signals::any_change, all cached points are discarded and
+   * get re-computed for the new cells as they are requested.
+   *
+   * @note The @p mapping and the @p triangulation are stored by reference and
+   * must therefore remain valid for as long as this object or any of its
+   * copies is used.
+   */
+  void
+  initialize_on_demand(const Mapping<dim, spacedim>       &mapping,
+                       const Triangulation<dim, spacedim> &triangulation);
+
+  /**
+   * Same as above, but letting the function given as argument compute the
+   * mapping support points of a cell, with the same requirements as for the
+   * respective initialize() function. Since the function might be called
+   * from several threads at once, it must not write into data shared with
+   * other threads. The function is stored and must remain valid for as long
+   * as this object or any of its copies is used.
+   */
+  void
+  initialize_on_demand(
+    const Triangulation<dim, spacedim> &triangulation,
+    const std::function<std::vector<Point<spacedim>>(
+      const typename Triangulation<dim, spacedim>::cell_iterator &)>
+      &compute_points_on_cell);
+
   /**
    * Initialize the data cache by computing the mapping support points for all
    * cells (on all levels) of the given triangulation and a given @p mapping
@@ -223,10 +271,75 @@ protected:
     const override;
 
 private:
+  /**
+   * Return a reference to the cached mapping support points of the given
+   * cell, computing them first in case the cache is filled on demand.
+   */
+  const std::vector<Point<spacedim>> &
+  get_support_points(
+    const typename Triangulation<dim, spacedim>::cell_iterator &cell) const;
+
+  /**
+   * A data structure holding the cache set up by initialize_on_demand(). It
+   * is shared among all copies of this object, such that the points
+   * computed via one copy are seen by all others.
+   */
+  struct OnDemandCache
+  {
+    /**
+     * Destructor. Disconnects from the triangulation.
+     */
+    ~OnDemandCache();
+
+    /**
+     * Resize the cache to the cells of the given triangulation and mark all
+     * entries as not computed yet.
+     */
+    void
+    reinit(const Triangulation<dim, spacedim> &triangulation);
+
+    /**
+     * The function computing the mapping support points of a cell.
+     */
+    std::function<std::vector<Point<spacedim>>(
+      const typename Triangulation<dim, spacedim>::cell_iterator &)>
+      compute_points_on_cell;
+
+    /**
+     * The mapping support points, indexed by the level and the index of
+     * a cell.
+     */
+    std::vector<std::vector<std::vector<Point<spacedim>>>> support_points;
+
+    /**
+     * Flags indicating whether the entries of support_points have already
+     * been computed, with the same indexing.
+     */
+    std::vector<std::unique_ptr<std::atomic<bool>[]>> is_computed;
+
+    /**
+     * A mutex serializing the writes into support_points.
+     */
+    std::mutex mutex;
+
+    /**
+     * The connection to Triangulation::signals::any_change, which discards
+     * the cached points.
+     */
+    boost::signals2::connection clear_signal;
+  };
+
+  /**
+   * The cache filled on demand, or a null pointer if the cache has been
+   * filled by one of the initialize() functions.
+   */
+  std::shared_ptr<OnDemandCache> on_demand_cache;
+
   /**
    * The point cache filled upon calling initialize(). It is made a shared
    * pointer to allow several instances (created via clone()) to share this
-   * cache.
+   * cache. If the cache is filled on demand, this pointer refers to the
+   * points stored in on_demand_cache.
    */
   std::shared_ptr<std::vector<std::vector<std::vector<Point<spacedim>>>>>
     support_point_cache;
@@ -1241,6 +1241,102 @@ namespace internal
 
 
 
+    /**
+     * Check whether the cell with the given vertices is the image of the
+     * reference cell under an affine map, i.e., a parallelogram in 2d or a
+     * parallelepiped in 3d, and if so, return the Jacobian of this map in
+     * the second argument. The vertices are given in the order of
+     * GeometryInfo, i.e., as they are stored in
+     * MappingQ::InternalData::mapping_support_points for a mapping of degree
+     * one.
+     */
+    template <int dim, int spacedim>
+    inline bool
+    compute_affine_jacobian(const std::vector<Point<spacedim>> &vertices,
+                            DerivativeForm<1, dim, spacedim>   &jacobian)
+    {
+      AssertDimension(vertices.size(), GeometryInfo<dim>::vertices_per_cell);
+
+      double max_edge_length = 0.;
+      for (unsigned int d = 0; d < dim; ++d)
+        {
+          const Tensor<1, spacedim> edge = vertices[1 << d] - vertices[0];
+          for (unsigned int i = 0; i < spacedim; ++i)
+            jacobian[i][d] = edge[i];
+          max_edge_length = std::max(max_edge_length, edge.norm());
+        }
+
+      // the remaining vertices must be sums of the edge vectors
+      for (unsigned int v = 3; v < GeometryInfo<dim>::vertices_per_cell; ++v)
+        {
+          Tensor<1, spacedim> expected = vertices[0] - vertices[v];
+          for (unsigned int d = 0; d < dim; ++d)
+            if (v & (1 << d))
+              expected += vertices[1 << d] - vertices[0];
+          if (expected.norm() > 1e-12 * max_edge_length)
+            return false;
+        }
+      return true;
+    }
+
+
+
+    /**
+     * For cells that are the affine image of the reference cell, this is a
+     * replacement for maybe_update_q_points_Jacobians_and_grads_tensor() and
+     * maybe_update_q_points_Jacobians_generic(): the Jacobian, its inverse
+     * and its determinant are the same at all points and need to be computed
+     * only once, and the quadrature points are obtained by applying the
+     * affine map to the points on the reference cell.
+     */
+    template <int dim, int spacedim>
+    inline void
+    update_q_points_Jacobians_affine(
+      const DerivativeForm<1, dim, spacedim>                       &jacobian,
+      const typename dealii::MappingQ<dim, spacedim>::InternalData &data,
+      const ArrayView<const Point<dim>>                            &unit_points,
+      std::vector<Point<spacedim>>                  &quadrature_points,
+      std::vector<DerivativeForm<1, dim, spacedim>> &jacobians,
+      std::vector<DerivativeForm<1, spacedim, dim>> &inverse_jacobians)
+    {
+      const UpdateFlags  update_flags = data.update_each;
+      const unsigned int n_points     = unit_points.size();
+
+      if (update_flags & update_quadrature_points)
+        {
+          AssertDimension(quadrature_points.size(), n_points);
+          const Point<spacedim> &origin = data.mapping_support_points[0];
+          for (unsigned int point = 0; point < n_points; ++point)
+            quadrature_points[point] =
+              origin + apply_transformation(jacobian, unit_points[point]);
+        }
+
+      // Since MappingQ::InternalData does not have separate arrays for the
+      // covariant and contravariant transformations, but uses the arrays in
+      // the `MappingRelatedData`, it can happen that vectors do not have the
+      // right size
+      if (update_flags & update_contravariant_transformation)
+        {
+          jacobians.resize(n_points);
+          std::fill(jacobians.begin(), jacobians.end(), jacobian);
+        }
+
+      if (update_flags & update_volume_elements)
+        std::fill(data.volume_elements.begin(),
+                  data.volume_elements.end(),
+                  jacobian.determinant());
+
+      if (update_flags & update_covariant_transformation)
+        {
+          inverse_jacobians.resize(n_points);
+          std::fill(inverse_jacobians.begin(),
+                    inverse_jacobians.end(),
+                    jacobian.covariant_form().transpose());
+        }
+    }
+
+
+
     template <int dim, int spacedim>
     inline void
     maybe_update_q_points_Jacobians_generic(
@@ -27,6 +27,7 @@
 
 #include <deal.II/grid/reference_cell.h>
 #include <deal.II/grid/tria.h>
+#include <deal.II/grid/tria_description.h>
 
 #include <array>
 #include <limits>
@@ -301,6 +302,74 @@ namespace GridGenerator
                              const Point<dim>                &p2,
                              const bool                       colorize = false);
 
+  /**
+   * Create the TriangulationDescription::Description of the mesh generated
+   * by the previous function for the current process in @p comm, without
+   * ever building the full mesh.
+   *
+   * The cells of the subdivided hyper rectangle are distributed over the
+   * processes of @p comm by splitting the <code>repetitions[0] x ... x
+   * repetitions[dim-1]</code> grid of cells into a grid of boxes, one per
+   * process, such that each box has about the same number of cells and is as
+   * close to a cube as the prime factorization of the number of processes
+   * allows. The returned object only contains the cells of the box owned by
+   * the current process plus one layer of ghost cells around it, so both the
+   * memory and the time needed to set up the coarse mesh scale with the
+   * number of locally owned cells rather than with the total number of
+   * cells. This makes it possible to create meshes with far more coarse
+   * cells than any single process could hold, for use with
+   * parallel::fullydistributed::Triangulation:
+   * @code
+   * parallel::fullydistributed::Triangulation<dim> tria(comm);
+   * tria.create_triangulation(
+   *   GridGenerator::subdivided_hyper_rectangle_description(repetitions,
+   *                                                          p1,
+   *                                                          p2,
+   *                                                          comm));
+   * @endcode
+   *
+   * The vertex locations, the coarse cell ids (which equal the index a cell
+   * has in the Triangulation generated by the previous function), the
+   * boundary ids and, if @p colorize is set, the material ids are identical
+   * to the ones produced by the previous function.
+   *
+   * If @p settings contains
+   * TriangulationDescription::construct_multigrid_hierarchy, the @p smoothing
+   * argument is extended with the limit_level_difference_at_vertices flag.
+   *
+   * @note Processes that do not get any cells (because the number of
+   * processes in some coordinate direction exceeds the number of cells in
+   * that direction) receive an empty description.
+   */
+  template <int dim, int spacedim = dim>
+  TriangulationDescription::Description<dim, spacedim>
+  subdivided_hyper_rectangle_description(
+    const std::vector<unsigned int> &repetitions,
+    const Point<dim>                &p1,
+    const Point<dim>                &p2,
+    const MPI_Comm                   comm,
+    const bool                       colorize = false,
+    const typename Triangulation<dim, spacedim>::MeshSmoothing smoothing =
+      Triangulation<dim, spacedim>::none,
+    const TriangulationDescription::Settings settings =
+      TriangulationDescription::Settings::default_setting);
+
+  /**
+   * Same as the first subdivided_hyper_rectangle() function, but for a
+   * parallel::fullydistributed::Triangulation. Rather than creating the
+   * whole mesh on every process, the triangulation is created from the
+   * output of subdivided_hyper_rectangle_description(), using the MPI
+   * communicator and the mesh smoothing flags of @p tria.
+   */
+  template <int dim, int spacedim>
+  void
+  subdivided_hyper_rectangle(
+    parallel::fullydistributed::Triangulation<dim, spacedim> &tria,
+    const std::vector<unsigned int>                          &repetitions,
+    const Point<dim>                                         &p1,
+    const Point<dim>                                         &p2,
+    const bool                                                colorize = false);
+
   /**
    * Like the previous function. However, here the second argument does not
    * denote the number of subdivisions in each coordinate direction, but a
@@ -330,10 +330,56 @@ public:
    * When this flag is set to true, the generated vtu file contains the
    * triangulation in a xml section which is ignored by general vtu readers.
    * If this section is absent, an exception is thrown.
+   *
+   * If the file has been written by one process of a distributed
+   * triangulation with GridOutFlags::Vtu::serialize_triangulation_description
+   * set to true, the xml section contains the
+   * TriangulationDescription::Description of the part of the mesh relevant
+   * to that process instead, see read_partitioned_vtu(). Such a file can
+   * only be read if the attached triangulation is a
+   * parallel::fullydistributed::Triangulation, which is then created from
+   * this description.
    */
   void
   read_vtu(std::istream &in);
 
+  /**
+   * Read a mesh that has been written by deal.II on all processes of a
+   * distributed triangulation, one vtu file per process, and create a fully
+   * distributed triangulation from it. An exception is thrown if the attached
+   * triangulation is not a parallel::fullydistributed::Triangulation.
+   *
+   * Each of the files contains the description of the locally relevant part
+   * of the mesh of the process that wrote it. Every process only opens and
+   * parses its own file and creates its part of the triangulation from it,
+   * so neither the global mesh nor any global data structure is ever built
+   * on a single process. The files can be written from any distributed
+   * triangulation, for example a parallel::distributed::Triangulation, as
+   * follows, where the call to GridOut::write_vtu() is collective:
+   * @code
+   * GridOut grid_out;
+   * grid_out.set_flags(GridOutFlags::Vtu(true, true));
+   * std::ofstream out(file_prefix + "_" + std::to_string(rank + 1) + ".vtu");
+   * grid_out.write_vtu(tria, out);
+   * @endcode
+   * Since the files are regular vtu files, they can also be visualized.
+   *
+   * The files follow the same naming convention as the ones read by
+   * read_partitioned_msh():
+   *   - Single processor: {file_prefix}.vtu
+   *   - Multiple processors: {file_prefix}_{rank+1}.vtu
+   *
+   * The triangulation has to be created with as many processes as the files
+   * have been written with.
+   *
+   * @note This function only reads files that have been written by deal.II
+   * itself as shown above, since it relies on the serialized description
+   * embedded in them. Partitioned vtu files (or .pvtu records) created by
+   * other programs contain no such data and can not be read.
+   */
+  void
+  read_partitioned_vtu(const std::string &file_prefix);
+
   /**
    * Read grid data from an unv file as generated by the Salome mesh
    * generator. Numerical data is ignored.
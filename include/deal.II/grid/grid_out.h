@@ -904,14 +904,36 @@ namespace GridOutFlags
    */
   struct Vtu : public DataOutBase::VtkFlags
   {
-    Vtu(const bool serialize_triangulation = false)
+    Vtu(const bool serialize_triangulation             = false,
+        const bool serialize_triangulation_description = false)
       : serialize_triangulation(serialize_triangulation)
+      , serialize_triangulation_description(
+          serialize_triangulation_description)
     {}
 
     /**
      * Add to the vtu file also the serialized triangulation.
      */
     bool serialize_triangulation;
+
+    /**
+     * If serialize_triangulation is set, store the
+     * TriangulationDescription::Description of the part of the mesh that is
+     * relevant to the current process instead of the triangulation itself
+     * for distributed triangulations (i.e.,
+     * parallel::distributed::Triangulation and
+     * parallel::fullydistributed::Triangulation). Such files can be read
+     * with GridIn::read_partitioned_vtu() into a
+     * parallel::fullydistributed::Triangulation. All other triangulations,
+     * including parallel::shared::Triangulation, are not affected by this
+     * flag.
+     *
+     * @note Creating the description requires communication, so if this
+     * flag is set, GridOut::write_vtu() is a collective operation on the
+     * communicator of a distributed triangulation and has to be called on
+     * all of its processes.
+     */
+    bool serialize_triangulation_description;
   };
 } // namespace GridOutFlags
 
@@ -511,8 +511,15 @@ namespace GridTools
    * Mapping::transform_unit_to_real(qpoints[c][0])
    * returns @p points[a].
    *
-   * The algorithm builds an rtree of @p points to sort them spatially, before
-   * attempting to call find_active_cell_around_point().
+   * The algorithm builds an rtree of @p points to sort them spatially, and
+   * assigns each point a first candidate cell whose bounding box contains
+   * it. All points with the same candidate cell are mapped to the reference
+   * cell at once using Mapping::transform_points_real_to_unit_cell(), which
+   * many mappings implement in a vectorized way. Only the points that do not
+   * lie clearly inside their candidate cell are then searched for with
+   * find_active_cell_around_point(). The work for different candidate cells
+   * is independent and executed in parallel using multiple threads; the
+   * result does not depend on the number of threads.
    *
    * @note This function is not implemented for the codimension one case (<tt>spacedim != dim</tt>).
    *
@@ -1967,6 +1974,70 @@ namespace GridTools
                                  Triangulation<dim, spacedim> &triangulation,
                                  const bool group_siblings = true);
 
+  /**
+   * Return the active cells of @p triangulation in the order in which they
+   * are traversed by a Hilbert space filling curve through their centers.
+   * The $i$th entry of the returned vector is the active cell index (see
+   * CellAccessor::active_cell_index()) of the $i$th cell along the curve.
+   *
+   * Neighboring cells along a Hilbert curve are also close to each other in
+   * space, so iterating over cells in this order (or numbering degrees of
+   * freedom in it, see DoFRenumbering::cell_wise()) typically improves
+   * cache locality. In contrast to the Z-order used by
+   * partition_triangulation_zorder(), the curve does not follow the
+   * refinement hierarchy, i.e., it is equally well suited for meshes with
+   * many unstructured coarse cells.
+   *
+   * The integer coordinates of the cell centers and their position on the
+   * curve are computed in parallel using the task-based parallelism of
+   * deal.II; the final sort makes the cost of this function
+   * $O(N \log N)$ in the number $N$ of active cells.
+   *
+   * @note All cells are considered, so @p triangulation must not be a
+   * parallel::distributed::Triangulation or
+   * parallel::fullydistributed::Triangulation object if the result is
+   * supposed to be the same on all processes.
+   */
+  template <int dim, int spacedim>
+  std::vector<unsigned int>
+  compute_active_cell_hilbert_order(
+    const Triangulation<dim, spacedim> &triangulation);
+
+  /**
+   * Partition the active cells of a triangulation by cutting the Hilbert
+   * curve computed by compute_active_cell_hilbert_order() into
+   * @p n_partitions contiguous pieces. After calling this function, the
+   * subdomain ids of all active cells will have values between zero and
+   * @p n_partitions-1.
+   *
+   * Since no graph partitioner is involved, this function does not need
+   * METIS or Zoltan and is much cheaper than partition_triangulation(),
+   * while still producing compact subdomains. In contrast to
+   * partition_triangulation_zorder(), it also supports cell weights.
+   *
+   * @note If the `weight` signal has been attached to the @p triangulation,
+   * then this will be used to balance the sum of the weights of the cells
+   * in each partition rather than the number of cells.
+   */
+  template <int dim, int spacedim>
+  void
+  partition_triangulation_hilbert(const unsigned int            n_partitions,
+                                  Triangulation<dim, spacedim> &triangulation);
+
+  /**
+   * This function performs the same operation as the one above, except that
+   * it takes into consideration a specific set of @p cell_weights.
+   *
+   * @note If the @p cell_weights vector is empty, then no weighting is taken
+   * into consideration. If not then the size of this vector must equal to the
+   * number of active cells in the triangulation.
+   */
+  template <int dim, int spacedim>
+  void
+  partition_triangulation_hilbert(const unsigned int n_partitions,
+                                  const std::vector<unsigned int> &cell_weights,
+                                  Triangulation<dim, spacedim> &triangulation);
+
   /**
    * Partitions the cells of a multigrid hierarchy by assigning level subdomain
    * ids using the "youngest child" rule, that is, each cell in the hierarchy is
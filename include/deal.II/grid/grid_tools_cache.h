@@ -18,8 +18,10 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/array_view.h>
 #include <deal.II/base/enable_observer_pointer.h>
 #include <deal.II/base/exceptions.h>
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/point.h>
 
 #include <deal.II/fe/mapping.h>
@@ -42,6 +44,158 @@ DEAL_II_NAMESPACE_OPEN
 
 namespace GridTools
 {
+  /**
+   * A flat, read-only snapshot of the locally owned active cells of a
+   * Triangulation, as returned by Cache::get_locally_owned_active_cells().
+   *
+   * Looping over Triangulation::active_cell_iterators() walks the level
+   * hierarchy, skipping inactive and (in parallel computations) non-locally
+   * owned cells, and every query on the resulting accessor -- vertex indices,
+   * material id, measure, ... -- goes through several indirections into the
+   * internal data structures of the triangulation. Loops that only need a few
+   * of these properties, such as error estimators or postprocessing steps,
+   * can instead run over the contiguous arrays stored in this object. Entry
+   * <code>i</code> of each array, with <code>0 <= i < n_cells()</code>,
+   * refers to the <code>i</code>th locally owned active cell in the order in
+   * which Triangulation::active_cell_iterators() visits them.
+   *
+   * Since the number of vertices and faces of a cell depends on its reference
+   * cell, vertex indices and boundary ids are stored in compressed form: the
+   * entries belonging to cell <code>i</code> are the ones in the ranges
+   * <code>[vertex_ptr[i], vertex_ptr[i+1])</code> of vertex_indices and
+   * <code>[face_ptr[i], face_ptr[i+1])</code> of face_boundary_ids,
+   * respectively. The functions vertices() and boundary_ids() return these
+   * ranges as ArrayView objects.
+   *
+   * A typical use is a loop that fills a vector indexed by the active cell
+   * index, like the following computation of the cell diameters:
+   * @code
+   *   const auto &cells = cache.get_locally_owned_active_cells();
+   *   Vector<double> h(triangulation.n_active_cells());
+   *   cells.parallel_for([&](const unsigned int i) {
+   *     h[cells.active_cell_indices[i]] =
+   *       std::pow(cells.measures[i], 1. / dim);
+   *   });
+   * @endcode
+   *
+   * The data stored here is only valid as long as the triangulation does not
+   * change. The Cache class rebuilds it whenever the triangulation signals a
+   * change; if vertices are moved by other means, call
+   * Cache::mark_for_update() with ::update_locally_owned_active_cells.
+   */
+  template <int dim, int spacedim = dim>
+  struct LocallyOwnedActiveCells
+  {
+    /**
+     * Return the number of cells stored in this object.
+     */
+    unsigned int
+    n_cells() const;
+
+    /**
+     * Return an iterator to the cell stored at position @p i in @p tria,
+     * which must be the triangulation this object was built from.
+     */
+    typename Triangulation<dim, spacedim>::active_cell_iterator
+    get_cell(const unsigned int                  i,
+             const Triangulation<dim, spacedim> &tria) const;
+
+    /**
+     * Return the global vertex indices of the cell stored at position @p i,
+     * in the order of the vertices of that cell.
+     */
+    ArrayView<const unsigned int>
+    vertices(const unsigned int i) const;
+
+    /**
+     * Return the boundary ids of the faces of the cell stored at position
+     * @p i. Interior faces are reported as
+     * numbers::internal_face_boundary_id.
+     */
+    ArrayView<const types::boundary_id>
+    boundary_ids(const unsigned int i) const;
+
+    /**
+     * Call @p f(i) for every cell position <code>0 <= i < n_cells()</code>,
+     * possibly in parallel on several threads. The function object must
+     * therefore be safe to call concurrently for different values of
+     * <code>i</code>. The argument @p grainsize is passed on to
+     * parallel::apply_to_subranges().
+     */
+    template <typename Function>
+    void
+    parallel_for(const Function &f, const unsigned int grainsize = 256) const;
+
+    /**
+     * Like parallel_for(), but call @p f(begin, end) once for each of the
+     * half-open ranges of cell positions the loop is subdivided into. This
+     * allows the function object to set up scratch data once per range.
+     */
+    template <typename Function>
+    void
+    parallel_for_subranges(const Function    &f,
+                           const unsigned int grainsize = 256) const;
+
+    /**
+     * Return an estimate for the memory consumption, in bytes, of this
+     * object.
+     */
+    std::size_t
+    memory_consumption() const;
+
+    /**
+     * The level of each cell.
+     */
+    std::vector<int> levels;
+
+    /**
+     * The index of each cell within its level.
+     */
+    std::vector<int> indices;
+
+    /**
+     * The active cell index of each cell, see
+     * CellAccessor::active_cell_index(). This is the index to use when
+     * writing into vectors with one entry per active cell.
+     */
+    std::vector<unsigned int> active_cell_indices;
+
+    /**
+     * Offsets into vertex_indices. This array has n_cells()+1 entries.
+     */
+    std::vector<unsigned int> vertex_ptr;
+
+    /**
+     * The global vertex indices of all cells, stored one cell after the
+     * other.
+     */
+    std::vector<unsigned int> vertex_indices;
+
+    /**
+     * Offsets into face_boundary_ids. This array has n_cells()+1 entries.
+     */
+    std::vector<unsigned int> face_ptr;
+
+    /**
+     * The boundary ids of the faces of all cells, stored one cell after the
+     * other.
+     */
+    std::vector<types::boundary_id> face_boundary_ids;
+
+    /**
+     * The material id of each cell.
+     */
+    std::vector<types::material_id> material_ids;
+
+    /**
+     * The measure of each cell, as computed by TriaAccessor::measure() from
+     * the vertex locations stored in the triangulation.
+     */
+    std::vector<double> measures;
+  };
+
+
+
   /**
    * A class that caches computationally intensive information about a
    * Triangulation.
@@ -56,6 +210,15 @@ namespace GridTools
    * changed due to a Triangulation::Signals::any_change() signal being
    * triggered.
    *
+   * For a serial Triangulation, a change caused by
+   * Triangulation::execute_coarsening_and_refinement() does not invalidate
+   * the vertex to cell map, the used vertices and their RTree, and the
+   * RTrees of cell bounding boxes. If these structures have already been
+   * computed, they are instead updated using only the cells that were
+   * refined or coarsened, with a cost proportional to the number of changed
+   * cells rather than to the size of the mesh. All other structures are
+   * recomputed from scratch the next time they are requested.
+   *
    * If the triangulation changes for other reasons, for example because you
    * use it in conjunction with a MappingQEulerian object that sees the
    * vertices through its own transformation, or because you manually change
@@ -178,6 +341,15 @@ namespace GridTools
     const std::map<unsigned int, std::set<types::subdomain_id>> &
     get_vertices_with_ghost_neighbors() const;
 
+    /**
+     * Return the cached flat view of the locally owned active cells of the
+     * triangulation. In serial computations, this contains all active cells.
+     * See the documentation of LocallyOwnedActiveCells for a description of
+     * the data stored and for the parallel loop helpers it offers.
+     */
+    const LocallyOwnedActiveCells<dim, spacedim> &
+    get_locally_owned_active_cells() const;
+
     /**
      * Return a reference to the stored triangulation.
      */
@@ -223,6 +395,23 @@ namespace GridTools
     get_covering_rtree(const unsigned int level = 0) const;
 
   private:
+    /**
+     * Connect the signal slots of this class to the signals of the
+     * triangulation.
+     */
+    void
+    connect_to_triangulation_signals();
+
+    /**
+     * Update the structures that support it after a refinement cycle of a
+     * serial triangulation, using the cells recorded by the signal slots
+     * connected to Triangulation::Signals::pre_coarsening_on_cell and
+     * Triangulation::Signals::post_refinement_on_cell, and mark all other
+     * structures for update.
+     */
+    void
+    update_after_local_refinement();
+
     /**
      * Keep track of what needs to be updated every time the triangulation
      * is changed. Each of the get_*() functions above checks whether a
@@ -329,6 +518,12 @@ namespace GridTools
                        vertices_with_ghost_neighbors;
     mutable std::mutex vertices_with_ghost_neighbors_mutex;
 
+    /**
+     * Store the flat view of the locally owned active cells.
+     */
+    mutable LocallyOwnedActiveCells<dim, spacedim> locally_owned_active_cells;
+    mutable std::mutex locally_owned_active_cells_mutex;
+
     /**
      * Storage for the status of the triangulation change signal.
      */
@@ -338,11 +533,129 @@ namespace GridTools
      * Storage for the status of the triangulation creation signal.
      */
     boost::signals2::connection tria_create_signal;
+
+    /**
+     * Whether the triangulation is currently between the
+     * Triangulation::Signals::pre_refinement and
+     * Triangulation::Signals::post_refinement signals of a refinement cycle
+     * whose effect can be applied incrementally.
+     */
+    bool local_refinement_in_progress;
+
+    /**
+     * The cells refined in the current refinement cycle.
+     */
+    std::vector<typename Triangulation<dim, spacedim>::cell_iterator>
+      refined_cells;
+
+    /**
+     * The cells whose children are removed in the current refinement cycle.
+     */
+    std::vector<typename Triangulation<dim, spacedim>::cell_iterator>
+      coarsened_cells;
+
+    /**
+     * The vertices of the children removed in the current refinement cycle.
+     */
+    std::vector<unsigned int> coarsened_vertices;
+
+    /**
+     * The bounding boxes of the children removed in the current refinement
+     * cycle, computed while these cells still exist.
+     */
+    std::vector<
+      std::pair<BoundingBox<spacedim>,
+                typename Triangulation<dim, spacedim>::cell_iterator>>
+      coarsened_cell_bounding_boxes;
+
+    /**
+     * Storage for the status of the signals used to record the changes of a
+     * refinement cycle.
+     */
+    boost::signals2::connection tria_pre_refinement_signal;
+    boost::signals2::connection tria_pre_coarsening_on_cell_signal;
+    boost::signals2::connection tria_post_refinement_on_cell_signal;
   };
 
 
 
   // Inline functions
+  template <int dim, int spacedim>
+  inline unsigned int
+  LocallyOwnedActiveCells<dim, spacedim>::n_cells() const
+  {
+    return levels.size();
+  }
+
+
+
+  template <int dim, int spacedim>
+  inline typename Triangulation<dim, spacedim>::active_cell_iterator
+  LocallyOwnedActiveCells<dim, spacedim>::get_cell(
+    const unsigned int                  i,
+    const Triangulation<dim, spacedim> &tria) const
+  {
+    AssertIndexRange(i, n_cells());
+    return typename Triangulation<dim, spacedim>::active_cell_iterator(
+      &tria, levels[i], indices[i]);
+  }
+
+
+
+  template <int dim, int spacedim>
+  inline ArrayView<const unsigned int>
+  LocallyOwnedActiveCells<dim, spacedim>::vertices(const unsigned int i) const
+  {
+    AssertIndexRange(i, n_cells());
+    return make_array_view(vertex_indices.data() + vertex_ptr[i],
+                           vertex_indices.data() + vertex_ptr[i + 1]);
+  }
+
+
+
+  template <int dim, int spacedim>
+  inline ArrayView<const types::boundary_id>
+  LocallyOwnedActiveCells<dim, spacedim>::boundary_ids(
+    const unsigned int i) const
+  {
+    AssertIndexRange(i, n_cells());
+    return make_array_view(face_boundary_ids.data() + face_ptr[i],
+                           face_boundary_ids.data() + face_ptr[i + 1]);
+  }
+
+
+
+  template <int dim, int spacedim>
+  template <typename Function>
+  inline void
+  LocallyOwnedActiveCells<dim, spacedim>::parallel_for(
+    const Function    &f,
+    const unsigned int grainsize) const
+  {
+    parallel::apply_to_subranges(
+      0U,
+      n_cells(),
+      [&f](const unsigned int begin, const unsigned int end) {
+        for (unsigned int i = begin; i < end; ++i)
+          f(i);
+      },
+      grainsize);
+  }
+
+
+
+  template <int dim, int spacedim>
+  template <typename Function>
+  inline void
+  LocallyOwnedActiveCells<dim, spacedim>::parallel_for_subranges(
+    const Function    &f,
+    const unsigned int grainsize) const
+  {
+    parallel::apply_to_subranges(0U, n_cells(), f, grainsize);
+  }
+
+
+
   template <int dim, int spacedim>
   inline const Triangulation<dim, spacedim> &
   Cache<dim, spacedim>::get_triangulation() const
@@ -89,6 +89,12 @@ namespace GridTools
      */
     update_vertex_with_ghost_neighbors = 0x200,
 
+    /**
+     * Update the flat view of the locally owned active cells, as returned by
+     * Cache::get_locally_owned_active_cells().
+     */
+    update_locally_owned_active_cells = 0x400,
+
     /**
      * Update all objects.
      */
@@ -20,11 +20,15 @@
 
 #include <deal.II/base/function.h>
 #include <deal.II/base/function_parser.h>
+#include <deal.II/base/mutex.h>
 
 #include <deal.II/grid/manifold.h>
 
 #include <boost/signals2/connection.hpp>
 
+#include <array>
+#include <unordered_map>
+
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -1053,6 +1057,28 @@ private:
  * current implementation by a pre-identification of relevant cells with
  * axis-aligned bounding boxes.
  *
+ * The most expensive part of computing new points is the inversion of the
+ * transfinite interpolation of the surrounding points by a Newton-like
+ * iteration. Since a vertex or a mapping support point is typically
+ * surrounded by several lines, faces, and cells, the same points are pulled
+ * back many times during mesh refinement or when computing the support points
+ * of MappingQ. This class therefore caches the chart points of all points
+ * pulled back so far, such that the inversion only needs to be done once per
+ * point. Each coarse cell has its own cache, and coarse cells for which the
+ * inversion is cheap because all surrounding manifolds are flat are not
+ * cached at all. The number of cached points is bounded by an argument of
+ * the constructor, and the cache is emptied when initialize() is called
+ * again. On cached cells, the inversion always starts from an initial guess
+ * that only depends on the point, so a cached chart point is bitwise
+ * identical to the one a new inversion would compute, and the new points do
+ * not depend on the state of the cache or on the order in which several
+ * threads access it. The cache is also emptied when the triangulation
+ * signals a movement of its vertices (Triangulation::Signals::mesh_movement,
+ * e.g. in GridTools::transform()). Since the vertices might also be moved
+ * without this signal, a cached chart point is only used after checking by
+ * one evaluation of the transfinite interpolation, which is much cheaper than
+ * the inversion, that it still maps to the given point.
+ *
  * @ingroup manifold
  */
 template <int dim, int spacedim = dim>
@@ -1064,6 +1090,15 @@ public:
    */
   TransfiniteInterpolationManifold();
 
+  /**
+   * Constructor. The argument @p max_cached_chart_points bounds the total
+   * number of points whose chart points are cached, see the class
+   * documentation. The bound is distributed evenly among the coarse cells.
+   * A value of zero disables the cache.
+   */
+  explicit TransfiniteInterpolationManifold(
+    const unsigned int max_cached_chart_points);
+
   /**
    * Destructor.
    */
@@ -1214,6 +1249,32 @@ private:
     const Point<dim>                                           &chart_point,
     const Point<spacedim> &pushed_forward_chart_point) const;
 
+  /**
+   * Return whether the chart points of the coarse cell with index
+   * @p cell_index are cached.
+   */
+  bool
+  uses_chart_point_cache(const unsigned int cell_index) const;
+
+  /**
+   * Look up the chart point of the point @p p on the coarse cell with index
+   * @p cell_index in the cache of chart points. If the point is found, it is
+   * written into @p chart_point and @p true is returned.
+   */
+  bool
+  find_cached_chart_point(const unsigned int     cell_index,
+                          const Point<spacedim> &p,
+                          Point<dim>            &chart_point) const;
+
+  /**
+   * Store the chart point of the point @p p on the coarse cell with index @p
+   * cell_index in the cache of chart points.
+   */
+  void
+  cache_chart_point(const unsigned int     cell_index,
+                    const Point<spacedim> &p,
+                    const Point<dim>      &chart_point) const;
+
   /**
    * The underlying triangulation.
    */
@@ -1251,6 +1312,58 @@ private:
    * this class goes out of scope.
    */
   boost::signals2::connection clear_signal;
+
+  /**
+   * The connection to Triangulation::signals::mesh_movement that empties
+   * the caches of chart points once the vertices have been moved.
+   */
+  boost::signals2::connection mesh_movement_signal;
+
+  /**
+   * The cache of chart points of one coarse cell, indexed by the coordinates
+   * of the points in real space, along with a mutex that guards it. Since
+   * every coarse cell has its own cache, threads working on different parts
+   * of the mesh do not wait for each other.
+   */
+  struct ChartPointCache
+  {
+    /**
+     * Hash function for the coordinates of a point.
+     */
+    struct Hash
+    {
+      std::size_t
+      operator()(const std::array<double, spacedim> &coordinates) const
+      {
+        std::size_t hash = 0;
+        for (const double x : coordinates)
+          hash ^= std::hash<double>()(x) + 0x9e3779b9 + (hash << 6) +
+                  (hash >> 2);
+        return hash;
+      }
+    };
+
+    std::unordered_map<std::array<double, spacedim>, Point<dim>, Hash>
+      chart_points;
+
+    Threads::Mutex mutex;
+  };
+
+  /**
+   * The caches of chart points, one for each coarse cell.
+   */
+  mutable std::vector<ChartPointCache> chart_point_caches;
+
+  /**
+   * The maximal number of cached chart points over all coarse cells, as
+   * given to the constructor.
+   */
+  const unsigned int max_cached_chart_points;
+
+  /**
+   * The maximal number of cached chart points of a single coarse cell.
+   */
+  unsigned int max_cached_chart_points_per_cell;
 };
 
 /*----------------------------- inline functions -----------------------------*/
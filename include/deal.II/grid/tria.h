@@ -2189,6 +2189,17 @@ public:
    * @note This function is <tt>virtual</tt> to allow derived classes to
    * insert hooks, such as saving refinement flags and the like (see e.g. the
    * PersistentTriangulation class).
+   *
+   * @note Most of the work of this function uses multiple threads. In
+   * particular, the new vertices, lines, faces, and cells of isotropic
+   * refinement are created in two phases: the slots for the new objects are
+   * first given out sequentially, in the order in which the objects would
+   * have been created one after the other, and the new objects are then
+   * filled in, and the locations of new vertices computed, in parallel. As
+   * a consequence, the numbering of cells, faces, and vertices does not
+   * depend on the number of threads, but the Manifold objects attached to
+   * the triangulation have to be safe to be called from several threads at
+   * once. Anisotropic refinement and refinement in 1d remain sequential.
    */
   virtual void
   execute_coarsening_and_refinement();
@@ -2221,6 +2232,11 @@ public:
    *
    * This function uses the user flags, so store them if you still need them
    * afterwards.
+   *
+   * @note Limiting the level difference at vertices, and ensuring that no
+   * face is refined twice if all refinement flags are isotropic, use
+   * multiple threads. The flags computed are the same as if the cells had
+   * been visited one after the other.
    */
   virtual bool
   prepare_coarsening_and_refinement();
@@ -2744,7 +2760,8 @@ public:
 
   /**
    * Clear all user pointers and indices and allow the use of both for next
-   * access.  See also
+   * access. This also releases the memory used for storing user data until
+   * user data is set again. See also
    * @ref GlossUserData.
    */
   void
@@ -3614,12 +3631,23 @@ public:
    *
    * Save the triangulation into the given file. Internally, this
    * function calls the save function which uses BOOST archives.
+   *
+   * The mesh is written into a binary archive, which is considerably
+   * smaller and faster to write and read than a text archive for large
+   * meshes. As a consequence, the files can only be read back on machines
+   * with the same binary representation of integers and floating point
+   * numbers as the one that wrote them. To this end, the file stores the
+   * version of its format as well as the byte order and the sizes of the
+   * fundamental types of the machine that wrote it, and load() throws an
+   * exception if they do not match.
    */
   virtual void
   save(const std::string &file_basename) const;
 
   /**
-   * Load the triangulation saved with save() back in.
+   * Load the triangulation saved with save() back in. Files written in the
+   * text format used by previous versions of this library can still be
+   * read.
    */
   virtual void
   load(const std::string &file_basename);
@@ -6052,7 +6052,9 @@ void
 TriaAccessor<structdim, dim, spacedim>::clear_user_pointer() const
 {
   Assert(this->used(), TriaAccessorExceptions::ExcCellNotUsed());
-  this->objects().user_pointer(this->present_index) = nullptr;
+  // without allocated user data, all user pointers are already null
+  if (this->objects().user_data_is_allocated())
+    this->objects().user_pointer(this->present_index) = nullptr;
 }
 
 
@@ -6062,7 +6064,7 @@ void *
 TriaAccessor<structdim, dim, spacedim>::user_pointer() const
 {
   Assert(this->used(), TriaAccessorExceptions::ExcCellNotUsed());
-  return this->objects().user_pointer(this->present_index);
+  return std::as_const(this->objects()).user_pointer(this->present_index);
 }
 
 
@@ -6110,7 +6112,9 @@ void
 TriaAccessor<structdim, dim, spacedim>::clear_user_index() const
 {
   Assert(this->used(), TriaAccessorExceptions::ExcCellNotUsed());
-  this->objects().user_index(this->present_index) = 0;
+  // without allocated user data, all user indices are already zero
+  if (this->objects().user_data_is_allocated())
+    this->objects().user_index(this->present_index) = 0;
 }
 
 
@@ -6120,7 +6124,7 @@ unsigned int
 TriaAccessor<structdim, dim, spacedim>::user_index() const
 {
   Assert(this->used(), TriaAccessorExceptions::ExcCellNotUsed());
-  return this->objects().user_index(this->present_index);
+  return std::as_const(this->objects()).user_index(this->present_index);
 }
 
 
@@ -20,7 +20,9 @@
 #include <deal.II/base/array_view.h>
 #include <deal.II/base/exceptions.h>
 #include <deal.II/base/geometry_info.h>
+#include <deal.II/base/mutex.h>
 
+#include <atomic>
 #include <vector>
 
 DEAL_II_NAMESPACE_OPEN
@@ -224,25 +226,33 @@ namespace internal
                     const unsigned int                  level);
 
       /**
-       * Access to user pointers.
+       * Access to user pointers. If no user data has been set on any of the
+       * objects stored here so far, this function allocates the memory for
+       * it. The allocation is thread-safe, i.e., this function may be called
+       * concurrently for different objects @p i.
        */
       void *&
       user_pointer(const unsigned int i);
 
       /**
-       * Read-only access to user pointers.
+       * Read-only access to user pointers. Return a null pointer if no user
+       * data has been allocated.
        */
-      const void *
+      void *
       user_pointer(const unsigned int i) const;
 
       /**
-       * Access to user indices.
+       * Access to user indices. If no user data has been set on any of the
+       * objects stored here so far, this function allocates the memory for
+       * it. The allocation is thread-safe, i.e., this function may be called
+       * concurrently for different objects @p i.
        */
       unsigned int &
       user_index(const unsigned int i);
 
       /**
-       * Read-only access to user pointers.
+       * Read-only access to user indices. Return zero if no user data has
+       * been allocated.
        */
       unsigned int
       user_index(const unsigned int i) const;
@@ -255,11 +265,26 @@ namespace internal
 
       /**
        * Clear all user pointers or indices and reset their type, such that
-       * the next access may be either or.
+       * the next access may be either or. This also releases the memory
+       * allocated for user data.
        */
       void
       clear_user_data();
 
+      /**
+       * Return whether the memory for user data has been allocated.
+       */
+      bool
+      user_data_is_allocated() const;
+
+      /**
+       * Allocate the memory for user data, with one zero-initialized entry
+       * per object, unless that has already happened. This function may be
+       * called concurrently from several threads.
+       */
+      void
+      allocate_user_data();
+
       /**
        * Clear all user flags.
        */
@@ -356,6 +381,10 @@ namespace internal
       /**
        * Pointer which is not used by the library but may be accessed and set
        * by the user to handle data local to a line/quad/etc.
+       *
+       * Since most programs do not use user data, this vector is only
+       * allocated (with one entry per object) when user data is first set
+       * on one of the objects, and is empty otherwise.
        */
       std::vector<UserData> user_data;
 
@@ -365,6 +394,35 @@ namespace internal
        * access will not be allowed to change the type of data accessed.
        */
       mutable UserDataType user_data_type;
+
+      /**
+       * A flag indicating whether @p user_data has been allocated, along with
+       * a mutex that guards the allocation. Several threads may set user
+       * data on different objects at the same time, so the first of them
+       * allocates the memory under the lock while the others wait for it,
+       * and readers only look at @p user_data once the flag has been set.
+       *
+       * Copying an object of this type copies the state of the flag and
+       * creates a new mutex.
+       */
+      struct UserDataAllocation
+      {
+        UserDataAllocation();
+
+        UserDataAllocation(const UserDataAllocation &other);
+
+        UserDataAllocation &
+        operator=(const UserDataAllocation &other);
+
+        std::atomic<bool> is_allocated;
+
+        Threads::Mutex mutex;
+      };
+
+      /**
+       * The allocation state of @p user_data.
+       */
+      UserDataAllocation user_data_allocation;
     };
 
 
@@ -434,20 +492,22 @@ namespace internal
              ExcPointerIndexClash());
       user_data_type = data_pointer;
 
-      AssertIndexRange(i, user_data.size());
+      AssertIndexRange(i, n_objects());
+      if (user_data_is_allocated() == false)
+        allocate_user_data();
       return user_data[i].p;
     }
 
 
-    inline const void *
+    inline void *
     TriaObjects::user_pointer(const unsigned int i) const
     {
       Assert(user_data_type == data_unknown || user_data_type == data_pointer,
              ExcPointerIndexClash());
       user_data_type = data_pointer;
 
-      AssertIndexRange(i, user_data.size());
-      return user_data[i].p;
+      AssertIndexRange(i, n_objects());
+      return user_data_is_allocated() ? user_data[i].p : nullptr;
     }
 
 
@@ -458,7 +518,9 @@ namespace internal
              ExcPointerIndexClash());
       user_data_type = data_index;
 
-      AssertIndexRange(i, user_data.size());
+      AssertIndexRange(i, n_objects());
+      if (user_data_is_allocated() == false)
+        allocate_user_data();
       return user_data[i].i;
     }
 
@@ -466,8 +528,39 @@ namespace internal
     inline void
     TriaObjects::clear_user_data(const unsigned int i)
     {
-      AssertIndexRange(i, user_data.size());
-      user_data[i].i = 0;
+      AssertIndexRange(i, n_objects());
+      if (user_data_is_allocated())
+        user_data[i].i = 0;
+    }
+
+
+
+    inline bool
+    TriaObjects::user_data_is_allocated() const
+    {
+      return user_data_allocation.is_allocated.load(std::memory_order_acquire);
+    }
+
+
+
+    inline TriaObjects::UserDataAllocation::UserDataAllocation()
+      : is_allocated(false)
+    {}
+
+
+
+    inline TriaObjects::UserDataAllocation::UserDataAllocation(
+      const UserDataAllocation &other)
+      : is_allocated(other.is_allocated.load())
+    {}
+
+
+
+    inline TriaObjects::UserDataAllocation &
+    TriaObjects::UserDataAllocation::operator=(const UserDataAllocation &other)
+    {
+      is_allocated = other.is_allocated.load();
+      return *this;
     }
 
 
@@ -496,8 +589,8 @@ namespace internal
              ExcPointerIndexClash());
       user_data_type = data_index;
 
-      AssertIndexRange(i, user_data.size());
-      return user_data[i].i;
+      AssertIndexRange(i, n_objects());
+      return user_data_is_allocated() ? user_data[i].i : 0;
     }
 
 
@@ -505,8 +598,8 @@ namespace internal
     TriaObjects::clear_user_data()
     {
       user_data_type = data_unknown;
-      for (auto &data : user_data)
-        data.p = nullptr;
+      std::vector<UserData>().swap(user_data);
+      user_data_allocation.is_allocated = false;
     }
 
 
@@ -540,6 +633,9 @@ namespace internal
       ar                                   &manifold_id;
       ar &next_free_single &next_free_pair &reverse_order_next_free_single;
       ar &user_data                        &user_data_type;
+
+      if (Archive::is_loading::value)
+        user_data_allocation.is_allocated = (user_data.empty() == false);
     }
 
 
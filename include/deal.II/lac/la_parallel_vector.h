@@ -21,6 +21,7 @@
 #include <deal.II/base/enable_observer_pointer.h>
 #include <deal.II/base/memory_space.h>
 #include <deal.II/base/memory_space_data.h>
+#include <deal.II/base/mpi.h>
 #include <deal.II/base/mpi_stub.h>
 #include <deal.II/base/numbers.h>
 #include <deal.II/base/parallel.h>
@@ -59,6 +60,17 @@ namespace LinearAlgebra
   class ReadWriteVector;
 } // namespace LinearAlgebra
 
+namespace internal
+{
+  namespace MatrixFreeFunctions
+  {
+    namespace VectorDataExchange
+    {
+      class Full;
+    }
+  } // namespace MatrixFreeFunctions
+} // namespace internal
+
 #  ifdef DEAL_II_WITH_PETSC
 namespace PETScWrappers
 {
@@ -251,6 +263,24 @@ namespace LinearAlgebra
      *   MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL,
      *                       &comm_sm);
      * @endcode
+     *
+     * If the vector is set up via reinit() with a partitioner and all
+     * processes of @p comm_sm are also part of the communicator of the
+     * partitioner, update_ghost_values() and compress() with
+     * VectorOperation::add make use of the shared-memory segment for the
+     * data exchange within the shared-memory domain (for Number types
+     * `double` and `float`): Ghost values owned by a process in the same
+     * shared-memory domain are read directly from the memory of that process
+     * and ghost contributions are accumulated directly into the locally owned
+     * entries of the owner, such that MPI messages are only sent to processes
+     * outside the shared-memory domain. In order to guarantee consistent
+     * data, update_ghost_values_finish() and compress_finish() then wait
+     * until the processes in @p comm_sm that access the memory of the
+     * current process are done; this synchronization uses point-to-point
+     * messages with the neighbors only and is not collective on @p comm_sm.
+     * The setup of the data structures for this
+     * exchange requires global communication; vectors initialized with
+     * reinit() from another vector share these data structures.
      */
     template <typename Number, typename MemorySpace = MemorySpace::Host>
     class Vector : public ::dealii::ReadVector<Number>
@@ -688,6 +718,33 @@ namespace LinearAlgebra
       bool
       has_ghost_elements() const;
 
+      /**
+       * Select whether update_ghost_values() sends the ghost values to other
+       * processes in single precision rather than in the precision of the
+       * vector. This halves the amount of data sent over the network for
+       * vectors of type <tt>double</tt>, at the cost of ghost values that
+       * are only accurate to single precision and thus differ from the values
+       * on the owning process. This is typically acceptable in the
+       * application of preconditioners, e.g., on the levels of a multigrid
+       * hierarchy. The data sent by compress() is not affected. The setting
+       * has no effect for vectors that exchange data through a shared-memory
+       * communicator, see the general documentation of this class.
+       *
+       * The setting is kept when the vector is reinitialized and is copied
+       * by reinit() from another vector. It is only available for vectors of
+       * type <tt>double</tt> in host memory.
+       */
+      void
+      set_ghost_exchange_precision(const bool reduced_precision);
+
+      /**
+       * Return the number of bytes that the calling process has not needed
+       * to send in update_ghost_values() so far because of the reduced
+       * precision selected by set_ghost_exchange_precision().
+       */
+      std::size_t
+      n_bytes_saved_in_ghost_exchange() const;
+
       /**
        * This method copies the data in the locally owned range from another
        * distributed vector @p src into the calling vector. As opposed to
@@ -880,6 +937,50 @@ namespace LinearAlgebra
                   const Vector<Number, MemorySpace> &V,
                   const Vector<Number, MemorySpace> &W);
 
+      /**
+       * Like operator*(), but only start the global reduction and return
+       * immediately. The result is obtained by calling Future::get() on the
+       * returned object, which waits for the reduction to complete. In
+       * between, the caller can do other work such as the next matrix-vector
+       * product, overlapping it with the latency of the communication.
+       *
+       * The local part of the computation is done before this function
+       * returns, so the vectors may be modified afterwards. Like all
+       * non-blocking collective operations, this function must be called in
+       * the same order on all processes of the communicator, interleaved in
+       * the same way with other collective operations on this vector's
+       * communicator.
+       */
+      Utilities::MPI::Future<Number>
+      inner_product_async(const Vector<Number, MemorySpace> &V) const;
+
+      /**
+       * Like l2_norm(), but only start the global reduction and return a
+       * Future object from which the result can be obtained later. See
+       * inner_product_async() for details.
+       */
+      Utilities::MPI::Future<real_type>
+      l2_norm_async() const;
+
+      /**
+       * Like mean_value(), but only start the global reduction and return a
+       * Future object from which the result can be obtained later. See
+       * inner_product_async() for details.
+       */
+      Utilities::MPI::Future<Number>
+      mean_value_async() const;
+
+      /**
+       * Like add_and_dot(), but only start the global reduction of the inner
+       * product and return a Future object from which the result can be
+       * obtained later. The vector update is complete when this function
+       * returns. See inner_product_async() for details.
+       */
+      Utilities::MPI::Future<Number>
+      add_and_dot_async(const Number                       a,
+                        const Vector<Number, MemorySpace> &V,
+                        const Vector<Number, MemorySpace> &W);
+
       /**
        * Return the global size of the vector, equal to the sum of the number of
        * locally owned indices among all processors.
@@ -1407,22 +1508,68 @@ namespace LinearAlgebra
        */
       mutable bool vector_is_ghosted;
 
+      /**
+       * Whether update_ghost_values() sends the ghost values in single
+       * precision, see set_ghost_exchange_precision().
+       */
+      bool reduced_precision_ghost_exchange = false;
+
+      /**
+       * Storage for the data sent and received in single precision by
+       * update_ghost_values(), with the n_import_indices() entries to be sent
+       * followed by the n_ghost_indices() entries to be received.
+       */
+      mutable std::vector<float> reduced_precision_buffer;
+
+      /**
+       * The number of bytes not sent because of the reduced precision, see
+       * n_bytes_saved_in_ghost_exchange().
+       */
+      mutable std::size_t n_bytes_saved_by_reduced_precision = 0;
+
 #ifdef DEAL_II_WITH_MPI
       /**
-       * A vector that collects all requests from compress() operations.
-       * This class uses persistent MPI communicators, i.e., the communication
-       * channels are stored during successive calls to a given function. This
-       * reduces the overhead involved with setting up the MPI machinery, but
-       * it does not remove the need for a receive operation to be posted
-       * before the data can actually be sent.
+       * A vector that collects all requests from compress() operations that
+       * are currently in flight.
        */
       std::vector<MPI_Request> compress_requests;
 
       /**
        * A vector that collects all requests from update_ghost_values()
-       * operations. This class uses persistent MPI communicators.
+       * operations that are currently in flight.
        */
       mutable std::vector<MPI_Request> update_ghost_values_requests;
+
+      /**
+       * For vectors in host memory, compress() uses persistent MPI requests,
+       * i.e., the communication channels are set up once with
+       * MPI_Send_init() and MPI_Recv_init() and only restarted in successive
+       * calls. This reduces the overhead involved with setting up the MPI
+       * machinery, but it does not remove the need for a receive operation to
+       * be posted before the data can actually be sent. While the
+       * communication is in flight, the requests are moved to @p
+       * compress_requests.
+       */
+      std::vector<MPI_Request> compress_persistent_requests;
+
+      /**
+       * The communication channel the @p compress_persistent_requests have
+       * been set up for.
+       */
+      unsigned int compress_persistent_channel = numbers::invalid_unsigned_int;
+
+      /**
+       * Persistent MPI requests of update_ghost_values() for vectors in host
+       * memory, see @p compress_persistent_requests.
+       */
+      mutable std::vector<MPI_Request> update_ghost_values_persistent_requests;
+
+      /**
+       * The communication channel the persistent requests of
+       * update_ghost_values() have been set up for.
+       */
+      mutable unsigned int update_ghost_values_persistent_channel =
+        numbers::invalid_unsigned_int;
 #endif
 
       /**
@@ -1439,9 +1586,22 @@ namespace LinearAlgebra
        */
       MPI_Comm comm_sm;
 
+#ifdef DEAL_II_WITH_MPI
       /**
-       * A helper function that clears the compress_requests and
-       * update_ghost_values_requests field. Used in reinit() functions.
+       * Object that performs the data exchange in update_ghost_values() and
+       * compress() by directly accessing the shared-memory segments of the
+       * processes in `comm_sm`. Only set up if `comm_sm` is different from
+       * MPI_COMM_SELF, see the general documentation of this class.
+       */
+      std::shared_ptr<
+        const ::dealii::internal::MatrixFreeFunctions::VectorDataExchange::Full>
+        sm_exchanger;
+#endif
+
+      /**
+       * A helper function that frees the compress_requests and
+       * update_ghost_values_requests fields as well as the persistent
+       * requests. Used in reinit() functions.
        */
       void
       clear_mpi_requests();
@@ -1477,6 +1637,15 @@ namespace LinearAlgebra
 
 
 
+    template <typename Number, typename MemorySpace>
+    inline std::size_t
+    Vector<Number, MemorySpace>::n_bytes_saved_in_ghost_exchange() const
+    {
+      return n_bytes_saved_by_reduced_precision;
+    }
+
+
+
     template <typename Number, typename MemorySpace>
     inline typename Vector<Number, MemorySpace>::size_type
     Vector<Number, MemorySpace>::size() const
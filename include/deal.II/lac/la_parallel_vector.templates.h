@@ -19,6 +19,7 @@
 #include <deal.II/base/config.h>
 
 #include <deal.II/base/mpi.h>
+#include <deal.II/base/mpi_tags.h>
 
 #include <deal.II/lac/exceptions.h>
 #include <deal.II/lac/la_parallel_vector.h>
@@ -27,6 +28,8 @@
 #include <deal.II/lac/trilinos_vector.h>
 #include <deal.II/lac/vector_operations_internal.h>
 
+#include <deal.II/matrix_free/vector_data_exchange.h>
+
 #include <Kokkos_Core.hpp>
 
 #include <memory>
@@ -81,6 +84,145 @@ namespace LinearAlgebra
 
 
 
+      // The shared-memory data exchange is only available for vectors in
+      // host memory with the number types supported by
+      // MatrixFreeFunctions::VectorDataExchange::Full.
+      template <typename Number, typename MemorySpaceType>
+      constexpr bool supports_sm_exchange =
+        std::is_same_v<MemorySpaceType, ::dealii::MemorySpace::Host> &&
+        (std::is_same_v<Number, double> || std::is_same_v<Number, float>);
+
+
+
+      // Sending ghost values in single precision is only possible for
+      // vectors of doubles in host memory.
+      template <typename Number, typename MemorySpaceType>
+      constexpr bool supports_reduced_precision_exchange =
+        std::is_same_v<MemorySpaceType, ::dealii::MemorySpace::Host> &&
+        std::is_same_v<Number, double>;
+
+
+
+      // Set up the object for the data exchange via the shared-memory
+      // segments of the processes in comm_sm. This is only possible if all
+      // processes of comm_sm are also part of the communicator of the
+      // partitioner. The decision is made consistently among all processes
+      // of the latter communicator, since the setup is collective on it.
+      inline std::shared_ptr<
+        const ::dealii::internal::MatrixFreeFunctions::VectorDataExchange::Full>
+      create_sm_exchanger(
+        const std::shared_ptr<const Utilities::MPI::Partitioner> &partitioner,
+        const MPI_Comm                                            comm_sm)
+      {
+#ifdef DEAL_II_WITH_MPI
+        if (comm_sm == MPI_COMM_SELF ||
+            Utilities::MPI::job_supports_mpi() == false)
+          return nullptr;
+
+        const MPI_Comm comm = partitioner->get_mpi_communicator();
+
+        MPI_Group group, group_sm;
+        int       ierr = MPI_Comm_group(comm, &group);
+        AssertThrowMPI(ierr);
+        ierr = MPI_Comm_group(comm_sm, &group_sm);
+        AssertThrowMPI(ierr);
+
+        const unsigned int size_sm = Utilities::MPI::n_mpi_processes(comm_sm);
+        std::vector<int>   ranks_sm(size_sm), ranks(size_sm);
+        for (unsigned int i = 0; i < size_sm; ++i)
+          ranks_sm[i] = i;
+        ierr = MPI_Group_translate_ranks(
+          group_sm, size_sm, ranks_sm.data(), group, ranks.data());
+        AssertThrowMPI(ierr);
+
+        ierr = MPI_Group_free(&group_sm);
+        AssertThrowMPI(ierr);
+        ierr = MPI_Group_free(&group);
+        AssertThrowMPI(ierr);
+
+        const unsigned int is_subset =
+          std::find(ranks.begin(), ranks.end(), MPI_UNDEFINED) == ranks.end();
+
+        if (Utilities::MPI::min(is_subset, comm) == 0)
+          return nullptr;
+
+        return std::make_shared<
+          const ::dealii::internal::MatrixFreeFunctions::VectorDataExchange::
+            Full>(partitioner, comm_sm);
+#else
+        (void)partitioner;
+        (void)comm_sm;
+        return nullptr;
+#endif
+      }
+
+
+
+#ifdef DEAL_II_WITH_MPI
+      // Free all requests in the given list and clear it.
+      inline void
+      free_mpi_requests(std::vector<MPI_Request> &requests)
+      {
+        for (auto &request : requests)
+          {
+            const int ierr = MPI_Request_free(&request);
+            AssertThrowMPI(ierr);
+          }
+        requests.clear();
+      }
+
+
+
+      // Complete an exchange via shared memory: Notify the processes in
+      // ranks_done_with that this process does not access their memory any
+      // more and wait until the processes in ranks_to_wait_for do not access
+      // the memory of this process any more. In contrast to a barrier on
+      // comm_sm, a process thus only waits for the processes it actually
+      // shares data with.
+      inline void
+      finish_sm_exchange(const std::vector<unsigned int> &ranks_done_with,
+                         const std::vector<unsigned int> &ranks_to_wait_for,
+                         const MPI_Comm                   comm_sm,
+                         const int                        tag,
+                         std::vector<MPI_Request>        &requests)
+      {
+        requests.resize(ranks_done_with.size() + ranks_to_wait_for.size());
+
+        for (unsigned int i = 0; i < ranks_done_with.size(); ++i)
+          {
+            const int ierr = MPI_Isend(nullptr,
+                                       0,
+                                       MPI_BYTE,
+                                       ranks_done_with[i],
+                                       tag,
+                                       comm_sm,
+                                       requests.data() + i);
+            AssertThrowMPI(ierr);
+          }
+
+        for (unsigned int i = 0; i < ranks_to_wait_for.size(); ++i)
+          {
+            const int ierr =
+              MPI_Irecv(nullptr,
+                        0,
+                        MPI_BYTE,
+                        ranks_to_wait_for[i],
+                        tag,
+                        comm_sm,
+                        requests.data() + ranks_done_with.size() + i);
+            AssertThrowMPI(ierr);
+          }
+
+        const int ierr =
+          MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+        AssertThrowMPI(ierr);
+
+        requests.clear();
+      }
+#endif
+
+
+
       // Resize the underlying array on the host or on the device
       template <typename Number, typename MemorySpaceType>
       struct la_parallel_vector_templates_functions
@@ -500,6 +642,39 @@ namespace LinearAlgebra
             Kokkos::Max<RealType, Kokkos::HostSpace>(result));
         }
       };
+
+
+
+      /**
+       * Start the global sum of @p local_result over all processes of the
+       * partitioner's communicator and return a Future object whose result
+       * is obtained by applying @p post_process to the sum. If there is
+       * only one process, no communication is started.
+       */
+      template <typename ResultType, typename T, typename PostProcess>
+      Utilities::MPI::Future<ResultType>
+      start_global_sum(const T                           &local_result,
+                       const Utilities::MPI::Partitioner &partitioner,
+                       const PostProcess                 &post_process)
+      {
+        if (partitioner.n_mpi_processes() == 1)
+          {
+            const ResultType result = post_process(local_result);
+            return Utilities::MPI::Future<ResultType>([]() {},
+                                                      [result]() {
+                                                        return result;
+                                                      });
+          }
+
+        // Future objects are not copyable, so share the one of the
+        // reduction between the two functions of the returned object
+        const auto sum = std::make_shared<Utilities::MPI::Future<T>>(
+          Utilities::MPI::isum(local_result,
+                               partitioner.get_mpi_communicator()));
+        return Utilities::MPI::Future<ResultType>(
+          [sum]() { sum->wait(); },
+          [sum, post_process]() { return post_process(sum->get()); });
+      }
     } // namespace internal
 
 
@@ -508,18 +683,10 @@ namespace LinearAlgebra
     Vector<Number, MemorySpaceType>::clear_mpi_requests()
     {
 #ifdef DEAL_II_WITH_MPI
-      for (auto &compress_request : compress_requests)
-        {
-          const int ierr = MPI_Request_free(&compress_request);
-          AssertThrowMPI(ierr);
-        }
-      compress_requests.clear();
-      for (auto &update_ghost_values_request : update_ghost_values_requests)
-        {
-          const int ierr = MPI_Request_free(&update_ghost_values_request);
-          AssertThrowMPI(ierr);
-        }
-      update_ghost_values_requests.clear();
+      internal::free_mpi_requests(compress_requests);
+      internal::free_mpi_requests(update_ghost_values_requests);
+      internal::free_mpi_requests(compress_persistent_requests);
+      internal::free_mpi_requests(update_ghost_values_persistent_requests);
 #endif
     }
 
@@ -560,6 +727,10 @@ namespace LinearAlgebra
       // set partitioner to serial version
       partitioner = std::make_shared<Utilities::MPI::Partitioner>(size);
 
+#ifdef DEAL_II_WITH_MPI
+      sm_exchanger.reset();
+#endif
+
       // set entries to zero if so requested
       if (omit_zeroing_entries == false)
         this->operator=(Number());
@@ -593,6 +764,10 @@ namespace LinearAlgebra
                                                                   ghost_size,
                                                                   comm);
 
+#ifdef DEAL_II_WITH_MPI
+      sm_exchanger.reset();
+#endif
+
       this->operator=(Number());
     }
 
@@ -608,20 +783,28 @@ namespace LinearAlgebra
       clear_mpi_requests();
       Assert(v.partitioner.get() != nullptr, ExcNotInitialized());
 
-      this->comm_sm = v.comm_sm;
+      const bool comm_sm_changed = (this->comm_sm != v.comm_sm);
+      this->comm_sm              = v.comm_sm;
 
       // check whether the partitioners are
       // different (check only if the are allocated
       // differently, not if the actual data is
-      // different)
-      if (partitioner.get() != v.partitioner.get())
+      // different). The shared-memory segments and the data exchange over
+      // them also depend on the shared-memory communicator.
+      if (partitioner.get() != v.partitioner.get() || comm_sm_changed)
         {
           partitioner = v.partitioner;
           const size_type new_allocated_size =
             partitioner->locally_owned_size() + partitioner->n_ghost_indices();
           resize_val(new_allocated_size, this->comm_sm);
+
+#ifdef DEAL_II_WITH_MPI
+          sm_exchanger = v.sm_exchanger;
+#endif
         }
 
+      reduced_precision_ghost_exchange = v.reduced_precision_ghost_exchange;
+
       if (omit_zeroing_entries == false)
         this->operator=(Number());
       else
@@ -675,15 +858,25 @@ namespace LinearAlgebra
     {
       clear_mpi_requests();
 
-      this->comm_sm = comm_sm;
+      const bool comm_sm_changed = (this->comm_sm != comm_sm);
+      this->comm_sm              = comm_sm;
 
-      // set vector size and allocate memory
-      if (partitioner.get() != partitioner_in.get())
+      // set vector size and allocate memory, also if only the shared-memory
+      // communicator has changed since the memory is then laid out in
+      // different shared-memory segments
+      if (partitioner.get() != partitioner_in.get() || comm_sm_changed)
         {
           partitioner = partitioner_in;
           const size_type new_allocated_size =
             partitioner->locally_owned_size() + partitioner->n_ghost_indices();
           resize_val(new_allocated_size, comm_sm);
+
+          // the shared-memory data exchange needs to match the memory
+          // layout, so set it up whenever we have allocated new memory
+#ifdef DEAL_II_WITH_MPI
+          if constexpr (internal::supports_sm_exchange<Number, MemorySpaceType>)
+            sm_exchanger = internal::create_sm_exchanger(partitioner, comm_sm);
+#endif
         }
 
       // initialize to zero
@@ -954,6 +1147,28 @@ namespace LinearAlgebra
 
 
 
+    template <typename Number, typename MemorySpaceType>
+    void
+    Vector<Number, MemorySpaceType>::set_ghost_exchange_precision(
+      const bool reduced_precision)
+    {
+      Assert((reduced_precision == false ||
+              internal::supports_reduced_precision_exchange<Number,
+                                                            MemorySpaceType>),
+             ExcMessage("Sending ghost values in reduced precision is only "
+                        "supported for vectors of type double in host "
+                        "memory."));
+#ifdef DEAL_II_WITH_MPI
+      Assert(update_ghost_values_requests.empty(),
+             ExcMessage("Cannot change the precision of the ghost exchange "
+                        "while update_ghost_values() is in progress."));
+#endif
+
+      reduced_precision_ghost_exchange = reduced_precision;
+    }
+
+
+
     template <typename Number, typename MemorySpaceType>
     void
     Vector<Number, MemorySpaceType>::zero_out_ghost_values() const
@@ -1014,6 +1229,30 @@ namespace LinearAlgebra
             }
         }
 
+      // within the shared-memory domain, ghost contributions are added
+      // directly into the memory of the owning process
+      if constexpr (internal::supports_sm_exchange<Number, MemorySpaceType>)
+        {
+          if (sm_exchanger != nullptr && operation == VectorOperation::add)
+            {
+              AssertDimension(data.values_sm.size(),
+                              Utilities::MPI::n_mpi_processes(comm_sm));
+              sm_exchanger->import_from_ghosted_array_start(
+                operation,
+                communication_channel,
+                ArrayView<const Number>(data.values.data(),
+                                        partitioner->locally_owned_size()),
+                data.values_sm,
+                ArrayView<Number>(data.values.data() +
+                                    partitioner->locally_owned_size(),
+                                  partitioner->n_ghost_indices()),
+                ArrayView<Number>(import_data.values.data(),
+                                  sm_exchanger->n_import_indices()),
+                compress_requests);
+              return;
+            }
+        }
+
 #  if !defined(DEAL_II_MPI_WITH_DEVICE_SUPPORT)
       if (std::is_same_v<MemorySpaceType, dealii::MemorySpace::Default>)
         {
@@ -1044,15 +1283,48 @@ namespace LinearAlgebra
       else
 #  endif
         {
-          partitioner->import_from_ghosted_array_start(
-            operation,
-            communication_channel,
-            ArrayView<Number, MemorySpaceType>(
-              data.values.data() + partitioner->locally_owned_size(),
-              partitioner->n_ghost_indices()),
-            ArrayView<Number, MemorySpaceType>(import_data.values.data(),
-                                               partitioner->n_import_indices()),
-            compress_requests);
+          // the communication pattern does not change between calls, so for
+          // host memory the MPI requests are only set up once and then
+          // restarted
+          const bool use_persistent_requests =
+            std::is_same_v<MemorySpaceType, MemorySpace::Host> &&
+            partitioner->uses_neighborhood_collectives() == false;
+          if (use_persistent_requests)
+            {
+              const ArrayView<Number> ghost_array(
+                data.values.data() + partitioner->locally_owned_size(),
+                partitioner->n_ghost_indices());
+
+              if (compress_persistent_requests.empty() ||
+                  compress_persistent_channel != communication_channel)
+                {
+                  internal::free_mpi_requests(compress_persistent_requests);
+                  partitioner->import_from_ghosted_array_init_persistent(
+                    communication_channel,
+                    ghost_array,
+                    ArrayView<Number>(import_data.values.data(),
+                                      partitioner->n_import_indices()),
+                    compress_persistent_requests);
+                  compress_persistent_channel = communication_channel;
+                }
+
+              partitioner->import_from_ghosted_array_start_persistent(
+                operation, ghost_array, compress_persistent_requests);
+
+              // the requests are active until compress_finish()
+              Assert(compress_requests.empty(), ExcInternalError());
+              compress_requests.swap(compress_persistent_requests);
+            }
+          else
+            partitioner->import_from_ghosted_array_start(
+              operation,
+              communication_channel,
+              ArrayView<Number, MemorySpaceType>(
+                data.values.data() + partitioner->locally_owned_size(),
+                partitioner->n_ghost_indices()),
+              ArrayView<Number, MemorySpaceType>(
+                import_data.values.data(), partitioner->n_import_indices()),
+              compress_requests);
         }
 #else
       (void)communication_channel;
@@ -1076,6 +1348,36 @@ namespace LinearAlgebra
 
       // make this function thread safe
       std::lock_guard<std::mutex> lock(mutex);
+
+      if constexpr (internal::supports_sm_exchange<Number, MemorySpaceType>)
+        {
+          if (sm_exchanger != nullptr && operation == VectorOperation::add)
+            {
+              sm_exchanger->import_from_ghosted_array_finish(
+                operation,
+                ArrayView<Number>(data.values.data(),
+                                  partitioner->locally_owned_size()),
+                data.values_sm,
+                ArrayView<Number>(data.values.data() +
+                                    partitioner->locally_owned_size(),
+                                  partitioner->n_ghost_indices()),
+                ArrayView<const Number>(import_data.values.data(),
+                                        sm_exchanger->n_import_indices()),
+                compress_requests);
+              compress_requests.clear();
+
+              // the ghost entries of this process are read and reset by the
+              // owners, so they must not be touched before those are done
+              internal::finish_sm_exchange(
+                sm_exchanger->get_sm_import_ranks(),
+                sm_exchanger->get_sm_ghost_ranks(),
+                comm_sm,
+                Utilities::MPI::internal::Tags::vector_sm_compress_done,
+                compress_requests);
+              return;
+            }
+        }
+
 #  if !defined(DEAL_II_MPI_WITH_DEVICE_SUPPORT)
       if (std::is_same_v<MemorySpaceType, MemorySpace::Default>)
         {
@@ -1109,17 +1411,35 @@ namespace LinearAlgebra
           Assert(partitioner->n_import_indices() == 0 ||
                    import_data.values.size() != 0,
                  ExcNotInitialized());
-          partitioner
-            ->import_from_ghosted_array_finish<Number, MemorySpaceType>(
-              operation,
-              ArrayView<const Number, MemorySpaceType>(
-                import_data.values.data(), partitioner->n_import_indices()),
-              ArrayView<Number, MemorySpaceType>(
-                data.values.data(), partitioner->locally_owned_size()),
-              ArrayView<Number, MemorySpaceType>(
-                data.values.data() + partitioner->locally_owned_size(),
-                partitioner->n_ghost_indices()),
-              compress_requests);
+          if (std::is_same_v<MemorySpaceType, MemorySpace::Host> &&
+              partitioner->uses_neighborhood_collectives() == false)
+            {
+              partitioner->import_from_ghosted_array_finish_persistent(
+                operation,
+                ArrayView<const Number>(import_data.values.data(),
+                                        partitioner->n_import_indices()),
+                ArrayView<Number>(data.values.data(),
+                                  partitioner->locally_owned_size()),
+                ArrayView<Number>(data.values.data() +
+                                    partitioner->locally_owned_size(),
+                                  partitioner->n_ghost_indices()),
+                compress_requests);
+
+              // keep the inactive requests for the next call
+              compress_persistent_requests.swap(compress_requests);
+            }
+          else
+            partitioner
+              ->import_from_ghosted_array_finish<Number, MemorySpaceType>(
+                operation,
+                ArrayView<const Number, MemorySpaceType>(
+                  import_data.values.data(), partitioner->n_import_indices()),
+                ArrayView<Number, MemorySpaceType>(
+                  data.values.data(), partitioner->locally_owned_size()),
+                ArrayView<Number, MemorySpaceType>(
+                  data.values.data() + partitioner->locally_owned_size(),
+                  partitioner->n_ghost_indices()),
+                compress_requests);
         }
 #else
       (void)operation;
@@ -1135,9 +1455,11 @@ namespace LinearAlgebra
     {
       AssertIndexRange(communication_channel, 200);
 #ifdef DEAL_II_WITH_MPI
-      // nothing to do when we neither have import nor ghost indices.
+      // nothing to do when we neither have import nor ghost indices, unless
+      // all processes need to take part in the neighborhood collective
       if (partitioner->n_ghost_indices() == 0 &&
-          partitioner->n_import_indices() == 0)
+          partitioner->n_import_indices() == 0 &&
+          partitioner->uses_neighborhood_collectives() == false)
         return;
 
       // make this function thread safe
@@ -1174,6 +1496,55 @@ namespace LinearAlgebra
             }
         }
 
+      // within the shared-memory domain, ghost values are read directly from
+      // the memory of the owning process in update_ghost_values_finish()
+      if constexpr (internal::supports_sm_exchange<Number, MemorySpaceType>)
+        {
+          if (sm_exchanger != nullptr)
+            {
+              AssertDimension(data.values_sm.size(),
+                              Utilities::MPI::n_mpi_processes(comm_sm));
+              sm_exchanger->export_to_ghosted_array_start(
+                communication_channel,
+                ArrayView<const Number>(data.values.data(),
+                                        partitioner->locally_owned_size()),
+                data.values_sm,
+                ArrayView<Number>(data.values.data() +
+                                    partitioner->locally_owned_size(),
+                                  partitioner->n_ghost_indices()),
+                ArrayView<Number>(import_data.values.data(),
+                                  sm_exchanger->n_import_indices()),
+                update_ghost_values_requests);
+              return;
+            }
+        }
+
+      // send the data in single precision if so requested, converting it
+      // while packing it into the send buffer
+      if constexpr (internal::supports_reduced_precision_exchange<
+                      Number,
+                      MemorySpaceType>)
+        {
+          if (reduced_precision_ghost_exchange)
+            {
+              const unsigned int n_import = partitioner->n_import_indices();
+              reduced_precision_buffer.resize(n_import +
+                                              partitioner->n_ghost_indices());
+              partitioner->export_to_ghosted_array_start_with_conversion(
+                communication_channel,
+                ArrayView<const Number>(data.values.data(),
+                                        partitioner->locally_owned_size()),
+                ArrayView<float>(reduced_precision_buffer.data(), n_import),
+                ArrayView<float>(reduced_precision_buffer.data() + n_import,
+                                 partitioner->n_ghost_indices()),
+                update_ghost_values_requests);
+
+              n_bytes_saved_by_reduced_precision +=
+                std::size_t(n_import) * (sizeof(Number) - sizeof(float));
+              return;
+            }
+        }
+
 #  if !defined(DEAL_II_MPI_WITH_DEVICE_SUPPORT)
       if (std::is_same_v<MemorySpaceType, MemorySpace::Default>)
         {
@@ -1207,16 +1578,57 @@ namespace LinearAlgebra
       else
 #  endif
         {
-          partitioner->export_to_ghosted_array_start<Number, MemorySpaceType>(
-            communication_channel,
-            ArrayView<const Number, MemorySpaceType>(
-              data.values.data(), partitioner->locally_owned_size()),
-            ArrayView<Number, MemorySpaceType>(import_data.values.data(),
-                                               partitioner->n_import_indices()),
-            ArrayView<Number, MemorySpaceType>(
-              data.values.data() + partitioner->locally_owned_size(),
-              partitioner->n_ghost_indices()),
-            update_ghost_values_requests);
+          // the communication pattern does not change between calls, so for
+          // host memory the MPI requests are only set up once and then
+          // restarted
+          const bool use_persistent_requests =
+            std::is_same_v<MemorySpaceType, MemorySpace::Host> &&
+            partitioner->uses_neighborhood_collectives() == false;
+          if (use_persistent_requests)
+            {
+              const ArrayView<Number> import_array(
+                import_data.values.data(), partitioner->n_import_indices());
+
+              if (update_ghost_values_persistent_requests.empty() ||
+                  update_ghost_values_persistent_channel !=
+                    communication_channel)
+                {
+                  internal::free_mpi_requests(
+                    update_ghost_values_persistent_requests);
+                  partitioner->export_to_ghosted_array_init_persistent(
+                    communication_channel,
+                    import_array,
+                    ArrayView<Number>(data.values.data() +
+                                        partitioner->locally_owned_size(),
+                                      partitioner->n_ghost_indices()),
+                    update_ghost_values_persistent_requests);
+                  update_ghost_values_persistent_channel =
+                    communication_channel;
+                }
+
+              partitioner->export_to_ghosted_array_start_persistent(
+                ArrayView<const Number>(data.values.data(),
+                                        partitioner->locally_owned_size()),
+                import_array,
+                update_ghost_values_persistent_requests);
+
+              // the requests are active until update_ghost_values_finish()
+              Assert(update_ghost_values_requests.empty(), ExcInternalError());
+              update_ghost_values_requests.swap(
+                update_ghost_values_persistent_requests);
+            }
+          else
+            partitioner
+              ->export_to_ghosted_array_start<Number, MemorySpaceType>(
+                communication_channel,
+                ArrayView<const Number, MemorySpaceType>(
+                  data.values.data(), partitioner->locally_owned_size()),
+                ArrayView<Number, MemorySpaceType>(
+                  import_data.values.data(), partitioner->n_import_indices()),
+                ArrayView<Number, MemorySpaceType>(
+                  data.values.data() + partitioner->locally_owned_size(),
+                  partitioner->n_ghost_indices()),
+                update_ghost_values_requests);
         }
 
 #else
@@ -1231,10 +1643,79 @@ namespace LinearAlgebra
     Vector<Number, MemorySpaceType>::update_ghost_values_finish() const
     {
 #ifdef DEAL_II_WITH_MPI
+      if constexpr (internal::supports_sm_exchange<Number, MemorySpaceType>)
+        {
+          if (sm_exchanger != nullptr)
+            {
+              if (update_ghost_values_requests.size() > 0)
+                {
+                  // make this function thread safe
+                  std::lock_guard<std::mutex> lock(mutex);
+
+                  sm_exchanger->export_to_ghosted_array_finish(
+                    ArrayView<const Number>(data.values.data(),
+                                            partitioner->locally_owned_size()),
+                    data.values_sm,
+                    ArrayView<Number>(data.values.data() +
+                                        partitioner->locally_owned_size(),
+                                      partitioner->n_ghost_indices()),
+                    update_ghost_values_requests);
+                  update_ghost_values_requests.clear();
+
+                  // other processes read from the locally owned entries of
+                  // this process, which must not be modified before they are
+                  // done
+                  internal::finish_sm_exchange(
+                    sm_exchanger->get_sm_ghost_ranks(),
+                    sm_exchanger->get_sm_import_ranks(),
+                    comm_sm,
+                    Utilities::MPI::internal::Tags::
+                      vector_sm_update_ghost_values_done,
+                    update_ghost_values_requests);
+                }
+
+              vector_is_ghosted = true;
+              return;
+            }
+        }
+
+      if constexpr (internal::supports_reduced_precision_exchange<
+                      Number,
+                      MemorySpaceType>)
+        {
+          if (reduced_precision_ghost_exchange)
+            {
+              if (update_ghost_values_requests.size() > 0)
+                {
+                  // make this function thread safe
+                  std::lock_guard<std::mutex> lock(mutex);
+
+                  const unsigned int n_import = partitioner->n_import_indices();
+                  const unsigned int n_ghost  = partitioner->n_ghost_indices();
+                  partitioner->export_to_ghosted_array_finish(
+                    ArrayView<float>(reduced_precision_buffer.data() +
+                                       n_import,
+                                     n_ghost),
+                    update_ghost_values_requests);
+
+                  std::copy(reduced_precision_buffer.begin() + n_import,
+                            reduced_precision_buffer.begin() + n_import +
+                              n_ghost,
+                            data.values.data() +
+                              partitioner->locally_owned_size());
+                }
+
+              vector_is_ghosted = true;
+              return;
+            }
+        }
+
       // wait for both sends and receives to complete, even though only
       // receives are really necessary. this gives (much) better performance
-      AssertDimension(partitioner->ghost_targets().size() +
-                        partitioner->import_targets().size(),
+      AssertDimension(partitioner->uses_neighborhood_collectives() ?
+                        1 :
+                        partitioner->ghost_targets().size() +
+                          partitioner->import_targets().size(),
                       update_ghost_values_requests.size());
       if (update_ghost_values_requests.size() > 0)
         {
@@ -1265,11 +1746,25 @@ namespace LinearAlgebra
           else
 #  endif
             {
-              partitioner->export_to_ghosted_array_finish(
-                ArrayView<Number, MemorySpaceType>(
-                  data.values.data() + partitioner->locally_owned_size(),
-                  partitioner->n_ghost_indices()),
-                update_ghost_values_requests);
+              if (std::is_same_v<MemorySpaceType, MemorySpace::Host> &&
+                  partitioner->uses_neighborhood_collectives() == false)
+                {
+                  partitioner->export_to_ghosted_array_finish_persistent(
+                    ArrayView<Number>(data.values.data() +
+                                        partitioner->locally_owned_size(),
+                                      partitioner->n_ghost_indices()),
+                    update_ghost_values_requests);
+
+                  // keep the inactive requests for the next call
+                  update_ghost_values_persistent_requests.swap(
+                    update_ghost_values_requests);
+                }
+              else
+                partitioner->export_to_ghosted_array_finish(
+                  ArrayView<Number, MemorySpaceType>(
+                    data.values.data() + partitioner->locally_owned_size(),
+                    partitioner->n_ghost_indices()),
+                  update_ghost_values_requests);
             }
         }
 
@@ -1408,7 +1903,14 @@ namespace LinearAlgebra
 
       std::swap(compress_requests, v.compress_requests);
       std::swap(update_ghost_values_requests, v.update_ghost_values_requests);
+      std::swap(compress_persistent_requests, v.compress_persistent_requests);
+      std::swap(compress_persistent_channel, v.compress_persistent_channel);
+      std::swap(update_ghost_values_persistent_requests,
+                v.update_ghost_values_persistent_requests);
+      std::swap(update_ghost_values_persistent_channel,
+                v.update_ghost_values_persistent_channel);
       std::swap(comm_sm, v.comm_sm);
+      std::swap(sm_exchanger, v.sm_exchanger);
 #endif
 
       std::swap(partitioner, v.partitioner);
@@ -1417,6 +1919,11 @@ namespace LinearAlgebra
       std::swap(data, v.data);
       std::swap(import_data, v.import_data);
       std::swap(vector_is_ghosted, v.vector_is_ghosted);
+      std::swap(reduced_precision_ghost_exchange,
+                v.reduced_precision_ghost_exchange);
+      std::swap(reduced_precision_buffer, v.reduced_precision_buffer);
+      std::swap(n_bytes_saved_by_reduced_precision,
+                v.n_bytes_saved_by_reduced_precision);
     }
 
 
@@ -2063,6 +2570,63 @@ namespace LinearAlgebra
 
 
 
+    template <typename Number, typename MemorySpaceType>
+    Utilities::MPI::Future<Number>
+    Vector<Number, MemorySpaceType>::inner_product_async(
+      const Vector<Number, MemorySpaceType> &v) const
+    {
+      return internal::start_global_sum<Number>(
+        inner_product_local(v), *partitioner, [](const Number sum) {
+          return sum;
+        });
+    }
+
+
+
+    template <typename Number, typename MemorySpaceType>
+    Utilities::MPI::Future<typename Vector<Number, MemorySpaceType>::real_type>
+    Vector<Number, MemorySpaceType>::l2_norm_async() const
+    {
+      return internal::start_global_sum<real_type>(
+        norm_sqr_local(), *partitioner, [](const real_type sum) {
+          return std::sqrt(sum);
+        });
+    }
+
+
+
+    template <typename Number, typename MemorySpaceType>
+    Utilities::MPI::Future<Number>
+    Vector<Number, MemorySpaceType>::mean_value_async() const
+    {
+      // same scaling as in mean_value()
+      const Number local_result =
+        mean_value_local() *
+        static_cast<real_type>(partitioner->locally_owned_size());
+      const real_type global_size = static_cast<real_type>(size());
+      return internal::start_global_sum<Number>(
+        local_result, *partitioner, [global_size](const Number sum) {
+          return sum / global_size;
+        });
+    }
+
+
+
+    template <typename Number, typename MemorySpaceType>
+    Utilities::MPI::Future<Number>
+    Vector<Number, MemorySpaceType>::add_and_dot_async(
+      const Number                           a,
+      const Vector<Number, MemorySpaceType> &v,
+      const Vector<Number, MemorySpaceType> &w)
+    {
+      return internal::start_global_sum<Number>(
+        add_and_dot_local(a, v, w), *partitioner, [](const Number sum) {
+          return sum;
+        });
+    }
+
+
+
     template <typename Number, typename MemorySpaceType>
     inline bool
     Vector<Number, MemorySpaceType>::partitioners_are_compatible(
@@ -2100,6 +2664,7 @@ namespace LinearAlgebra
           import_data.values.size() != 0)
         memory += (static_cast<std::size_t>(partitioner->n_import_indices()) *
                    sizeof(Number));
+      memory += reduced_precision_buffer.capacity() * sizeof(float);
       return memory;
     }
 
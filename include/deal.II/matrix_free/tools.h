@@ -17,6 +17,8 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/std_cxx20/type_traits.h>
+
 #include <deal.II/grid/tria.h>
 
 #include <deal.II/matrix_free/fe_evaluation.h>
@@ -27,6 +29,8 @@
 
 #include <Kokkos_Core.hpp>
 
+#include <chrono>
+
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -473,6 +477,46 @@ namespace MatrixFreeTools
 
 
 
+  /**
+   * Measure the average cost of applying the cell operation
+   * @p cell_operation, with the same signature as for MatrixFree::cell_loop(),
+   * to a single cell for each active FE index of an hp-adaptive
+   * @p matrix_free object. To this end, the cell batches of @p matrix_free are
+   * split into ranges with a single active FE index, as done within
+   * MatrixFree::cell_loop() before calling the cell operation, and the time
+   * of @p n_repetitions applications of @p cell_operation to each of these
+   * ranges with the vectors @p dst and @p src is measured. The time is
+   * summed over all MPI processes of @p matrix_free and divided by the
+   * number of cells with the respective FE index.
+   *
+   * The returned vector holds the time per cell in seconds for each active
+   * FE index, or zero for indices not used on any cell. It can be fed into
+   * parallel::CellWeights::fe_index_weighting() to balance the load of
+   * hp-adaptive computations according to the measured costs.
+   *
+   * @note Since the cell operation is called outside of a MatrixFree loop,
+   * it should not depend on the ghost values of @p src being updated or the
+   * ghost contributions to @p dst being communicated.
+   */
+  template <int dim,
+            typename Number,
+            typename VectorizedArrayType,
+            typename VectorTypeOut,
+            typename VectorTypeIn>
+  std::vector<double>
+  measure_cost_per_fe_index(
+    const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+    const std_cxx20::type_identity_t<std::function<
+      void(const MatrixFree<dim, Number, VectorizedArrayType> &,
+           VectorTypeOut &,
+           const VectorTypeIn &,
+           const std::pair<unsigned int, unsigned int> &)>> &cell_operation,
+    VectorTypeOut                                          &dst,
+    const VectorTypeIn                                     &src,
+    const unsigned int                                      n_repetitions = 5);
+
+
+
   /**
    * A wrapper around MatrixFree to help users to deal with DoFHandler
    * objects involving cells without degrees of freedom, i.e.,
@@ -2655,6 +2699,72 @@ namespace MatrixFreeTools
       first_selected_component);
   }
 
+  template <int dim,
+            typename Number,
+            typename VectorizedArrayType,
+            typename VectorTypeOut,
+            typename VectorTypeIn>
+  std::vector<double>
+  measure_cost_per_fe_index(
+    const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+    const std_cxx20::type_identity_t<std::function<
+      void(const MatrixFree<dim, Number, VectorizedArrayType> &,
+           VectorTypeOut &,
+           const VectorTypeIn &,
+           const std::pair<unsigned int, unsigned int> &)>> &cell_operation,
+    VectorTypeOut                                          &dst,
+    const VectorTypeIn                                     &src,
+    const unsigned int                                      n_repetitions)
+  {
+    const unsigned int n_fe_indices =
+      std::max(matrix_free.n_active_fe_indices(), 1U);
+
+    // entry 2*i holds the time and entry 2*i+1 the number of cells of the
+    // active FE index i, such that both can be summed over all processes at
+    // once
+    std::vector<double> times_and_cells(2 * n_fe_indices, 0.);
+
+    const unsigned int n_cell_batches = matrix_free.n_cell_batches();
+    for (unsigned int begin = 0, end = 0; begin < n_cell_batches; begin = end)
+      {
+        // find the range of cell batches with the same active FE index,
+        // which is typically the part of a partition of the cell loop
+        // for this index
+        const unsigned int fe_index =
+          matrix_free.get_cell_active_fe_index({begin, begin + 1});
+        AssertIndexRange(fe_index, n_fe_indices);
+        end = begin + 1;
+        while (end < n_cell_batches &&
+               matrix_free.get_cell_active_fe_index({end, end + 1}) ==
+                 fe_index)
+          ++end;
+
+        for (unsigned int batch = begin; batch < end; ++batch)
+          times_and_cells[2 * fe_index + 1] +=
+            matrix_free.n_active_entries_per_cell_batch(batch);
+
+        const auto start_time = std::chrono::steady_clock::now();
+        for (unsigned int r = 0; r < n_repetitions; ++r)
+          cell_operation(matrix_free, dst, src, {begin, end});
+        times_and_cells[2 * fe_index] +=
+          std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                        start_time)
+            .count();
+      }
+
+    Utilities::MPI::sum(times_and_cells,
+                        matrix_free.get_task_info().communicator,
+                        times_and_cells);
+
+    std::vector<double> cost_per_cell(n_fe_indices, 0.);
+    for (unsigned int i = 0; i < n_fe_indices; ++i)
+      if (times_and_cells[2 * i + 1] > 0)
+        cost_per_cell[i] = times_and_cells[2 * i] /
+                           (n_repetitions * times_and_cells[2 * i + 1]);
+
+    return cost_per_cell;
+  }
+
 #endif // DOXYGEN
 
 } // namespace MatrixFreeTools
@@ -283,6 +283,24 @@ namespace internal
         MPI_Comm
         get_sm_mpi_communicator() const;
 
+        /**
+         * Return the ranks within the shared-memory communicator whose
+         * locally owned values this process reads during
+         * export_to_ghosted_array_finish() and which read and reset the ghost
+         * values of this process during import_from_ghosted_array_finish().
+         */
+        const std::vector<unsigned int> &
+        get_sm_ghost_ranks() const;
+
+        /**
+         * Return the ranks within the shared-memory communicator which read
+         * the locally owned values of this process during
+         * export_to_ghosted_array_finish() and whose ghost values this
+         * process reads and resets during import_from_ghosted_array_finish().
+         */
+        const std::vector<unsigned int> &
+        get_sm_import_ranks() const;
+
         void
         export_to_ghosted_array_start(
           const unsigned int                          communication_channel,
@@ -22,6 +22,7 @@
 #include <Kokkos_Core.hpp>
 
 #include <limits>
+#include <map>
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -153,6 +154,8 @@ namespace Utilities
     void
     Partitioner::set_owned_indices(const IndexSet &locally_owned_indices)
     {
+      neighborhood_communication.reset();
+
       my_pid  = Utilities::MPI::this_mpi_process(communicator);
       n_procs = Utilities::MPI::n_mpi_processes(communicator);
 
@@ -195,6 +198,10 @@ namespace Utilities
              ExcDimensionMismatch(ghost_indices_in.size(),
                                   locally_owned_range_data.size()));
 
+      // the communication pattern changes, so the neighborhood collectives
+      // need to be set up again
+      neighborhood_communication.reset();
+
       ghost_indices_data = ghost_indices_in;
       if (ghost_indices_data.size() != locally_owned_range_data.size())
         ghost_indices_data.set_size(locally_owned_range_data.size());
@@ -488,6 +495,141 @@ namespace Utilities
 
 
 
+    Partitioner::NeighborhoodCommunication::~NeighborhoodCommunication()
+    {
+#  ifdef DEAL_II_WITH_MPI
+      // do not free the communicators if this object is destroyed after the
+      // end of the MPI session, e.g., as part of a global variable
+      int finalized = 0;
+      MPI_Finalized(&finalized);
+      if (finalized == 0)
+        {
+          if (export_communicator != MPI_COMM_NULL)
+            MPI_Comm_free(&export_communicator);
+          if (import_communicator != MPI_COMM_NULL)
+            MPI_Comm_free(&import_communicator);
+        }
+#  endif
+    }
+
+
+
+    void
+    Partitioner::setup_neighborhood_communication()
+    {
+      neighborhood_communication.reset();
+
+#  ifdef DEAL_II_WITH_MPI
+      if (n_procs < 2)
+        return;
+
+      auto data = std::make_shared<NeighborhoodCommunication>();
+
+      std::vector<int> ghost_ranks, import_ranks;
+      ghost_ranks.reserve(ghost_targets_data.size());
+      int offset = 0;
+      for (const auto &[rank, n_indices] : ghost_targets_data)
+        {
+          ghost_ranks.push_back(rank);
+          data->ghost_counts.push_back(n_indices);
+          data->ghost_offsets.push_back(offset);
+          offset += n_indices;
+        }
+      import_ranks.reserve(import_targets_data.size());
+      offset = 0;
+      for (const auto &[rank, n_indices] : import_targets_data)
+        {
+          import_ranks.push_back(rank);
+          data->import_counts.push_back(n_indices);
+          data->import_offsets.push_back(offset);
+          offset += n_indices;
+        }
+      AssertThrow(n_ghost_indices() < static_cast<unsigned int>(
+                                        std::numeric_limits<int>::max()) &&
+                    n_import_indices() < static_cast<unsigned int>(
+                                           std::numeric_limits<int>::max()),
+                  ExcMessage("Index overflow: The neighborhood collectives "
+                             "support at most 2^31-1 ghost and import "
+                             "indices per process."));
+
+      // data flows from the owners of the ghost indices to the processes
+      // importing them in export_to_ghosted_array_start(), and in the
+      // reverse direction in import_from_ghosted_array_start()
+      int ierr = MPI_Dist_graph_create_adjacent(communicator,
+                                                ghost_ranks.size(),
+                                                ghost_ranks.data(),
+                                                MPI_UNWEIGHTED,
+                                                import_ranks.size(),
+                                                import_ranks.data(),
+                                                MPI_UNWEIGHTED,
+                                                MPI_INFO_NULL,
+                                                0,
+                                                &data->export_communicator);
+      AssertThrowMPI(ierr);
+      ierr = MPI_Dist_graph_create_adjacent(communicator,
+                                            import_ranks.size(),
+                                            import_ranks.data(),
+                                            MPI_UNWEIGHTED,
+                                            ghost_ranks.size(),
+                                            ghost_ranks.data(),
+                                            MPI_UNWEIGHTED,
+                                            MPI_INFO_NULL,
+                                            0,
+                                            &data->import_communicator);
+      AssertThrowMPI(ierr);
+
+      neighborhood_communication = std::move(data);
+#  endif
+    }
+
+
+
+    MPI_Comm
+    Partitioner::create_reordered_communicator() const
+    {
+#  ifdef DEAL_II_WITH_MPI
+      // The graph is symmetric: a process sends data to the owners of its
+      // ghost indices in compress() and receives data from them in
+      // update_ghost_values(). The weight of an edge is the total amount of
+      // data exchanged in both directions.
+      std::map<int, types::global_dof_index> weights;
+      for (const auto &[rank, n_indices] : ghost_targets_data)
+        weights[rank] += n_indices;
+      for (const auto &[rank, n_indices] : import_targets_data)
+        weights[rank] += n_indices;
+
+      const types::global_dof_index max_weight =
+        std::numeric_limits<int>::max();
+      std::vector<int> neighbors, neighbor_weights;
+      neighbors.reserve(weights.size());
+      neighbor_weights.reserve(weights.size());
+      for (const auto &[rank, weight] : weights)
+        {
+          neighbors.push_back(rank);
+          neighbor_weights.push_back(
+            static_cast<int>(std::min(weight, max_weight)));
+        }
+
+      MPI_Comm  new_communicator;
+      const int ierr = MPI_Dist_graph_create_adjacent(communicator,
+                                                      neighbors.size(),
+                                                      neighbors.data(),
+                                                      neighbor_weights.data(),
+                                                      neighbors.size(),
+                                                      neighbors.data(),
+                                                      neighbor_weights.data(),
+                                                      MPI_INFO_NULL,
+                                                      1,
+                                                      &new_communicator);
+      AssertThrowMPI(ierr);
+      return new_communicator;
+#  else
+      return communicator;
+#  endif
+    }
+
+
+
     std::size_t
     Partitioner::memory_consumption() const
     {
@@ -515,6 +657,15 @@ namespace Utilities
       memory += MemoryConsumption::memory_consumption(n_procs);
       memory += MemoryConsumption::memory_consumption(communicator);
       memory += MemoryConsumption::memory_consumption(have_ghost_indices);
+      if (neighborhood_communication != nullptr)
+        memory += MemoryConsumption::memory_consumption(
+                    neighborhood_communication->ghost_counts) +
+                  MemoryConsumption::memory_consumption(
+                    neighborhood_communication->ghost_offsets) +
+                  MemoryConsumption::memory_consumption(
+                    neighborhood_communication->import_counts) +
+                  MemoryConsumption::memory_consumption(
+                    neighborhood_communication->import_offsets);
       return memory;
     }
 
@@ -122,6 +122,41 @@ namespace parallel
 
 
 
+  template <int dim, int spacedim>
+  typename CellWeights<dim, spacedim>::WeightingFunction
+  CellWeights<dim, spacedim>::fe_index_weighting(
+    const std::vector<float> &weights)
+  {
+    return [weights](
+             const typename DoFHandler<dim, spacedim>::cell_iterator &cell,
+             const FiniteElement<dim, spacedim> &future_fe) -> unsigned int {
+      // The element passed to this function is the one stored in the
+      // hp::FECollection of the DoFHandler, so identify it by its address.
+      const auto  &fe_collection = cell->get_dof_handler().get_fe_collection();
+      unsigned int fe_index      = 0;
+      while (fe_index < fe_collection.size() &&
+             &fe_collection[fe_index] != &future_fe)
+        ++fe_index;
+
+      Assert(fe_index < fe_collection.size(),
+             ExcMessage("The finite element is not part of the "
+                        "hp::FECollection of the DoFHandler!"));
+      AssertIndexRange(fe_index, weights.size());
+
+      const float result = std::trunc(weights[fe_index]);
+
+      Assert(result >= 0. &&
+               result <=
+                 static_cast<float>(std::numeric_limits<unsigned int>::max()),
+             ExcMessage(
+               "Cannot cast determined weight for this cell to unsigned int!"));
+
+      return static_cast<unsigned int>(result);
+    };
+  }
+
+
+
   // ---------- handling callback functions ----------
 
   template <int dim, int spacedim>
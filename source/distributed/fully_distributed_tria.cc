@@ -564,7 +564,7 @@ namespace parallel
         AssertThrowMPI(ierr);
 
         // Write offsets to file.
-        ierr = MPI_File_write_at(
+        ierr = MPI_File_write_at_all(
           fh,
           myrank * sizeof(std::uint64_t),
           &buffer_size,
@@ -578,7 +578,7 @@ namespace parallel
           mpisize * sizeof(std::uint64_t) + offset;
 
         // Write buffers to file.
-        ierr = dealii::Utilities::MPI::LargeCount::File_write_at_c(
+        ierr = dealii::Utilities::MPI::LargeCount::File_write_at_all_c(
           fh,
           global_position,
           buffer.data(),
@@ -656,7 +656,7 @@ namespace parallel
         // Read offsets from file.
         std::uint64_t buffer_size;
 
-        ierr = MPI_File_read_at(
+        ierr = MPI_File_read_at_all(
           fh,
           myrank * sizeof(std::uint64_t),
           &buffer_size,
@@ -682,7 +682,7 @@ namespace parallel
 
         // Read buffers from file.
         std::vector<char> buffer(buffer_size);
-        ierr = dealii::Utilities::MPI::LargeCount::File_read_at_c(
+        ierr = dealii::Utilities::MPI::LargeCount::File_read_at_all_c(
           fh,
           global_position,
           buffer.data(),
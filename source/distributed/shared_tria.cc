@@ -53,13 +53,14 @@ namespace parallel
     {
       const auto partition_settings =
         (partition_zoltan | partition_metis | partition_zorder |
-         partition_custom_signal) &
+         partition_custom_signal | partition_hilbert) &
         settings;
       Assert(partition_settings == partition_auto ||
                partition_settings == partition_metis ||
                partition_settings == partition_zoltan ||
                partition_settings == partition_zorder ||
-               partition_settings == partition_custom_signal,
+               partition_settings == partition_custom_signal ||
+               partition_settings == partition_hilbert,
              ExcMessage("Settings must contain exactly one type of the active "
                         "cell partitioning scheme."));
 
@@ -100,9 +101,10 @@ namespace parallel
               "agree on the number of active cells."));
         }
 
-      auto partition_settings = (partition_zoltan | partition_metis |
-                                 partition_zorder | partition_custom_signal) &
-                                settings;
+      auto partition_settings =
+        (partition_zoltan | partition_metis | partition_zorder |
+         partition_custom_signal | partition_hilbert) &
+        settings;
       if (partition_settings == partition_auto)
 #  ifdef DEAL_II_TRILINOS_WITH_ZOLTAN
         partition_settings = partition_zoltan;
@@ -147,6 +149,11 @@ namespace parallel
         {
           GridTools::partition_triangulation_zorder(this->n_subdomains, *this);
         }
+      else if (partition_settings == partition_hilbert)
+        {
+          GridTools::partition_triangulation_hilbert(this->n_subdomains,
+                                                     *this);
+        }
       else if (partition_settings == partition_custom_signal)
         {
           // User partitions mesh manually
@@ -159,7 +166,7 @@ namespace parallel
       // do not partition multigrid levels if user is
       // defining a custom partition
       if ((settings & construct_multigrid_hierarchy) &&
-          !(settings & partition_custom_signal))
+          partition_settings != partition_custom_signal)
         dealii::GridTools::partition_multigrid_levels(*this);
 
       true_subdomain_ids_of_cells.resize(this->n_active_cells());
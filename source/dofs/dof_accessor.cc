@@ -112,6 +112,12 @@ DoFCellAccessor<dim, spacedim, lda>::set_dof_indices(
 
   Assert(this->dof_handler != nullptr, typename BaseClass::ExcInvalidObject());
 
+  // the cached indices of this and neighboring cells are no longer valid.
+  // only touch the cache if there is one, so that setting the indices of
+  // different cells concurrently remains possible without it
+  if (this->dof_handler->has_cell_dof_indices_cache())
+    this->dof_handler->clear_cell_dof_indices_cache();
+
   internal::DoFAccessorImplementation::Implementation::
     template set_dof_indices<dim, spacedim, lda, dim>(*this,
                                                       local_dof_indices,
@@ -264,6 +270,9 @@ namespace internal
       boost::container::small_vector<types::global_dof_index, 27> &dof_indices,
       const unsigned int                                           fe_index)
     {
+      if (Implementation::get_cached_cell_dof_indices(accessor, dof_indices))
+        return;
+
       Implementation::process_dof_indices(
         accessor,
         dof_indices,
@@ -288,6 +297,10 @@ DoFCellAccessor<dimension_, space_dimension_, level_dof_access>::
          ExcMessage("Can't ask for DoF indices on artificial cells."));
   AssertDimension(dof_indices.size(), this->get_fe().n_dofs_per_cell());
 
+  if (dealii::internal::DoFAccessorImplementation::Implementation::
+        get_cached_cell_dof_indices(*this, dof_indices))
+    return;
+
   dealii::internal::DoFAccessorImplementation::Implementation::get_dof_indices(
     *this, dof_indices, this->active_fe_index());
 }
@@ -17,6 +17,7 @@
 #include <deal.II/base/geometry_info.h>
 #include <deal.II/base/memory_consumption.h>
 #include <deal.II/base/mpi.templates.h>
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/thread_management.h>
 
 #include <deal.II/distributed/cell_data_transfer.templates.h>
@@ -36,6 +37,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <numeric>
 #include <set>
 #include <unordered_set>
 
@@ -1716,6 +1718,7 @@ DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
 DoFHandler<dim, spacedim>::DoFHandler()
   : hp_capability_enabled(true)
   , tria(nullptr, typeid(*this).name())
+  , cell_dof_indices_cache_enabled(false)
   , mg_faces(nullptr)
 {}
 
@@ -2102,7 +2105,9 @@ std::size_t DoFHandler<dim, spacedim>::memory_consumption() const
          MemoryConsumption::memory_consumption(hp_object_fe_indices) +
          MemoryConsumption::memory_consumption(hp_object_fe_ptr) +
          MemoryConsumption::memory_consumption(hp_cell_active_fe_indices) +
-         MemoryConsumption::memory_consumption(hp_cell_future_fe_indices);
+         MemoryConsumption::memory_consumption(hp_cell_future_fe_indices) +
+         MemoryConsumption::memory_consumption(cell_dof_cache_ptr) +
+         MemoryConsumption::memory_consumption(cell_dof_cache_indices);
 
 
   if (hp_capability_enabled)
@@ -2257,7 +2262,10 @@ void DoFHandler<dim, spacedim>::distribute_dofs(
       internal::DoFHandlerImplementation::Implementation::reserve_space(*this);
   }
 
-  // hand the actual work over to the policy
+  // hand the actual work over to the policy; the policy queries DoF indices
+  // of cells while enumerating, so any previously cached indices must be
+  // gone by now
+  this->clear_cell_dof_indices_cache();
   this->number_cache = this->policy->distribute_dofs();
 
   // do some housekeeping: compress indices
@@ -2279,6 +2287,8 @@ void DoFHandler<dim, spacedim>::distribute_dofs(
       dynamic_cast<const parallel::DistributedTriangulationBase<dim, spacedim>
                      *>(&*this->tria) == nullptr)
     this->block_info_object.initialize(*this, false, true);
+
+  this->update_cell_dof_indices_cache();
 }
 
 
@@ -2372,6 +2382,100 @@ void DoFHandler<dim, spacedim>::clear_space()
 
   this->hp_cell_active_fe_indices.clear();
   this->hp_cell_future_fe_indices.clear();
+
+  this->clear_cell_dof_indices_cache();
+}
+
+
+
+template <int dim, int spacedim>
+DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
+void DoFHandler<dim, spacedim>::enable_cell_dof_indices_cache(
+  const bool enable)
+{
+  this->cell_dof_indices_cache_enabled = enable;
+  this->update_cell_dof_indices_cache();
+}
+
+
+
+template <int dim, int spacedim>
+DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
+void DoFHandler<dim, spacedim>::clear_cell_dof_indices_cache() const
+{
+  this->cell_dof_cache_ptr.clear();
+  this->cell_dof_cache_indices.clear();
+}
+
+
+
+template <int dim, int spacedim>
+DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
+void DoFHandler<dim, spacedim>::update_cell_dof_indices_cache()
+{
+  this->clear_cell_dof_indices_cache();
+
+  if (this->cell_dof_indices_cache_enabled == false ||
+      this->object_dof_indices.empty() || this->n_dofs() == 0)
+    return;
+
+  // first determine the range of each active cell within the cache
+  const unsigned int n_levels = this->tria->n_levels();
+  this->cell_dof_cache_ptr.resize(n_levels);
+  this->cell_dof_cache_indices.resize(n_levels);
+
+  std::vector<active_cell_iterator> cells;
+  cells.reserve(this->tria->n_active_cells());
+  for (const auto &cell : this->active_cell_iterators())
+    if (cell->is_artificial() == false)
+      {
+        std::vector<std::size_t> &ptr = this->cell_dof_cache_ptr[cell->level()];
+        if (ptr.empty())
+          ptr.resize(this->tria->n_raw_cells(cell->level()) + 1, 0);
+        ptr[cell->index() + 1] = cell->get_fe().n_dofs_per_cell();
+        cells.push_back(cell);
+      }
+
+  for (unsigned int level = 0; level < n_levels; ++level)
+    {
+      std::vector<std::size_t> &ptr = this->cell_dof_cache_ptr[level];
+      std::partial_sum(ptr.begin(), ptr.end(), ptr.begin());
+      if (ptr.size() > 0)
+        this->cell_dof_cache_indices[level].resize(ptr.back());
+    }
+
+  // then fill the cache by gathering the indices from the objects of each
+  // cell, which is independent for different cells
+  dealii::parallel::apply_to_subranges(
+    std::size_t(0),
+    cells.size(),
+    [&](const std::size_t begin, const std::size_t end) {
+      for (std::size_t i = begin; i < end; ++i)
+        {
+          const auto        &cell  = cells[i];
+          const unsigned int level = cell->level();
+          const std::size_t  first =
+            this->cell_dof_cache_ptr[level][cell->index()];
+          const std::size_t n_dofs =
+            this->cell_dof_cache_ptr[level][cell->index() + 1] - first;
+
+          internal::DoFAccessorImplementation::Implementation::
+            process_dof_indices(
+              *cell,
+              make_array_view(this->cell_dof_cache_indices[level].data() +
+                                first,
+                              this->cell_dof_cache_indices[level].data() +
+                                first + n_dofs),
+              cell->active_fe_index(),
+              internal::DoFAccessorImplementation::Implementation::
+                DoFIndexProcessor<dim, spacedim>(),
+              [](auto stored_index, auto dof_ptr) {
+                *dof_ptr = stored_index;
+              },
+              false);
+        }
+    },
+    128);
 }
 
 
@@ -2443,6 +2547,7 @@ void DoFHandler<dim, spacedim>::renumber_dofs(
       //}
 
       // do the renumbering
+      this->clear_cell_dof_indices_cache();
       this->number_cache = this->policy->renumber_dofs(new_numbers);
 
       // now re-compress the dof indices
@@ -2504,8 +2609,11 @@ void DoFHandler<dim, spacedim>::renumber_dofs(
                   "New DoF index is not less than the total number of dofs."));
         }
 
+      this->clear_cell_dof_indices_cache();
       this->number_cache = this->policy->renumber_dofs(new_numbers);
     }
+
+  this->update_cell_dof_indices_cache();
 }
 
 
@@ -2707,6 +2815,8 @@ void DoFHandler<dim, spacedim>::connect_to_triangulation_signals()
     [this]() { this->reinit(*(this->tria)); }));
   this->tria_listeners.push_back(
     this->tria->signals.clear.connect([this]() { this->clear(); }));
+  this->tria_listeners.push_back(this->tria->signals.post_refinement.connect(
+    [this]() { this->clear_cell_dof_indices_cache(); }));
 
   // attach corresponding callback functions dealing with the transfer of
   // active FE indices depending on the type of triangulation
@@ -15,6 +15,8 @@
 
 #include <deal.II/base/geometry_info.h>
 #include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/multithread_info.h>
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/partitioner.h>
 #include <deal.II/base/thread_management.h>
 #include <deal.II/base/types.h>
@@ -35,6 +37,7 @@
 #include <deal.II/grid/tria_iterator.h>
 
 #include <algorithm>
+#include <atomic>
 #include <limits>
 #include <memory>
 #include <numeric>
@@ -195,6 +198,191 @@ namespace internal
 
 
 
+      /**
+       * For all vertices, and all lines and quads that are of lower
+       * dimension than the cells, store the position of the first cell in
+       * a list of cells that has the object as one of its sub-objects. When
+       * enumerating DoFs by looping over the cells in the order of the
+       * list and giving every DoF that has not been enumerated yet the next
+       * free index, this is the cell that enumerates the DoFs on the
+       * object.
+       *
+       * The entries are atomic so that they can be filled by several
+       * threads working on different cells at the same time.
+       */
+      template <int dim>
+      struct FirstCellOnObjects
+      {
+        template <int spacedim>
+        FirstCellOnObjects(const dealii::Triangulation<dim, spacedim> &tria)
+        {
+          for (unsigned int d = 0; d < dim; ++d)
+            {
+              first_cell[d] = std::vector<std::atomic<unsigned int>>(
+                d == 0 ? tria.n_vertices() :
+                         (d == 1 ? tria.n_raw_lines() : tria.n_raw_quads()));
+              std::vector<std::atomic<unsigned int>> &entries =
+                first_cell[d];
+              dealii::parallel::apply_to_subranges(
+                0U,
+                static_cast<unsigned int>(entries.size()),
+                [&entries](const unsigned int begin,
+                           const unsigned int end) {
+                  for (unsigned int i = begin; i < end; ++i)
+                    entries[i].store(numbers::invalid_unsigned_int,
+                                     std::memory_order_relaxed);
+                },
+                4096);
+            }
+        }
+
+        /**
+         * Record that the cell at position @p cell_position has the
+         * object with index @p object_index and dimension @p structdim.
+         */
+        void
+        record(const unsigned int structdim,
+               const unsigned int object_index,
+               const unsigned int cell_position)
+        {
+          std::atomic<unsigned int> &entry =
+            first_cell[structdim][object_index];
+          unsigned int current = entry.load(std::memory_order_relaxed);
+          while (cell_position < current &&
+                 !entry.compare_exchange_weak(current,
+                                              cell_position,
+                                              std::memory_order_relaxed))
+            ;
+        }
+
+        /**
+         * Return whether the cell at position @p cell_position is the first
+         * one that has the object with index @p object_index and dimension
+         * @p structdim.
+         */
+        bool
+        is_first(const unsigned int structdim,
+                 const unsigned int object_index,
+                 const unsigned int cell_position) const
+        {
+          return first_cell[structdim][object_index].load(
+                   std::memory_order_relaxed) == cell_position;
+        }
+
+        std::array<std::vector<std::atomic<unsigned int>>, dim> first_cell;
+      };
+
+
+
+      /**
+       * A DoF operation for
+       * DoFAccessorImplementation::Implementation::process_dof_indices()
+       * that does not touch any DoF indices, but records in a
+       * FirstCellOnObjects object that the cell at position @p cell_position
+       * has the vertices, lines, and quads it is called for.
+       */
+      template <int dim>
+      struct FirstCellRecorder
+      {
+        template <typename DoFHandlerType, typename DoFProcessor>
+        void
+        process_vertex_dofs(DoFHandlerType &,
+                            const unsigned int vertex_index,
+                            const types::fe_index,
+                            types::global_dof_index *&,
+                            const DoFProcessor &) const
+        {
+          first_cell_on_objects.record(0, vertex_index, cell_position);
+        }
+
+        template <typename DoFHandlerType,
+                  int structdim,
+                  typename DoFMapping,
+                  typename DoFProcessor>
+        void
+        process_dofs(const DoFHandlerType &,
+                     const unsigned int,
+                     const unsigned int obj_index,
+                     const types::fe_index,
+                     const DoFMapping &,
+                     const std::integral_constant<int, structdim>,
+                     types::global_dof_index *&,
+                     const DoFProcessor &) const
+        {
+          if constexpr (structdim < dim)
+            first_cell_on_objects.record(structdim, obj_index, cell_position);
+        }
+
+        FirstCellOnObjects<dim> &first_cell_on_objects;
+        const unsigned int       cell_position;
+      };
+
+
+
+      /**
+       * A DoF operation for
+       * DoFAccessorImplementation::Implementation::process_dof_indices()
+       * that forwards to @p dof_operation only for those objects for which
+       * the cell at position @p cell_position is the first cell, plus the
+       * interior of the cell itself.
+       */
+      template <int dim, typename DoFOperation>
+      struct FirstCellDoFOperation
+      {
+        template <typename DoFHandlerType, typename DoFProcessor>
+        void
+        process_vertex_dofs(DoFHandlerType            &dof_handler,
+                            const unsigned int         vertex_index,
+                            const types::fe_index      fe_index,
+                            types::global_dof_index  *&dof_indices_ptr,
+                            const DoFProcessor        &dof_processor) const
+        {
+          if (first_cell_on_objects.is_first(0, vertex_index, cell_position))
+            dof_operation.process_vertex_dofs(dof_handler,
+                                              vertex_index,
+                                              fe_index,
+                                              dof_indices_ptr,
+                                              dof_processor);
+        }
+
+        template <typename DoFHandlerType,
+                  int structdim,
+                  typename DoFMapping,
+                  typename DoFProcessor>
+        void
+        process_dofs(const DoFHandlerType &dof_handler,
+                     const unsigned int    obj_level,
+                     const unsigned int    obj_index,
+                     const types::fe_index fe_index,
+                     const DoFMapping     &mapping,
+                     const std::integral_constant<int, structdim>,
+                     types::global_dof_index *&dof_indices_ptr,
+                     const DoFProcessor       &dof_processor) const
+        {
+          bool is_first = true;
+          if constexpr (structdim < dim)
+            is_first = first_cell_on_objects.is_first(structdim,
+                                                      obj_index,
+                                                      cell_position);
+          if (is_first)
+            dof_operation.process_dofs(
+              dof_handler,
+              obj_level,
+              obj_index,
+              fe_index,
+              mapping,
+              std::integral_constant<int, structdim>(),
+              dof_indices_ptr,
+              dof_processor);
+        }
+
+        const DoFOperation            &dof_operation;
+        const FirstCellOnObjects<dim> &first_cell_on_objects;
+        const unsigned int             cell_position;
+      };
+
+
+
       struct Implementation
       {
         /* -------------- distribute_dofs functionality ------------- */
@@ -1641,6 +1829,128 @@ namespace internal
 
 
 
+        /**
+         * Enumerate the DoFs on the given list of @p cells in the same way
+         * as a loop over the cells that gives every DoF that does not have
+         * a valid index yet the next free index, and return the number of
+         * DoFs enumerated. This is done in parallel in three steps: First,
+         * we determine for each vertex, line, and quad the first cell in
+         * the list it belongs to, i.e., the cell that enumerates its DoFs.
+         * Then, we count the DoFs each cell enumerates, and compute
+         * the first index of each cell by a prefix sum. Finally, all cells
+         * enumerate their DoFs independently of each other.
+         *
+         * @p dof_operation is the DoF operation passed to
+         * DoFAccessorImplementation::Implementation::process_dof_indices()
+         * to access the DoF indices stored for the objects of the cells.
+         *
+         * This function only works without hp-capabilities, where there is
+         * only one set of DoF indices for each object.
+         */
+        template <int dim, typename CellIteratorType, typename DoFOperation>
+        static types::global_dof_index
+        enumerate_dofs_on_cells_in_parallel(
+          const std::vector<CellIteratorType> &cells,
+          const DoFOperation                  &dof_operation,
+          const bool                           count_level_dofs)
+        {
+          const unsigned int n_cells   = cells.size();
+          const unsigned int grainsize = 128;
+          if (n_cells == 0)
+            return 0;
+
+          FirstCellOnObjects<dim> first_cell_on_objects(
+            cells[0]->get_triangulation());
+          dealii::parallel::apply_to_subranges(
+            0U,
+            n_cells,
+            [&](const unsigned int begin, const unsigned int end) {
+              for (unsigned int i = begin; i < end; ++i)
+                DoFAccessorImplementation::Implementation::process_dof_indices(
+                  *cells[i],
+                  std::make_tuple(),
+                  0,
+                  FirstCellRecorder<dim>{first_cell_on_objects, i},
+                  [](auto &, auto) {},
+                  count_level_dofs);
+            },
+            grainsize);
+
+          // count the DoFs that get enumerated on each cell, shifted by one
+          // to compute the first index of each cell by a prefix sum below
+          std::vector<types::global_dof_index> first_dof_index(n_cells + 1, 0);
+          dealii::parallel::apply_to_subranges(
+            0U,
+            n_cells,
+            [&](const unsigned int begin, const unsigned int end) {
+              for (unsigned int i = begin; i < end; ++i)
+                {
+                  types::global_dof_index n_dofs_on_cell = 0;
+                  DoFAccessorImplementation::Implementation::
+                    process_dof_indices(
+                      *cells[i],
+                      std::make_tuple(),
+                      0,
+                      FirstCellDoFOperation<dim, DoFOperation>{
+                        dof_operation, first_cell_on_objects, i},
+                      [&n_dofs_on_cell](auto &stored_index, auto) {
+                        if (stored_index == numbers::invalid_dof_index)
+                          ++n_dofs_on_cell;
+                      },
+                      count_level_dofs);
+                  first_dof_index[i + 1] = n_dofs_on_cell;
+                }
+            },
+            grainsize);
+
+          std::uint64_t n_dofs = 0;
+          for (unsigned int i = 0; i < n_cells; ++i)
+            {
+              n_dofs += first_dof_index[i + 1];
+              first_dof_index[i + 1] = n_dofs;
+            }
+          Assert(n_dofs <= std::numeric_limits<types::global_dof_index>::max(),
+                 ExcMessage(
+                   "You have reached the maximal number of degrees of "
+                   "freedom that can be stored in the chosen data "
+                   "type. In practice, this can only happen if you "
+                   "are using 32-bit data types. You will have to "
+                   "re-compile deal.II with the "
+                   "`DEAL_II_WITH_64BIT_INDICES' flag set to `ON'."));
+
+          dealii::parallel::apply_to_subranges(
+            0U,
+            n_cells,
+            [&](const unsigned int begin, const unsigned int end) {
+              for (unsigned int i = begin; i < end; ++i)
+                {
+                  types::global_dof_index next_free_dof = first_dof_index[i];
+                  DoFAccessorImplementation::Implementation::
+                    process_dof_indices(
+                      *cells[i],
+                      std::make_tuple(),
+                      0,
+                      FirstCellDoFOperation<dim, DoFOperation>{
+                        dof_operation, first_cell_on_objects, i},
+                      [&next_free_dof](auto &stored_index, auto) {
+                        if (stored_index == numbers::invalid_dof_index)
+                          {
+                            stored_index = next_free_dof;
+                            ++next_free_dof;
+                          }
+                      },
+                      count_level_dofs);
+                  Assert(next_free_dof == first_dof_index[i + 1],
+                         ExcInternalError());
+                }
+            },
+            grainsize);
+
+          return n_dofs;
+        }
+
+
+
         /**
          * Distribute degrees of freedom on all cells, or on cells with the
          * correct subdomain_id if the corresponding argument is not equal to
@@ -1655,6 +1965,28 @@ namespace internal
           Assert(dof_handler.get_triangulation().n_levels() > 0,
                  ExcMessage("Empty triangulation"));
 
+          // without hp-capabilities, enumerate the dofs in parallel if we
+          // can use several threads; this gives the same numbering as the
+          // loop below
+          if (dof_handler.hp_capability_enabled == false &&
+              MultithreadInfo::n_threads() > 1)
+            {
+              std::vector<
+                typename DoFHandler<dim, spacedim>::active_cell_iterator>
+                cells;
+              for (const auto &cell : dof_handler.active_cell_iterators())
+                if (!cell->is_artificial() &&
+                    ((subdomain_id == numbers::invalid_subdomain_id) ||
+                     (cell->subdomain_id() == subdomain_id)))
+                  cells.push_back(cell);
+
+              return enumerate_dofs_on_cells_in_parallel<dim>(
+                cells,
+                DoFAccessorImplementation::Implementation::
+                  DoFIndexProcessor<dim, spacedim>(),
+                false);
+            }
+
           // distribute dofs on all cells excluding artificial ones
           types::global_dof_index next_free_dof = 0;
 
@@ -1760,6 +2092,24 @@ namespace internal
           if (level >= tria.n_levels())
             return 0; // this is allowed for multigrid
 
+          if (MultithreadInfo::n_threads() > 1)
+            {
+              std::vector<
+                typename DoFHandler<dim, spacedim>::level_cell_iterator>
+                cells;
+              for (const auto &cell :
+                   dof_handler.cell_iterators_on_level(level))
+                if ((level_subdomain_id == numbers::invalid_subdomain_id) ||
+                    (cell->level_subdomain_id() == level_subdomain_id))
+                  cells.push_back(cell);
+
+              return enumerate_dofs_on_cells_in_parallel<dim>(
+                cells,
+                DoFAccessorImplementation::Implementation::
+                  MGDoFIndexProcessor<dim, spacedim>(level),
+                true);
+            }
+
           types::global_dof_index next_free_dof = 0;
 
           for (auto cell : dof_handler.cell_iterators_on_level(level))
@@ -12,6 +12,7 @@
 //
 // ------------------------------------------------------------------------
 
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/quadrature_lib.h>
 #include <deal.II/base/template_constraints.h>
 #include <deal.II/base/types.h>
@@ -1739,6 +1740,204 @@ namespace DoFRenumbering
 
 
 
+  namespace
+  {
+    /**
+     * Order the given @p cells with the (reverse) Cuthill-McKee algorithm
+     * applied to the graph of faces between them, and then number the
+     * degrees of freedom in @p owned_dofs cell by cell in this order. The
+     * function object @p cell_key maps each of the cells, and each of their
+     * neighbors, to a unique number less than @p n_keys. If @p level_cells
+     * is true, only neighbors on the same level are considered, otherwise
+     * only neighbors without children.
+     */
+    template <typename CellIteratorType, typename CellKeyType>
+    void
+    order_cells_and_dofs_Cuthill_McKee(
+      std::vector<types::global_dof_index> &new_dof_indices,
+      const std::vector<CellIteratorType>  &cells,
+      const unsigned int                    n_keys,
+      const CellKeyType                    &cell_key,
+      const bool                            level_cells,
+      const IndexSet                       &owned_dofs,
+      const bool                            reversed_numbering)
+    {
+      AssertDimension(new_dof_indices.size(), owned_dofs.n_elements());
+      const unsigned int n_cells = cells.size();
+      if (n_cells == 0)
+        return;
+
+      std::vector<unsigned int> position_of_key(n_keys,
+                                                numbers::invalid_unsigned_int);
+      for (unsigned int i = 0; i < n_cells; ++i)
+        position_of_key[cell_key(cells[i])] = i;
+
+      // find the neighbors of each cell, which involves most of the work
+      // with iterators and is done in parallel
+      std::vector<std::vector<unsigned int>> neighbors(n_cells);
+      parallel::apply_to_subranges(
+        0U,
+        n_cells,
+        [&](const unsigned int begin, const unsigned int end) {
+          for (unsigned int i = begin; i < end; ++i)
+            for (const unsigned int f : cells[i]->face_indices())
+              if (cells[i]->at_boundary(f) == false)
+                {
+                  const auto neighbor = cells[i]->neighbor(f);
+                  if (level_cells ? (neighbor->level() == cells[i]->level()) :
+                                    (neighbor->has_children() == false))
+                    {
+                      const unsigned int j =
+                        position_of_key[cell_key(neighbor)];
+                      if (j != numbers::invalid_unsigned_int)
+                        neighbors[i].push_back(j);
+                    }
+                }
+        },
+        64);
+
+      // a cell that is finer than its neighbor is only found from the finer
+      // side, so add the entries of the graph in both directions
+      DynamicSparsityPattern graph(n_cells, n_cells);
+      for (unsigned int i = 0; i < n_cells; ++i)
+        {
+          graph.add(i, i);
+          for (const unsigned int j : neighbors[i])
+            {
+              graph.add(i, j);
+              graph.add(j, i);
+            }
+        }
+
+      std::vector<DynamicSparsityPattern::size_type> new_cell_positions(
+        n_cells);
+      SparsityTools::reorder_Cuthill_McKee(graph, new_cell_positions);
+      if (reversed_numbering)
+        new_cell_positions = Utilities::reverse_permutation(new_cell_positions);
+
+      std::vector<CellIteratorType> ordered_cells(n_cells);
+      for (unsigned int i = 0; i < n_cells; ++i)
+        ordered_cells[new_cell_positions[i]] = cells[i];
+
+      // finally number the degrees of freedom when they are first
+      // encountered, keeping the order of the degrees of freedom that are
+      // first encountered on the same cell
+      std::vector<bool> already_numbered(owned_dofs.n_elements(), false);
+      std::vector<types::global_dof_index> cell_dofs;
+      types::global_dof_index              next_index = 0;
+      for (const auto &cell : ordered_cells)
+        {
+          cell_dofs.resize(cell->get_fe().n_dofs_per_cell());
+          cell->get_active_or_mg_dof_indices(cell_dofs);
+          std::sort(cell_dofs.begin(), cell_dofs.end());
+
+          for (const auto dof : cell_dofs)
+            {
+              const auto local_dof = owned_dofs.index_within_set(dof);
+              if (local_dof != numbers::invalid_dof_index &&
+                  !already_numbered[local_dof])
+                {
+                  already_numbered[local_dof] = true;
+                  new_dof_indices[local_dof] =
+                    owned_dofs.nth_index_in_set(next_index++);
+                }
+            }
+        }
+      Assert(next_index == owned_dofs.n_elements(),
+             ExcMessage("Traversing over the locally owned cells did not "
+                        "cover all locally owned degrees of freedom."));
+    }
+  } // namespace
+
+
+
+  template <int dim, int spacedim>
+  void
+  cell_graph_Cuthill_McKee(DoFHandler<dim, spacedim> &dof_handler,
+                           const bool                 reversed_numbering)
+  {
+    std::vector<types::global_dof_index> renumbering(
+      dof_handler.n_locally_owned_dofs());
+    compute_cell_graph_Cuthill_McKee(renumbering,
+                                     dof_handler,
+                                     reversed_numbering);
+
+    dof_handler.renumber_dofs(renumbering);
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  cell_graph_Cuthill_McKee(DoFHandler<dim, spacedim> &dof_handler,
+                           const unsigned int         level,
+                           const bool                 reversed_numbering)
+  {
+    Assert(dof_handler.n_dofs(level) != numbers::invalid_dof_index,
+           ExcDoFHandlerNotInitialized());
+
+    std::vector<types::global_dof_index> renumbering(
+      dof_handler.locally_owned_mg_dofs(level).n_elements());
+    compute_cell_graph_Cuthill_McKee(renumbering,
+                                     dof_handler,
+                                     reversed_numbering,
+                                     level);
+
+    dof_handler.renumber_dofs(level, renumbering);
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  compute_cell_graph_Cuthill_McKee(
+    std::vector<types::global_dof_index> &new_dof_indices,
+    const DoFHandler<dim, spacedim>      &dof_handler,
+    const bool                            reversed_numbering,
+    const unsigned int                    level)
+  {
+    const Triangulation<dim, spacedim> &tria = dof_handler.get_triangulation();
+
+    if (level == numbers::invalid_unsigned_int)
+      {
+        std::vector<typename DoFHandler<dim, spacedim>::active_cell_iterator>
+          cells;
+        for (const auto &cell : dof_handler.active_cell_iterators())
+          if (cell->is_locally_owned())
+            cells.push_back(cell);
+
+        order_cells_and_dofs_Cuthill_McKee(
+          new_dof_indices,
+          cells,
+          tria.n_active_cells(),
+          [](const auto &cell) { return cell->active_cell_index(); },
+          false,
+          dof_handler.locally_owned_dofs(),
+          reversed_numbering);
+      }
+    else
+      {
+        AssertIndexRange(level, tria.n_levels());
+
+        std::vector<typename DoFHandler<dim, spacedim>::level_cell_iterator>
+          cells;
+        for (const auto &cell : dof_handler.mg_cell_iterators_on_level(level))
+          if (cell->is_locally_owned_on_level())
+            cells.push_back(cell);
+
+        order_cells_and_dofs_Cuthill_McKee(
+          new_dof_indices,
+          cells,
+          tria.n_raw_cells(level),
+          [](const auto &cell) { return cell->index(); },
+          true,
+          dof_handler.locally_owned_mg_dofs(level),
+          reversed_numbering);
+      }
+  }
+
+
+
   template <int dim, int spacedim>
   void
   downstream(DoFHandler<dim, spacedim> &dof,
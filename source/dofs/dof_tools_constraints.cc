@@ -12,6 +12,7 @@
 //
 // ------------------------------------------------------------------------
 
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/table.h>
 #include <deal.II/base/template_constraints.h>
 #include <deal.II/base/utilities.h>
@@ -3073,6 +3074,162 @@ namespace DoFTools
               }
         }
     }
+
+
+    /**
+     * A version of make_hp_hanging_node_constraints() for DoFHandler objects
+     * without hp-capabilities. Since all cells then use the same finite
+     * element, only the first of the cases discussed there can occur, and
+     * the interpolation matrices from the faces to their children can be
+     * computed once up front. This allows us to compute the constraints of
+     * all cells in parallel. They are then entered into the
+     * AffineConstraints object in the order in which
+     * make_hp_hanging_node_constraints() would enter them, so that the
+     * result is the same.
+     */
+    template <int dim, int spacedim, typename number>
+    void
+    make_threaded_hanging_node_constraints(
+      const DoFHandler<dim, spacedim> &dof_handler,
+      AffineConstraints<number>       &constraints)
+    {
+      Assert(dof_handler.has_hp_capabilities() == false, ExcInternalError());
+
+      const FiniteElement<dim, spacedim> &fe = dof_handler.get_fe();
+      if (fe.compare_for_domination(fe, /*codim=*/1) ==
+          FiniteElementDomination::no_requirements)
+        return;
+
+      // find the cells with at least one refined face that carries degrees
+      // of freedom. artificial cells can at best neighbor ghost cells, but
+      // we're not interested in these interfaces
+      std::vector<typename DoFHandler<dim, spacedim>::active_cell_iterator>
+        cells;
+      unsigned int n_subfaces = 0;
+      for (const auto &cell : dof_handler.active_cell_iterators())
+        if (cell->is_artificial() == false)
+          {
+            bool has_refined_faces = false;
+            for (const unsigned int face : cell->face_indices())
+              if (cell->face(face)->has_children() &&
+                  (fe.n_dofs_per_face(face) > 0))
+                {
+                  has_refined_faces = true;
+                  n_subfaces =
+                    std::max(n_subfaces, cell->face(face)->n_children());
+                }
+            if (has_refined_faces)
+              cells.push_back(cell);
+          }
+      if (cells.empty())
+        return;
+
+      std::vector<std::unique_ptr<FullMatrix<double>>>
+        subface_interpolation_matrices(n_subfaces);
+      for (unsigned int c = 0; c < n_subfaces; ++c)
+        ensure_existence_of_subface_matrix(fe,
+                                           fe,
+                                           c,
+                                           subface_interpolation_matrices[c]);
+
+      // for each cell, compute the constraints of the dependent DoFs on its
+      // refined faces, in the same way as filter_constraints() does but
+      // without looking at the AffineConstraints object
+      using size_type = typename AffineConstraints<number>::size_type;
+      using ConstraintEntries =
+        std::pair<size_type, std::vector<std::pair<size_type, number>>>;
+      std::vector<std::vector<ConstraintEntries>> cell_constraints(
+        cells.size());
+
+      dealii::parallel::apply_to_subranges(
+        0U,
+        static_cast<unsigned int>(cells.size()),
+        [&](const unsigned int begin, const unsigned int end) {
+          std::vector<types::global_dof_index>                primary_dofs;
+          std::vector<types::global_dof_index>                dependent_dofs;
+          std::vector<std::pair<size_type, size_type>> sorted_primary_dofs;
+
+          for (unsigned int i = begin; i < end; ++i)
+            {
+              const auto &cell = cells[i];
+              for (const unsigned int face : cell->face_indices())
+                if (cell->face(face)->has_children() &&
+                    (fe.n_dofs_per_face(face) > 0))
+                  {
+                    Assert(cell->face(face)->refinement_case() ==
+                             RefinementCase<dim - 1>::isotropic_refinement,
+                           ExcNotImplemented());
+
+                    primary_dofs.resize(fe.n_dofs_per_face(face));
+                    cell->face(face)->get_dof_indices(primary_dofs);
+
+                    sorted_primary_dofs.clear();
+                    for (unsigned int j = 0; j < primary_dofs.size(); ++j)
+                      sorted_primary_dofs.emplace_back(primary_dofs[j], j);
+                    std::sort(sorted_primary_dofs.begin(),
+                              sorted_primary_dofs.end());
+
+                    for (unsigned int c = 0;
+                         c < cell->face(face)->n_children();
+                         ++c)
+                      {
+                        if (cell->neighbor_child_on_subface(face, c)
+                              ->is_artificial())
+                          continue;
+
+                        dependent_dofs.resize(fe.n_dofs_per_face(face, c));
+                        cell->face(face)->child(c)->get_dof_indices(
+                          dependent_dofs);
+
+                        const FullMatrix<double> &face_constraints =
+                          *subface_interpolation_matrices[c];
+                        AssertDimension(face_constraints.m(),
+                                        dependent_dofs.size());
+                        AssertDimension(face_constraints.n(),
+                                        primary_dofs.size());
+
+                        for (unsigned int row = 0; row < dependent_dofs.size();
+                             ++row)
+                          {
+                            // skip trivial constraints, see
+                            // filter_constraints()
+                            bool is_trivial_constraint = false;
+                            for (unsigned int j = 0; j < primary_dofs.size();
+                                 ++j)
+                              if (face_constraints(row, j) == 1.0 &&
+                                  dependent_dofs[row] == primary_dofs[j])
+                                {
+                                  is_trivial_constraint = true;
+                                  break;
+                                }
+                            if (is_trivial_constraint)
+                              continue;
+
+                            ConstraintEntries line;
+                            line.first = dependent_dofs[row];
+                            for (const auto &[dof_index, unsorted_index] :
+                                 sorted_primary_dofs)
+                              if (std::fabs(face_constraints(
+                                    row, unsorted_index)) >= 1e-14)
+                                line.second.emplace_back(
+                                  dof_index,
+                                  face_constraints(row, unsorted_index));
+                            cell_constraints[i].emplace_back(std::move(line));
+                          }
+                      }
+                  }
+            }
+        },
+        32);
+
+      // finally add the constraints, keeping the first one for each DoF
+      for (const auto &lines : cell_constraints)
+        for (const auto &[dependent_dof, entries] : lines)
+          if (constraints.is_constrained(dependent_dof) == false)
+            constraints.add_constraint(dependent_dof,
+                                       entries,
+                                       /* inhomogeneity= */ 0.);
+    }
   } // namespace internal
 
 
@@ -3097,7 +3254,13 @@ namespace DoFTools
       internal::make_hanging_node_constraints_nedelec(
         dof_handler, constraints, std::integral_constant<int, dim>());
     else if (dof_handler.get_fe_collection().hp_constraints_are_implemented())
-      internal::make_hp_hanging_node_constraints(dof_handler, constraints);
+      {
+        if (dof_handler.has_hp_capabilities())
+          internal::make_hp_hanging_node_constraints(dof_handler, constraints);
+        else
+          internal::make_threaded_hanging_node_constraints(dof_handler,
+                                                           constraints);
+      }
     else
       internal::make_oldstyle_hanging_node_constraints(
         dof_handler, constraints, std::integral_constant<int, dim>());
@@ -12,6 +12,7 @@
 //
 // ------------------------------------------------------------------------
 
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/quadrature_lib.h>
 #include <deal.II/base/table.h>
 #include <deal.II/base/template_constraints.h>
@@ -39,6 +40,8 @@
 #include <deal.II/hp/q_collection.h>
 
 #include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/sparsity_pattern.h>
 #include <deal.II/lac/sparsity_pattern_base.h>
 #include <deal.II/lac/vector.h>
 
@@ -122,6 +125,245 @@ namespace DoFTools
 
 
 
+  template <int dim, int spacedim, typename number>
+  void
+  make_exact_sparsity_pattern(const DoFHandler<dim, spacedim> &dof,
+                              SparsityPattern                 &sparsity,
+                              const AffineConstraints<number> &constraints,
+                              const bool keep_constrained_dofs,
+                              const types::subdomain_id subdomain_id)
+  {
+    const types::global_dof_index n_dofs = dof.n_dofs();
+
+    // elements that restrict the couplings within a cell are handled by the
+    // masked version of AffineConstraints::add_entries_local_to_global(),
+    // so go through the usual route via a DynamicSparsityPattern for them
+    const auto &fe_collection = dof.get_fe_collection();
+    for (unsigned int f = 0; f < fe_collection.size(); ++f)
+      if (fe_collection[f].get_local_dof_sparsity_pattern().empty() == false)
+        {
+          DynamicSparsityPattern dsp(n_dofs, n_dofs);
+          make_sparsity_pattern(
+            dof, dsp, constraints, keep_constrained_dofs, subdomain_id);
+          sparsity.copy_from(dsp);
+          return;
+        }
+
+    std::vector<typename DoFHandler<dim, spacedim>::active_cell_iterator>
+      cells;
+    for (const auto &cell : dof.active_cell_iterators())
+      if (((subdomain_id == numbers::invalid_subdomain_id) ||
+           (subdomain_id == cell->subdomain_id())) &&
+          cell->is_locally_owned())
+        cells.push_back(cell);
+    const unsigned int n_cells = cells.size();
+
+    // First pass: collect the degrees of freedom of each cell, and the
+    // sorted list of degrees of freedom they are written into once the
+    // constraints are resolved. These are the same sets that
+    // AffineConstraints::add_entries_local_to_global() computes, and each of
+    // the latter couples with every other one. Both lists are stored in
+    // compressed row format with one row per cell.
+    std::vector<std::size_t> local_dofs_ptr(n_cells + 1, 0);
+    for (unsigned int c = 0; c < n_cells; ++c)
+      local_dofs_ptr[c + 1] =
+        local_dofs_ptr[c] + cells[c]->get_fe().n_dofs_per_cell();
+    std::vector<types::global_dof_index> local_dofs(local_dofs_ptr.back());
+
+    const auto resolve_constraints =
+      [&](const unsigned int                    c,
+          std::vector<types::global_dof_index> &resolved_dofs) {
+        resolved_dofs.clear();
+        for (std::size_t i = local_dofs_ptr[c]; i < local_dofs_ptr[c + 1];
+             ++i)
+          if (constraints.is_constrained(local_dofs[i]))
+            {
+              for (const auto &entry :
+                   *constraints.get_constraint_entries(local_dofs[i]))
+                resolved_dofs.push_back(entry.first);
+            }
+          else
+            resolved_dofs.push_back(local_dofs[i]);
+        std::sort(resolved_dofs.begin(), resolved_dofs.end());
+        resolved_dofs.erase(std::unique(resolved_dofs.begin(),
+                                        resolved_dofs.end()),
+                            resolved_dofs.end());
+      };
+
+    std::vector<std::size_t> resolved_dofs_ptr(n_cells + 1, 0);
+    dealii::parallel::apply_to_subranges(
+      0U,
+      n_cells,
+      [&](const unsigned int begin, const unsigned int end) {
+        std::vector<types::global_dof_index> cell_dofs, resolved_dofs;
+        for (unsigned int c = begin; c < end; ++c)
+          {
+            cell_dofs.resize(local_dofs_ptr[c + 1] - local_dofs_ptr[c]);
+            cells[c]->get_dof_indices(cell_dofs);
+            std::copy(cell_dofs.begin(),
+                      cell_dofs.end(),
+                      local_dofs.begin() + local_dofs_ptr[c]);
+            resolve_constraints(c, resolved_dofs);
+            resolved_dofs_ptr[c + 1] = resolved_dofs.size();
+          }
+      },
+      64);
+    std::partial_sum(resolved_dofs_ptr.begin(),
+                     resolved_dofs_ptr.end(),
+                     resolved_dofs_ptr.begin());
+    std::vector<types::global_dof_index> resolved_dofs(
+      resolved_dofs_ptr.back());
+    dealii::parallel::apply_to_subranges(
+      0U,
+      n_cells,
+      [&](const unsigned int begin, const unsigned int end) {
+        std::vector<types::global_dof_index> cell_dofs;
+        for (unsigned int c = begin; c < end; ++c)
+          {
+            resolve_constraints(c, cell_dofs);
+            std::copy(cell_dofs.begin(),
+                      cell_dofs.end(),
+                      resolved_dofs.begin() + resolved_dofs_ptr[c]);
+          }
+      },
+      64);
+
+    // Then record for each row which lists of column indices contribute to
+    // it, as a pair of the cell index and the kind of list: the resolved
+    // degrees of freedom of the cell, and, if we keep constrained entries,
+    // the constrained degrees of freedom of the cell for all rows of the
+    // cell as well as all degrees of freedom of the cell for the constrained
+    // rows.
+    enum ContributionType : unsigned char
+    {
+      resolved_dofs_of_cell,
+      constrained_dofs_of_cell,
+      all_dofs_of_cell
+    };
+
+    const auto for_each_contribution = [&](const auto &operation) {
+      for (unsigned int c = 0; c < n_cells; ++c)
+        {
+          for (std::size_t i = resolved_dofs_ptr[c];
+               i < resolved_dofs_ptr[c + 1];
+               ++i)
+            operation(resolved_dofs[i], c, resolved_dofs_of_cell);
+
+          if (keep_constrained_dofs == false)
+            continue;
+
+          bool has_constrained_dofs = false;
+          for (std::size_t i = local_dofs_ptr[c]; i < local_dofs_ptr[c + 1];
+               ++i)
+            if (constraints.is_constrained(local_dofs[i]))
+              {
+                operation(local_dofs[i], c, all_dofs_of_cell);
+                has_constrained_dofs = true;
+              }
+          if (has_constrained_dofs)
+            for (std::size_t i = local_dofs_ptr[c];
+                 i < local_dofs_ptr[c + 1];
+                 ++i)
+              operation(local_dofs[i], c, constrained_dofs_of_cell);
+        }
+    };
+
+    std::vector<std::size_t> contributions_ptr(n_dofs + 1, 0);
+    for_each_contribution([&](const types::global_dof_index row,
+                              const unsigned int,
+                              const ContributionType) {
+      ++contributions_ptr[row + 1];
+    });
+    std::partial_sum(contributions_ptr.begin(),
+                     contributions_ptr.end(),
+                     contributions_ptr.begin());
+    std::vector<std::pair<unsigned int, ContributionType>> contributions(
+      contributions_ptr.back());
+    {
+      std::vector<std::size_t> next_contribution(contributions_ptr.begin(),
+                                                 contributions_ptr.end() - 1);
+      for_each_contribution([&](const types::global_dof_index row,
+                                const unsigned int            c,
+                                const ContributionType        type) {
+        contributions[next_contribution[row]++] = {c, type};
+      });
+    }
+
+    // Collect the sorted column indices of a row, including the diagonal
+    // entry which SparsityPattern always stores.
+    const auto collect_row = [&](const types::global_dof_index         row,
+                                 std::vector<types::global_dof_index> &cols) {
+      cols.clear();
+      cols.push_back(row);
+      for (std::size_t k = contributions_ptr[row];
+           k < contributions_ptr[row + 1];
+           ++k)
+        {
+          const unsigned int c = contributions[k].first;
+          switch (contributions[k].second)
+            {
+              case resolved_dofs_of_cell:
+                cols.insert(cols.end(),
+                            resolved_dofs.begin() + resolved_dofs_ptr[c],
+                            resolved_dofs.begin() + resolved_dofs_ptr[c + 1]);
+                break;
+              case all_dofs_of_cell:
+                cols.insert(cols.end(),
+                            local_dofs.begin() + local_dofs_ptr[c],
+                            local_dofs.begin() + local_dofs_ptr[c + 1]);
+                break;
+              case constrained_dofs_of_cell:
+                for (std::size_t i = local_dofs_ptr[c];
+                     i < local_dofs_ptr[c + 1];
+                     ++i)
+                  if (constraints.is_constrained(local_dofs[i]))
+                    cols.push_back(local_dofs[i]);
+                break;
+              default:
+                DEAL_II_ASSERT_UNREACHABLE();
+            }
+        }
+      std::sort(cols.begin(), cols.end());
+      cols.erase(std::unique(cols.begin(), cols.end()), cols.end());
+    };
+
+    // Second pass: compute the exact length of each row, allocate the
+    // sparsity pattern, and fill it. Different rows occupy disjoint parts of
+    // the column index array, so we can fill them concurrently.
+    std::vector<unsigned int> row_lengths(n_dofs);
+    dealii::parallel::apply_to_subranges(
+      types::global_dof_index(0),
+      n_dofs,
+      [&](const types::global_dof_index begin,
+          const types::global_dof_index end) {
+        std::vector<types::global_dof_index> cols;
+        for (types::global_dof_index row = begin; row < end; ++row)
+          {
+            collect_row(row, cols);
+            row_lengths[row] = cols.size();
+          }
+      },
+      256);
+
+    sparsity.reinit(n_dofs, n_dofs, row_lengths);
+    dealii::parallel::apply_to_subranges(
+      types::global_dof_index(0),
+      n_dofs,
+      [&](const types::global_dof_index begin,
+          const types::global_dof_index end) {
+        std::vector<types::global_dof_index> cols;
+        for (types::global_dof_index row = begin; row < end; ++row)
+          {
+            collect_row(row, cols);
+            sparsity.add_entries(row, cols.begin(), cols.end(), true);
+          }
+      },
+      256);
+    sparsity.compress();
+  }
+
+
+
   template <int dim, int spacedim, typename number>
   void
   make_sparsity_pattern(const DoFHandler<dim, spacedim> &dof,
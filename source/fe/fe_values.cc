@@ -33,6 +33,8 @@
 
 #include <deal.II/lac/vector.h>
 
+#include <deal.II/matrix_free/shape_info.h>
+
 #include <boost/container/small_vector.hpp>
 
 #include <iomanip>
@@ -264,6 +266,46 @@ FEValues<dim, spacedim>::initialize(const UpdateFlags update_flags)
   else
     this->mapping_data =
       std::make_unique<typename Mapping<dim, spacedim>::InternalDataBase>();
+
+  // for scalar elements of higher degree with tensor-product shape functions
+  // on a tensor-product quadrature formula, set up the data to evaluate
+  // finite element functions with sum factorization if their values or
+  // gradients are requested. this requires the one-dimensional formula to be
+  // the same in all directions
+  if ((update_flags & (update_values | update_gradients)) && dim > 1 &&
+      this->fe->n_components() == 1 && this->fe->degree >= 2 &&
+      quadrature.is_tensor_product() &&
+      internal::MatrixFreeFunctions::ShapeInfo<double>::is_supported(
+        *this->fe))
+    {
+      const std::array<Quadrature<1>, dim> &quad_array =
+        quadrature.get_tensor_basis();
+      bool same_formula_in_all_directions = true;
+      for (unsigned int d = 1; d < dim; ++d)
+        if (quad_array[d].get_points() != quad_array[0].get_points() ||
+            quad_array[d].get_weights() != quad_array[0].get_weights())
+          same_formula_in_all_directions = false;
+
+      if (same_formula_in_all_directions)
+        {
+          auto shape_info =
+            std::make_unique<internal::MatrixFreeFunctions::ShapeInfo<double>>(
+              quad_array[0], *this->fe);
+          const auto element_type = shape_info->element_type;
+          if ((element_type ==
+                 internal::MatrixFreeFunctions::tensor_symmetric_collocation ||
+               element_type ==
+                 internal::MatrixFreeFunctions::tensor_symmetric ||
+               element_type == internal::MatrixFreeFunctions::
+                                 tensor_symmetric_no_collocation ||
+               element_type ==
+                 internal::MatrixFreeFunctions::tensor_general) &&
+              shape_info->n_q_points == quadrature.size() &&
+              shape_info->lexicographic_numbering.size() ==
+                this->fe->n_dofs_per_cell())
+            this->tensor_product_shape_info = std::move(shape_info);
+        }
+    }
 }
 
 
@@ -33,11 +33,15 @@
 
 #include <deal.II/lac/vector.h>
 
+#include <deal.II/matrix_free/shape_info.h>
+#include <deal.II/matrix_free/tensor_product_kernels.h>
+
 #include <boost/container/small_vector.hpp>
 
 #include <iomanip>
 #include <memory>
 #include <type_traits>
+#include <utility>
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -706,6 +710,157 @@ namespace internal
               }
         }
   }
+
+
+
+  // Evaluate the values (for derivative_direction == numbers::invalid_
+  // unsigned_int) or the derivative in the given coordinate direction of a
+  // function with coefficients in lexicographic order in all points of a
+  // tensor-product quadrature formula, by sum factorization. The array
+  // 'scratch' needs to be large enough to hold two intermediate results.
+  template <int dim>
+  void
+  do_tensor_product_evaluation(
+    const dealii::internal::MatrixFreeFunctions::ShapeInfo<double> &shape_info,
+    const unsigned int derivative_direction,
+    const double      *dof_values,
+    double            *scratch,
+    double            *output)
+  {
+    const auto        &univariate_data = shape_info.data[0];
+    const unsigned int n_rows          = univariate_data.fe_degree + 1;
+    const unsigned int n_columns       = univariate_data.n_q_points_1d;
+
+    dealii::internal::EvaluatorTensorProduct<
+      dealii::internal::evaluate_general,
+      dim,
+      0,
+      0,
+      double>
+      eval(univariate_data.shape_values,
+           univariate_data.shape_gradients,
+           univariate_data.shape_hessians,
+           n_rows,
+           n_columns);
+
+    double *tmp0 = scratch;
+    double *tmp1 =
+      scratch + Utilities::fixed_power<dim>(std::max(n_rows, n_columns));
+
+    if constexpr (dim == 1)
+      {
+        if (derivative_direction == 0)
+          eval.template gradients<0, true, false>(dof_values, output);
+        else
+          eval.template values<0, true, false>(dof_values, output);
+      }
+    else if constexpr (dim == 2)
+      {
+        if (derivative_direction == 0)
+          eval.template gradients<0, true, false>(dof_values, tmp0);
+        else
+          eval.template values<0, true, false>(dof_values, tmp0);
+        if (derivative_direction == 1)
+          eval.template gradients<1, true, false>(tmp0, output);
+        else
+          eval.template values<1, true, false>(tmp0, output);
+      }
+    else if constexpr (dim == 3)
+      {
+        if (derivative_direction == 0)
+          eval.template gradients<0, true, false>(dof_values, tmp0);
+        else
+          eval.template values<0, true, false>(dof_values, tmp0);
+        if (derivative_direction == 1)
+          eval.template gradients<1, true, false>(tmp0, tmp1);
+        else
+          eval.template values<1, true, false>(tmp0, tmp1);
+        if (derivative_direction == 2)
+          eval.template gradients<2, true, false>(tmp1, output);
+        else
+          eval.template values<2, true, false>(tmp1, output);
+      }
+  }
+
+
+
+  // Like do_function_values() for scalar elements, but using sum
+  // factorization. The DoF values are given in the hierarchic numbering of
+  // the element.
+  template <int dim>
+  void
+  do_function_values_tensor_product(
+    const dealii::internal::MatrixFreeFunctions::ShapeInfo<double> &shape_info,
+    const ArrayView<const double> &dof_values,
+    std::vector<double>           &values)
+  {
+    const unsigned int n_dofs = dof_values.size();
+    AssertDimension(n_dofs, shape_info.lexicographic_numbering.size());
+    AssertDimension(values.size(), shape_info.n_q_points);
+
+    const unsigned int n_points_1d =
+      std::max(shape_info.data[0].fe_degree + 1,
+               shape_info.data[0].n_q_points_1d);
+    boost::container::small_vector<double, 200> scratch(
+      n_dofs + 2 * Utilities::fixed_power<dim>(n_points_1d));
+    for (unsigned int i = 0; i < n_dofs; ++i)
+      scratch[i] = dof_values[shape_info.lexicographic_numbering[i]];
+
+    do_tensor_product_evaluation<dim>(shape_info,
+                                      numbers::invalid_unsigned_int,
+                                      scratch.data(),
+                                      scratch.data() + n_dofs,
+                                      values.data());
+  }
+
+
+
+  // Like do_function_derivatives() for the gradients of scalar elements, but
+  // using sum factorization. The gradients on the reference cell are
+  // transformed to the real cell by the mapping in the same way as the
+  // gradients of the shape functions.
+  template <int dim, int spacedim>
+  void
+  do_function_gradients_tensor_product(
+    const dealii::internal::MatrixFreeFunctions::ShapeInfo<double> &shape_info,
+    const ArrayView<const double>                           &dof_values,
+    const Mapping<dim, spacedim>                            &mapping,
+    const typename Mapping<dim, spacedim>::InternalDataBase &mapping_data,
+    std::vector<Tensor<1, spacedim, double>>                &gradients)
+  {
+    const unsigned int n_dofs     = dof_values.size();
+    const unsigned int n_q_points = gradients.size();
+    AssertDimension(n_dofs, shape_info.lexicographic_numbering.size());
+    AssertDimension(n_q_points, shape_info.n_q_points);
+
+    const unsigned int n_points_1d =
+      std::max(shape_info.data[0].fe_degree + 1,
+               shape_info.data[0].n_q_points_1d);
+    boost::container::small_vector<double, 200> scratch(
+      n_dofs + 2 * Utilities::fixed_power<dim>(n_points_1d) + n_q_points);
+    for (unsigned int i = 0; i < n_dofs; ++i)
+      scratch[i] = dof_values[shape_info.lexicographic_numbering[i]];
+
+    double *derivative = scratch.data() + scratch.size() - n_q_points;
+    boost::container::small_vector<Tensor<1, dim>, 200> reference_gradients(
+      n_q_points);
+    for (unsigned int d = 0; d < dim; ++d)
+      {
+        do_tensor_product_evaluation<dim>(shape_info,
+                                          d,
+                                          scratch.data(),
+                                          scratch.data() + n_dofs,
+                                          derivative);
+        for (unsigned int q = 0; q < n_q_points; ++q)
+          reference_gradients[q][d] = derivative[q];
+      }
+
+    mapping.transform(make_array_view(reference_gradients.cbegin(),
+                                      reference_gradients.cend()),
+                      mapping_covariant,
+                      mapping_data,
+                      make_array_view(gradients));
+  }
 } // namespace internal
 
 
@@ -723,6 +878,19 @@ FEValuesBase<dim, spacedim>::get_function_values(
   Assert(present_cell.is_initialized(), ExcNotReinited());
   AssertDimension(fe_function.size(), present_cell.n_dofs_for_dof_handler());
 
+  if constexpr (std::is_same_v<Number, double>)
+    if (tensor_product_shape_info != nullptr)
+      {
+        // get function values of dofs on this cell
+        Vector<double> dof_values(dofs_per_cell);
+        present_cell.get_interpolated_dof_values(fe_function, dof_values);
+        internal::do_function_values_tensor_product<dim>(
+          *tensor_product_shape_info,
+          make_array_view(dof_values.begin(), dof_values.end()),
+          values);
+        return;
+      }
+
   // get function values of dofs on this cell
   Vector<Number> dof_values(dofs_per_cell);
   present_cell.get_interpolated_dof_values(fe_function, dof_values);
@@ -750,6 +918,13 @@ FEValuesBase<dim, spacedim>::get_function_values(
   boost::container::small_vector<Number, 200> dof_values(dofs_per_cell);
   auto view = make_array_view(dof_values.begin(), dof_values.end());
   fe_function.extract_subvector_to(indices, view);
+  if constexpr (std::is_same_v<Number, double>)
+    if (tensor_product_shape_info != nullptr)
+      {
+        internal::do_function_values_tensor_product<dim>(
+          *tensor_product_shape_info, view, values);
+        return;
+      }
   internal::do_function_values(view,
                                this->finite_element_output.shape_values,
                                values);
@@ -858,6 +1033,21 @@ FEValuesBase<dim, spacedim>::get_function_gradients(
   Assert(present_cell.is_initialized(), ExcNotReinited());
   AssertDimension(fe_function.size(), present_cell.n_dofs_for_dof_handler());
 
+  if constexpr (std::is_same_v<Number, double>)
+    if (tensor_product_shape_info != nullptr)
+      {
+        // get function values of dofs on this cell
+        Vector<double> dof_values(dofs_per_cell);
+        present_cell.get_interpolated_dof_values(fe_function, dof_values);
+        internal::do_function_gradients_tensor_product(
+          *tensor_product_shape_info,
+          make_array_view(dof_values.begin(), dof_values.end()),
+          *this->mapping,
+          *this->mapping_data,
+          gradients);
+        return;
+      }
+
   // get function values of dofs on this cell
   Vector<Number> dof_values(dofs_per_cell);
   present_cell.get_interpolated_dof_values(fe_function, dof_values);
@@ -885,6 +1075,17 @@ FEValuesBase<dim, spacedim>::get_function_gradients(
   boost::container::small_vector<Number, 200> dof_values(dofs_per_cell);
   auto view = make_array_view(dof_values.begin(), dof_values.end());
   fe_function.extract_subvector_to(indices, view);
+  if constexpr (std::is_same_v<Number, double>)
+    if (tensor_product_shape_info != nullptr)
+      {
+        internal::do_function_gradients_tensor_product(
+          *tensor_product_shape_info,
+          view,
+          *this->mapping,
+          *this->mapping_data,
+          gradients);
+        return;
+      }
   internal::do_function_derivatives(view,
                                     this->finite_element_output.shape_gradients,
                                     gradients);
@@ -877,7 +877,31 @@ MappingQ<dim, spacedim>::fill_fe_values(
        cell_similarity :
        CellSimilarity::none);
 
-  if (dim > 1 && data.tensor_product_quadrature)
+  // for a linear mapping on a cell that is the affine image of the
+  // reference cell, the Jacobian is constant and we can skip the evaluation
+  // of the mapping at all quadrature points, unless derivatives of the
+  // Jacobian are requested
+  DerivativeForm<1, dim, spacedim> affine_jacobian;
+  if (polynomial_degree == 1 &&
+      !(data.update_each &
+        (update_jacobian_grads | update_jacobian_pushed_forward_grads |
+         update_jacobian_2nd_derivatives |
+         update_jacobian_pushed_forward_2nd_derivatives |
+         update_jacobian_3rd_derivatives |
+         update_jacobian_pushed_forward_3rd_derivatives)) &&
+      internal::MappingQImplementation::compute_affine_jacobian<dim, spacedim>(
+        data.mapping_support_points, affine_jacobian))
+    {
+      internal::MappingQImplementation::update_q_points_Jacobians_affine<
+        dim,
+        spacedim>(affine_jacobian,
+                  data,
+                  make_array_view(quadrature.get_points()),
+                  output_data.quadrature_points,
+                  output_data.jacobians,
+                  output_data.inverse_jacobians);
+    }
+  else if (dim > 1 && data.tensor_product_quadrature)
     {
       internal::MappingQImplementation::
         maybe_update_q_points_Jacobians_and_grads_tensor<dim, spacedim>(
@@ -46,6 +46,7 @@ template <int dim, int spacedim>
 MappingQCache<dim, spacedim>::MappingQCache(
   const MappingQCache<dim, spacedim> &mapping)
   : MappingQ<dim, spacedim>(mapping)
+  , on_demand_cache(mapping.on_demand_cache)
   , support_point_cache(mapping.support_point_cache)
   , uses_level_info(mapping.uses_level_info)
 {}
@@ -141,6 +142,7 @@ MappingQCache<dim, spacedim>::initialize(
     const typename Triangulation<dim, spacedim>::cell_iterator &)>
     &compute_points_on_cell)
 {
+  on_demand_cache.reset();
   clear_signal.disconnect();
   clear_signal = triangulation.signals.any_change.connect(
     [&]() -> void { this->support_point_cache.reset(); });
@@ -178,6 +180,118 @@ MappingQCache<dim, spacedim>::initialize(
 
 
 
+template <int dim, int spacedim>
+void
+MappingQCache<dim, spacedim>::initialize_on_demand(
+  const Mapping<dim, spacedim>       &mapping,
+  const Triangulation<dim, spacedim> &triangulation)
+{
+  const auto mapping_q =
+    dynamic_cast<const MappingQ<dim, spacedim> *>(&mapping);
+  if (mapping_q != nullptr && this->get_degree() == mapping_q->get_degree())
+    {
+      this->initialize_on_demand(
+        triangulation,
+        [mapping_q](
+          const typename Triangulation<dim, spacedim>::cell_iterator &cell) {
+          return mapping_q->compute_mapping_support_points(cell);
+        });
+    }
+  else
+    {
+      // The FEValues objects evaluating the mapping are created on each
+      // thread the first time it requests points. They are kept alive by the
+      // function stored in the cache.
+      const QGaussLobatto<dim> quadrature_gl(this->polynomial_degree + 1);
+      std::vector<Point<dim>>  quadrature_points;
+      for (const auto i : FETools::hierarchic_to_lexicographic_numbering<dim>(
+             this->polynomial_degree))
+        quadrature_points.push_back(quadrature_gl.point(i));
+      const Quadrature<dim> quadrature(quadrature_points);
+
+      using FEValuesStorage =
+        Threads::ThreadLocalStorage<std::unique_ptr<FEValues<dim, spacedim>>>;
+      const auto fe            = std::make_shared<FE_Nothing<dim, spacedim>>();
+      const auto fe_values_all = std::make_shared<FEValuesStorage>();
+
+      this->initialize_on_demand(
+        triangulation,
+        [&mapping, quadrature, fe, fe_values_all](
+          const typename Triangulation<dim, spacedim>::cell_iterator &cell) {
+          auto &fe_values = fe_values_all->get();
+          if (fe_values.get() == nullptr)
+            fe_values = std::make_unique<FEValues<dim, spacedim>>(
+              mapping, *fe, quadrature, update_quadrature_points);
+
+          fe_values->reinit(cell);
+          return fe_values->get_quadrature_points();
+        });
+    }
+}
+
+
+
+template <int dim, int spacedim>
+void
+MappingQCache<dim, spacedim>::initialize_on_demand(
+  const Triangulation<dim, spacedim> &triangulation,
+  const std::function<std::vector<Point<spacedim>>(
+    const typename Triangulation<dim, spacedim>::cell_iterator &)>
+    &compute_points_on_cell)
+{
+  clear_signal.disconnect();
+
+  on_demand_cache                         = std::make_shared<OnDemandCache>();
+  on_demand_cache->compute_points_on_cell = compute_points_on_cell;
+  on_demand_cache->reinit(triangulation);
+
+  // The connection is owned by the shared cache, such that the cache of all
+  // copies of this object gets cleared upon a change of the triangulation
+  on_demand_cache->clear_signal = triangulation.signals.any_change.connect(
+    [cache = on_demand_cache.get(), &triangulation]() -> void {
+      cache->reinit(triangulation);
+    });
+
+  // Let the point cache of the base class refer to the points held by the
+  // on-demand cache
+  support_point_cache =
+    std::shared_ptr<std::vector<std::vector<std::vector<Point<spacedim>>>>>(
+      on_demand_cache, &on_demand_cache->support_points);
+
+  uses_level_info = true;
+}
+
+
+
+template <int dim, int spacedim>
+MappingQCache<dim, spacedim>::OnDemandCache::~OnDemandCache()
+{
+  clear_signal.disconnect();
+}
+
+
+
+template <int dim, int spacedim>
+void
+MappingQCache<dim, spacedim>::OnDemandCache::reinit(
+  const Triangulation<dim, spacedim> &triangulation)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+
+  support_points.clear();
+  support_points.resize(triangulation.n_levels());
+  is_computed.clear();
+  is_computed.resize(triangulation.n_levels());
+  for (unsigned int l = 0; l < triangulation.n_levels(); ++l)
+    {
+      support_points[l].resize(triangulation.n_raw_cells(l));
+      is_computed[l] =
+        std::make_unique<std::atomic<bool>[]>(triangulation.n_raw_cells(l));
+    }
+}
+
+
+
 template <int dim, int spacedim>
 void
 MappingQCache<dim, spacedim>::initialize(
@@ -717,15 +831,7 @@ std::vector<Point<spacedim>>
 MappingQCache<dim, spacedim>::compute_mapping_support_points(
   const typename Triangulation<dim, spacedim>::cell_iterator &cell) const
 {
-  Assert(support_point_cache.get() != nullptr,
-         ExcMessage("Must call MappingQCache::initialize() before "
-                    "using it or after mesh has changed!"));
-
-  Assert(uses_level_info || cell->is_active(), ExcInternalError());
-
-  AssertIndexRange(cell->level(), support_point_cache->size());
-  AssertIndexRange(cell->index(), (*support_point_cache)[cell->level()].size());
-  return (*support_point_cache)[cell->level()][cell->index()];
+  return get_support_points(cell);
 }
 
 
@@ -740,6 +846,23 @@ boost::container::small_vector<Point<spacedim>,
                                >
 MappingQCache<dim, spacedim>::get_vertices(
   const typename Triangulation<dim, spacedim>::cell_iterator &cell) const
+{
+  const auto ptr = get_support_points(cell).begin();
+  return boost::container::small_vector<Point<spacedim>,
+#ifndef _MSC_VER
+                                        ReferenceCells::max_n_vertices<dim>()
+#else
+                                        GeometryInfo<dim>::vertices_per_cell
+#endif
+                                        >(ptr, ptr + cell->n_vertices());
+}
+
+
+
+template <int dim, int spacedim>
+const std::vector<Point<spacedim>> &
+MappingQCache<dim, spacedim>::get_support_points(
+  const typename Triangulation<dim, spacedim>::cell_iterator &cell) const
 {
   Assert(support_point_cache.get() != nullptr,
          ExcMessage("Must call MappingQCache::initialize() before "
@@ -749,14 +872,33 @@ MappingQCache<dim, spacedim>::get_vertices(
 
   AssertIndexRange(cell->level(), support_point_cache->size());
   AssertIndexRange(cell->index(), (*support_point_cache)[cell->level()].size());
-  const auto ptr = (*support_point_cache)[cell->level()][cell->index()].begin();
-  return boost::container::small_vector<Point<spacedim>,
-#ifndef _MSC_VER
-                                        ReferenceCells::max_n_vertices<dim>()
-#else
-                                        GeometryInfo<dim>::vertices_per_cell
-#endif
-                                        >(ptr, ptr + cell->n_vertices());
+  std::vector<Point<spacedim>> &points =
+    (*support_point_cache)[cell->level()][cell->index()];
+
+  if (on_demand_cache.get() != nullptr)
+    {
+      // Compute the points outside of the lock, such that several threads
+      // can fill different cells concurrently. In the rare case that two
+      // threads compute the same cell, the result of the first one is kept.
+      std::atomic<bool> &is_computed =
+        on_demand_cache->is_computed[cell->level()][cell->index()];
+      if (is_computed.load(std::memory_order_acquire) == false)
+        {
+          std::vector<Point<spacedim>> new_points =
+            on_demand_cache->compute_points_on_cell(cell);
+          AssertDimension(new_points.size(),
+                          Utilities::pow(this->get_degree() + 1, dim));
+
+          std::lock_guard<std::mutex> lock(on_demand_cache->mutex);
+          if (is_computed.load(std::memory_order_relaxed) == false)
+            {
+              points = std::move(new_points);
+              is_computed.store(true, std::memory_order_release);
+            }
+        }
+    }
+
+  return points;
 }
 
 
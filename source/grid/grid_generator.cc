@@ -2645,6 +2645,246 @@ namespace GridGenerator
 
 
 
+  namespace
+  {
+    /**
+     * Split @p n_processes processes into a grid of processes with one
+     * entry per coordinate direction, such that the boxes of cells resulting
+     * from splitting @p repetitions cells in each direction are as close to
+     * cubes as possible. Prime factors of @p n_processes are assigned
+     * greedily, largest first, to the direction with the most cells per
+     * process.
+     */
+    template <int dim>
+    std::array<unsigned int, dim>
+    compute_process_grid(const std::vector<unsigned int> &repetitions,
+                         const unsigned int               n_processes)
+    {
+      std::vector<unsigned int> factors;
+      unsigned int              n = n_processes;
+      for (unsigned int p = 2; p * p <= n; ++p)
+        while (n % p == 0)
+          {
+            factors.push_back(p);
+            n /= p;
+          }
+      if (n > 1)
+        factors.push_back(n);
+      std::sort(factors.rbegin(), factors.rend());
+
+      std::array<unsigned int, dim> process_grid;
+      std::fill(process_grid.begin(), process_grid.end(), 1U);
+      for (const unsigned int factor : factors)
+        {
+          unsigned int best = 0;
+          for (unsigned int d = 1; d < dim; ++d)
+            if (static_cast<double>(repetitions[d]) / process_grid[d] >
+                static_cast<double>(repetitions[best]) / process_grid[best])
+              best = d;
+          process_grid[best] *= factor;
+        }
+      return process_grid;
+    }
+  } // namespace
+
+
+
+  template <int dim, int spacedim>
+  TriangulationDescription::Description<dim, spacedim>
+  subdivided_hyper_rectangle_description(
+    const std::vector<unsigned int> &repetitions,
+    const Point<dim>                &p_1,
+    const Point<dim>                &p_2,
+    const MPI_Comm                   comm,
+    const bool                       colorize,
+    const typename Triangulation<dim, spacedim>::MeshSmoothing smoothing,
+    const TriangulationDescription::Settings                   settings)
+  {
+    Assert(repetitions.size() == dim, ExcInvalidRepetitionsDimension(dim));
+
+    TriangulationDescription::Description<dim, spacedim> description;
+    description.comm     = comm;
+    description.settings = settings;
+    description.smoothing =
+      (settings &
+       TriangulationDescription::Settings::construct_multigrid_hierarchy) ?
+        static_cast<typename Triangulation<dim, spacedim>::MeshSmoothing>(
+          smoothing |
+          Triangulation<dim, spacedim>::limit_level_difference_at_vertices) :
+        smoothing;
+
+    // Normalize the corner points and compute the cell sizes in the same
+    // way as the serial function, so that the vertex locations are
+    // bit-for-bit identical.
+    Point<spacedim>                  p1;
+    std::array<Point<spacedim>, dim> delta;
+    for (unsigned int d = 0; d < dim; ++d)
+      {
+        Assert(repetitions[d] >= 1, ExcInvalidRepetitions(repetitions[d]));
+
+        p1[d]       = std::min(p_1[d], p_2[d]);
+        delta[d][d] = (std::max(p_1[d], p_2[d]) - p1[d]) / repetitions[d];
+        Assert(
+          delta[d][d] > 0.0,
+          ExcMessage(
+            "The first dim entries of coordinates of p1 and p2 need to be different."));
+      }
+
+    // Find the box of cells owned by the current process, and the box of
+    // locally relevant cells, i.e., the owned cells plus one layer of ghost
+    // cells around them. Both are described by half-open index ranges
+    // [begin, end) in each coordinate direction.
+    const unsigned int n_processes = Utilities::MPI::n_mpi_processes(comm);
+    const unsigned int my_rank     = Utilities::MPI::this_mpi_process(comm);
+    const std::array<unsigned int, dim> process_grid =
+      compute_process_grid<dim>(repetitions, n_processes);
+
+    const auto first_cell_of_process = [&](const unsigned int d,
+                                           const unsigned int p) {
+      return static_cast<unsigned int>(
+        (static_cast<std::uint64_t>(p) * repetitions[d]) / process_grid[d]);
+    };
+    const auto owner_of_cell = [&](const unsigned int d, const unsigned int x) {
+      return static_cast<unsigned int>(
+        ((static_cast<std::uint64_t>(x) + 1) * process_grid[d] - 1) /
+        repetitions[d]);
+    };
+
+    std::array<unsigned int, dim> relevant_begin, relevant_end;
+    unsigned int                  process_index = my_rank;
+    for (unsigned int d = 0; d < dim; ++d)
+      {
+        const unsigned int p = process_index % process_grid[d];
+        process_index /= process_grid[d];
+
+        // processes whose box is empty in some direction do not own any
+        // cells
+        const unsigned int owned_begin = first_cell_of_process(d, p);
+        const unsigned int owned_end   = first_cell_of_process(d, p + 1);
+        if (owned_begin == owned_end)
+          return description;
+
+        relevant_begin[d] = (owned_begin > 0 ? owned_begin - 1 : 0);
+        relevant_end[d]   = std::min(owned_end + 1, repetitions[d]);
+      }
+
+    // Create the locally relevant vertices, in lexicographic order.
+    std::array<unsigned int, 3> n_cells          = {{1, 1, 1}};
+    std::array<unsigned int, 3> n_local_vertices = {{1, 1, 1}};
+    for (unsigned int d = 0; d < dim; ++d)
+      {
+        n_cells[d]          = relevant_end[d] - relevant_begin[d];
+        n_local_vertices[d] = n_cells[d] + 1;
+      }
+
+    description.coarse_cell_vertices.reserve(
+      n_local_vertices[0] * n_local_vertices[1] * n_local_vertices[2]);
+    for (unsigned int z = 0; z < n_local_vertices[2]; ++z)
+      for (unsigned int y = 0; y < n_local_vertices[1]; ++y)
+        for (unsigned int x = 0; x < n_local_vertices[0]; ++x)
+          {
+            const std::array<unsigned int, 3> local_index = {{x, y, z}};
+            Point<spacedim>                   vertex      = p1;
+            for (unsigned int d = 0; d < dim; ++d)
+              vertex += (relevant_begin[d] + local_index[d]) * delta[d];
+            description.coarse_cell_vertices.push_back(vertex);
+          }
+
+    // Then create the locally relevant cells, again in lexicographic order,
+    // which is also the order of their coarse cell ids.
+    const unsigned int n_relevant_cells = n_cells[0] * n_cells[1] * n_cells[2];
+    description.coarse_cells.reserve(n_relevant_cells);
+    description.coarse_cell_index_to_coarse_cell_id.reserve(n_relevant_cells);
+    description.cell_infos.resize(1);
+    description.cell_infos[0].reserve(n_relevant_cells);
+
+    for (unsigned int z = 0; z < n_cells[2]; ++z)
+      for (unsigned int y = 0; y < n_cells[1]; ++y)
+        for (unsigned int x = 0; x < n_cells[0]; ++x)
+          {
+            const std::array<unsigned int, 3> local_index = {{x, y, z}};
+
+            std::array<unsigned int, dim> global_index;
+            types::coarse_cell_id         coarse_cell_id = 0;
+            types::subdomain_id           owner          = 0;
+            for (int d = dim - 1; d >= 0; --d)
+              {
+                global_index[d] = relevant_begin[d] + local_index[d];
+                coarse_cell_id =
+                  coarse_cell_id * repetitions[d] + global_index[d];
+                owner =
+                  owner * process_grid[d] + owner_of_cell(d, global_index[d]);
+              }
+
+            // vertices, numbered as in the serial function
+            dealii::CellData<dim> cell;
+            for (const unsigned int v : GeometryInfo<dim>::vertex_indices())
+              {
+                unsigned int vertex_index = 0;
+                for (int d = dim - 1; d >= 0; --d)
+                  vertex_index = vertex_index * n_local_vertices[d] +
+                                 local_index[d] + ((v >> d) & 1);
+                cell.vertices[v] = vertex_index;
+              }
+
+            // material ids, as set by colorize_subdivided_hyper_rectangle()
+            cell.material_id = 0;
+            if (colorize)
+              for (unsigned int d = 0; d < dim; ++d)
+                if (p1[d] + (global_index[d] + 0.5) * delta[d][d] > 0)
+                  cell.material_id += (1 << d);
+
+            description.coarse_cells.push_back(cell);
+            description.coarse_cell_index_to_coarse_cell_id.push_back(
+              coarse_cell_id);
+
+            TriangulationDescription::CellData<dim> cell_info;
+            cell_info.id = CellId(coarse_cell_id, {}).template to_binary<dim>();
+            cell_info.subdomain_id       = owner;
+            cell_info.level_subdomain_id = owner;
+
+            // boundary faces: face 2*d is the lower and face 2*d+1 the upper
+            // one in direction d, which is also the boundary id the face gets
+            // when colorizing (and always in 1d)
+            for (unsigned int d = 0; d < dim; ++d)
+              {
+                if (global_index[d] == 0)
+                  cell_info.boundary_ids.emplace_back(
+                    2 * d, (colorize || dim == 1) ? 2 * d : 0);
+                if (global_index[d] + 1 == repetitions[d])
+                  cell_info.boundary_ids.emplace_back(
+                    2 * d + 1, (colorize || dim == 1) ? 2 * d + 1 : 0);
+              }
+
+            description.cell_infos[0].push_back(cell_info);
+          }
+
+    return description;
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  subdivided_hyper_rectangle(
+    parallel::fullydistributed::Triangulation<dim, spacedim> &tria,
+    const std::vector<unsigned int>                          &repetitions,
+    const Point<dim>                                         &p1,
+    const Point<dim>                                         &p2,
+    const bool                                                colorize)
+  {
+    tria.create_triangulation(
+      subdivided_hyper_rectangle_description<dim, spacedim>(
+        repetitions,
+        p1,
+        p2,
+        tria.get_mpi_communicator(),
+        colorize,
+        tria.get_mesh_smoothing()));
+  }
+
+
+
   template <int dim>
   void
   subdivided_hyper_rectangle(Triangulation<dim>                     &tria,
@@ -17,9 +17,12 @@
 #include <deal.II/base/patterns.h>
 #include <deal.II/base/utilities.h>
 
+#include <deal.II/distributed/fully_distributed_tria.h>
+
 #include <deal.II/grid/grid_in.h>
 #include <deal.II/grid/grid_tools.h>
 #include <deal.II/grid/tria.h>
+#include <deal.II/grid/tria_description.h>
 
 #include <boost/algorithm/string.hpp>
 #include <boost/archive/binary_iarchive.hpp>
@@ -32,7 +35,6 @@
 #  include <deal.II/base/config.h>
 
 #  include <deal.II/grid/cell_id.h>
-#  include <deal.II/grid/tria_description.h>
 
 #  include <gmsh.h>
 #endif
@@ -795,7 +797,58 @@ GridIn<dim, spacedim>::read_vtu(std::istream &in)
     Utilities::decompress({decoded.begin(), decoded.end()});
   std::istringstream              in_stream(string_archive);
   boost::archive::binary_iarchive ia(in_stream);
-  tria->load(ia, 0);
+
+  // Files written for a distributed triangulation contain the description of
+  // the part of the mesh relevant to the process that wrote it, rather than
+  // a serialized triangulation
+  const auto content =
+    tree.get_optional<std::string>("VTKFile.dealiiData.<xmlattr>.content");
+  if (content && *content == "description")
+    {
+      auto *parallel_tria =
+        dynamic_cast<parallel::fullydistributed::Triangulation<dim, spacedim>
+                       *>(tria.get());
+      AssertThrow(
+        parallel_tria != nullptr,
+        ExcMessage(
+          "This VTU file has been written for one process of a distributed "
+          "triangulation and can only be read into a "
+          "parallel::fullydistributed::Triangulation."));
+
+      TriangulationDescription::Description<dim, spacedim> description;
+      ia >> description;
+      description.comm = parallel_tria->get_mpi_communicator();
+      parallel_tria->create_triangulation(description);
+    }
+  else
+    tria->load(ia, 0);
+}
+
+
+
+template <int dim, int spacedim>
+void
+GridIn<dim, spacedim>::read_partitioned_vtu(const std::string &file_prefix)
+{
+  auto *parallel_tria =
+    dynamic_cast<parallel::fullydistributed::Triangulation<dim, spacedim> *>(
+      tria.get());
+  AssertThrow(parallel_tria != nullptr,
+              ExcMessage("Triangulation is not fully distributed!"));
+
+  // Every process only opens and parses its own file, so neither the time
+  // nor the memory needed here depends on the size of the global mesh.
+  const MPI_Comm     mpi_comm = parallel_tria->get_mpi_communicator();
+  const unsigned int rank     = Utilities::MPI::this_mpi_process(mpi_comm);
+  const std::string  fname =
+    (Utilities::MPI::n_mpi_processes(mpi_comm) == 1 ?
+       file_prefix + ".vtu" :
+       file_prefix + "_" + std::to_string(rank + 1) + ".vtu");
+
+  std::ifstream in(fname);
+  AssertThrow(in.is_open(), ExcMessage("Missing mesh file: " + fname));
+
+  read_vtu(in);
 }
 
 
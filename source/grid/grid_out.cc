@@ -26,6 +26,7 @@
 #include <deal.II/grid/grid_out.h>
 #include <deal.II/grid/tria.h>
 #include <deal.II/grid/tria_accessor.h>
+#include <deal.II/grid/tria_description.h>
 #include <deal.II/grid/tria_iterator.h>
 
 #include <deal.II/numerics/data_out.h>
@@ -3574,10 +3575,30 @@ GridOut::write_vtu(const Triangulation<dim, spacedim> &tria,
   if (vtu_flags.serialize_triangulation)
     {
       out << " </UnstructuredGrid>\n";
-      out << "<dealiiData  encoding=\"base64\">";
       std::stringstream               outstring;
       boost::archive::binary_oarchive ia(outstring);
-      tria.save(ia, 0);
+      // If requested, store the description of the part of a distributed
+      // triangulation that is relevant to the current process rather than
+      // the triangulation itself, from which GridIn::read_vtu() can create a
+      // parallel::fullydistributed::Triangulation on each process without
+      // ever assembling the global mesh. Creating the description is
+      // collective, which is why this is not the default.
+      const auto parallel_tria = dynamic_cast<
+        const parallel::DistributedTriangulationBase<dim, spacedim> *>(&tria);
+      if (vtu_flags.serialize_triangulation_description &&
+          parallel_tria != nullptr)
+        {
+          out << "<dealiiData  encoding=\"base64\" content=\"description\">";
+          const auto description = TriangulationDescription::Utilities::
+            create_description_from_triangulation(
+              tria, parallel_tria->get_mpi_communicator());
+          ia << description;
+        }
+      else
+        {
+          out << "<dealiiData  encoding=\"base64\">";
+          tria.save(ia, 0);
+        }
       const auto compressed = Utilities::compress(outstring.str());
       out << Utilities::encode_base64({compressed.begin(), compressed.end()});
       out << "\n</dealiiData>\n";
@@ -16,6 +16,7 @@
 #include <deal.II/base/mpi.h>
 #include <deal.II/base/mpi.templates.h>
 #include <deal.II/base/mpi_consensus_algorithms.h>
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/quadrature_lib.h>
 #include <deal.II/base/thread_management.h>
 
@@ -71,6 +72,7 @@
 #include <boost/random/mersenne_twister.hpp>
 #include <boost/random/uniform_real_distribution.hpp>
 
+#include <algorithm>
 #include <array>
 #include <cmath>
 #include <iostream>
@@ -2099,6 +2101,199 @@ namespace GridTools
   }
 
 
+
+  template <int dim, int spacedim>
+  std::vector<unsigned int>
+  compute_active_cell_hilbert_order(
+    const Triangulation<dim, spacedim> &triangulation)
+  {
+    const unsigned int n_active_cells = triangulation.n_active_cells();
+    if (n_active_cells == 0)
+      return {};
+
+    // collect the active cells so that the subsequent steps can work on
+    // ranges of them in parallel
+    std::vector<typename Triangulation<dim, spacedim>::active_cell_iterator>
+      active_cells(n_active_cells);
+    for (const auto &cell : triangulation.active_cell_iterators())
+      active_cells[cell->active_cell_index()] = cell;
+
+    std::vector<Point<spacedim>> centers(n_active_cells);
+    parallel::apply_to_subranges(
+      0U,
+      n_active_cells,
+      [&](const unsigned int begin, const unsigned int end) {
+        for (unsigned int i = begin; i < end; ++i)
+          centers[i] = active_cells[i]->center();
+      },
+      256);
+
+    // Map the cell centers into integer coordinates relative to the
+    // bounding box of the mesh. Directions in which the box is degenerate
+    // (e.g., for a flat surface mesh embedded in 3d) all get the coordinate
+    // zero. We use as many bits as the mantissa of a double has, which is
+    // more than enough to distinguish the centers of any two cells.
+    const BoundingBox<spacedim> bounding_box =
+      compute_bounding_box(triangulation);
+    const Point<spacedim> &lower_left = bounding_box.get_boundary_points().first;
+    const Point<spacedim> &upper_right =
+      bounding_box.get_boundary_points().second;
+
+    const int           bits_per_dim = std::numeric_limits<double>::digits;
+    const std::uint64_t max_int = (std::uint64_t(1) << bits_per_dim) - 1;
+
+    std::vector<std::array<std::uint64_t, spacedim>> keys(n_active_cells);
+    parallel::apply_to_subranges(
+      0U,
+      n_active_cells,
+      [&](const unsigned int begin, const unsigned int end) {
+        std::vector<std::array<std::uint64_t, spacedim>> int_points(end -
+                                                                    begin);
+        for (unsigned int i = begin; i < end; ++i)
+          for (unsigned int d = 0; d < spacedim; ++d)
+            {
+              const double extent = upper_right[d] - lower_left[d];
+              int_points[i - begin][d] =
+                (extent > 0. ?
+                   static_cast<std::uint64_t>(
+                     std::clamp((centers[i][d] - lower_left[d]) / extent,
+                                0.,
+                                1.) *
+                     static_cast<double>(max_int)) :
+                   0);
+            }
+
+        const std::vector<std::array<std::uint64_t, spacedim>> range_keys =
+          Utilities::inverse_Hilbert_space_filling_curve<spacedim>(
+            int_points, bits_per_dim);
+        std::copy(range_keys.begin(), range_keys.end(), keys.begin() + begin);
+      },
+      256);
+
+    // Finally sort the cells by their keys, which are compared
+    // lexicographically. Ties are broken by the active cell index to make
+    // the result deterministic.
+    std::vector<unsigned int> order(n_active_cells);
+    std::iota(order.begin(), order.end(), 0U);
+    std::sort(order.begin(),
+              order.end(),
+              [&](const unsigned int a, const unsigned int b) {
+                return (keys[a] < keys[b]) || (keys[a] == keys[b] && a < b);
+              });
+
+    return order;
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  partition_triangulation_hilbert(const unsigned int            n_partitions,
+                                  Triangulation<dim, spacedim> &triangulation)
+  {
+    Assert((dynamic_cast<parallel::distributed::Triangulation<dim, spacedim> *>(
+              &triangulation) == nullptr),
+           ExcMessage("Objects of type parallel::distributed::Triangulation "
+                      "are already partitioned implicitly and can not be "
+                      "partitioned again explicitly."));
+
+    std::vector<unsigned int> cell_weights;
+
+    // Get cell weighting if a signal has been attached to the triangulation
+    if (!triangulation.signals.weight.empty())
+      {
+        cell_weights.resize(triangulation.n_active_cells(), 0U);
+
+        // In a first step, obtain the weights of the locally owned
+        // cells. For all others, the weight remains at the zero the
+        // vector was initialized with above.
+        for (const auto &cell : triangulation.active_cell_iterators() |
+                                  IteratorFilters::LocallyOwnedCell())
+          cell_weights[cell->active_cell_index()] =
+            triangulation.signals.weight(cell, CellStatus::cell_will_persist);
+
+        // If this is a parallel::shared::Triangulation, we then need to
+        // also get the weights for all other cells.
+        if (const auto shared_tria =
+              dynamic_cast<parallel::shared::Triangulation<dim, spacedim> *>(
+                &triangulation))
+          Utilities::MPI::sum(cell_weights,
+                              shared_tria->get_mpi_communicator(),
+                              cell_weights);
+
+        // verify that the global sum of weights is larger than 0
+        Assert(std::accumulate(cell_weights.begin(),
+                               cell_weights.end(),
+                               std::uint64_t(0)) > 0,
+               ExcMessage("The global sum of weights over all active cells "
+                          "is zero. Please verify how you generate weights."));
+      }
+
+    // Call the other more general function
+    partition_triangulation_hilbert(n_partitions, cell_weights, triangulation);
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  partition_triangulation_hilbert(const unsigned int n_partitions,
+                                  const std::vector<unsigned int> &cell_weights,
+                                  Triangulation<dim, spacedim> &triangulation)
+  {
+    Assert((dynamic_cast<parallel::distributed::Triangulation<dim, spacedim> *>(
+              &triangulation) == nullptr),
+           ExcMessage("Objects of type parallel::distributed::Triangulation "
+                      "are already partitioned implicitly and can not be "
+                      "partitioned again explicitly."));
+    Assert(n_partitions > 0, ExcInvalidNumberOfPartitions(n_partitions));
+    Assert(cell_weights.empty() ||
+             cell_weights.size() == triangulation.n_active_cells(),
+           ExcDimensionMismatch(cell_weights.size(),
+                                triangulation.n_active_cells()));
+
+    // signal that partitioning is going to happen
+    triangulation.signals.pre_partition();
+
+    // check for an easy return
+    if (n_partitions == 1)
+      {
+        for (const auto &cell : triangulation.active_cell_iterators())
+          cell->set_subdomain_id(0);
+        return;
+      }
+
+    const std::vector<unsigned int> order =
+      compute_active_cell_hilbert_order(triangulation);
+
+    // Cut the curve into n_partitions contiguous pieces of (approximately)
+    // equal weight: a cell goes to the partition into which the sum of
+    // the weights of all cells before it on the curve falls.
+    const std::uint64_t total_weight =
+      cell_weights.empty() ?
+        order.size() :
+        std::accumulate(cell_weights.begin(),
+                        cell_weights.end(),
+                        std::uint64_t(0));
+    Assert(total_weight > 0,
+           ExcMessage("The global sum of weights over all active cells "
+                      "is zero. Please verify how you generate weights."));
+
+    std::vector<types::subdomain_id> partition_indices(order.size());
+    std::uint64_t                    weight_before = 0;
+    for (const unsigned int index : order)
+      {
+        partition_indices[index] = static_cast<types::subdomain_id>(
+          std::min<std::uint64_t>(n_partitions * weight_before / total_weight,
+                                  n_partitions - 1));
+        weight_before += (cell_weights.empty() ? 1 : cell_weights[index]);
+      }
+
+    for (const auto &cell : triangulation.active_cell_iterators())
+      cell->set_subdomain_id(partition_indices[cell->active_cell_index()]);
+  }
+
+
   template <int dim, int spacedim>
   void
   partition_multigrid_levels(Triangulation<dim, spacedim> &triangulation)
@@ -3355,32 +3550,21 @@ namespace GridTools
       return found_points[id.second];
     };
 
-    // check if the given cell was already in the vector of cells before. If so,
-    // insert in the corresponding vectors the reference point and the id.
-    // Otherwise append a new entry to all vectors.
-    const auto store_cell_point_and_id =
-      [&](
-        const typename Triangulation<dim, spacedim>::active_cell_iterator &cell,
-        const Point<dim>   &ref_point,
-        const unsigned int &id) {
-        const auto it = std::find(cells_out.rbegin(), cells_out.rend(), cell);
-        if (it != cells_out.rend())
-          {
-            const auto cell_id =
-              (cells_out.size() - 1 - (it - cells_out.rbegin()));
-            qpoints_out[cell_id].emplace_back(ref_point);
-            maps_out[cell_id].emplace_back(id);
-          }
-        else
-          {
-            cells_out.emplace_back(cell);
-            qpoints_out.emplace_back(std::vector<Point<dim>>({ref_point}));
-            maps_out.emplace_back(std::vector<unsigned int>({id}));
-          }
-      };
-
-    // Check all points within a given pair of box and cell
-    const auto check_all_points_within_box = [&](const auto &leaf) {
+    // The search proceeds in three phases: First, we walk through the boxes
+    // of the cells and assign to each point the cell whose box was the first
+    // to contain it. Second, the points are located starting from this cell,
+    // which is independent for each cell and hence done in parallel.
+    // Finally, the points are sorted into the output vectors in the order in
+    // which they were assigned, which makes the result independent of the
+    // number of threads.
+    std::vector<std::pair<
+      unsigned int,
+      typename Triangulation<dim, spacedim>::active_cell_iterator>>
+      ids_and_hints;
+    ids_and_hints.reserve(np);
+
+    // Assign all points within a given pair of box and cell
+    const auto assign_all_points_within_box = [&](const auto &leaf) {
       const double                relative_tolerance = 1e-12;
       const BoundingBox<spacedim> box =
         leaf.first.create_extended_relative(relative_tolerance);
@@ -3391,17 +3575,7 @@ namespace GridTools
                                            bgi::intersects(box)))
         {
           const auto id = point_and_id.second;
-          const auto cell_and_ref =
-            GridTools::find_active_cell_around_point(cache,
-                                                     points[id],
-                                                     cell_hint);
-          const auto &cell      = cell_and_ref.first;
-          const auto &ref_point = cell_and_ref.second;
-
-          if (cell.state() == IteratorState::valid)
-            store_cell_point_and_id(cell, ref_point, id);
-          else
-            missing_points_out.emplace_back(id);
+          ids_and_hints.emplace_back(id, cell_hint);
 
           // Don't look anymore for this point
           found_points[id] = true;
@@ -3410,24 +3584,126 @@ namespace GridTools
 
     // If a hint cell was given, use it
     if (cell_hint.state() == IteratorState::valid)
-      check_all_points_within_box(
+      assign_all_points_within_box(
         std::make_pair(mapping.get_bounding_box(cell_hint), cell_hint));
 
-    // Now loop over all points that have not been found yet
+    // Now loop over all points that have not been assigned yet
     for (unsigned int i = 0; i < np; ++i)
       if (found_points[i] == false)
         {
           // Get the closest cell to this point
           const auto leaf = b_tree.qbegin(bgi::nearest(points[i], 1));
-          // Now checks all points that fall within this box
+          // Now assign all points that fall within this box
           if (leaf != b_tree.qend())
-            check_all_points_within_box(*leaf);
+            assign_all_points_within_box(*leaf);
           else
             {
               // We should not get here. Throw an error.
               DEAL_II_ASSERT_UNREACHABLE();
             }
         }
+
+    // Make sure that the cached data used by
+    // find_active_cell_around_point() is available before starting to work
+    // in parallel, so that the threads do not have to wait for each other.
+    cache.get_vertex_to_cell_map();
+    cache.get_vertex_to_cell_centers_directions();
+    cache.get_used_vertices_rtree();
+
+    // The points assigned to the same cell are stored contiguously. Record
+    // where each of these groups starts.
+    std::vector<unsigned int> group_starts;
+    for (unsigned int i = 0; i < ids_and_hints.size(); ++i)
+      if (i == 0 || ids_and_hints[i].second != ids_and_hints[i - 1].second)
+        group_starts.push_back(i);
+    group_starts.push_back(ids_and_hints.size());
+
+    // For each group, map all points to the reference cell of their cell at
+    // once, which is much faster than individual calls for mappings that
+    // implement transform_points_real_to_unit_cell() in a vectorized way,
+    // such as MappingQ. A point that lies clearly inside the cell would also
+    // be found in this cell by find_active_cell_around_point(), so we only
+    // need to call the latter function for the remaining points, which lie
+    // outside of the cell or close to its boundary. The margin is chosen
+    // much larger than the tolerance of find_active_cell_around_point(), so
+    // that no neighboring cell can contain such a point within that
+    // tolerance.
+    const double interior_margin = 1e-6;
+
+    std::vector<
+      std::pair<typename Triangulation<dim, spacedim>::active_cell_iterator,
+                Point<dim>>>
+      cells_and_ref_points(ids_and_hints.size());
+    parallel::apply_to_subranges(
+      0U,
+      static_cast<unsigned int>(group_starts.size() - 1),
+      [&](const unsigned int begin, const unsigned int end) {
+        std::vector<Point<spacedim>> real_points;
+        std::vector<Point<dim>>      unit_points;
+        for (unsigned int g = begin; g < end; ++g)
+          {
+            const unsigned int first    = group_starts[g];
+            const unsigned int n_points = group_starts[g + 1] - first;
+            const auto        &cell     = ids_and_hints[first].second;
+
+            real_points.resize(n_points);
+            unit_points.resize(n_points);
+            for (unsigned int j = 0; j < n_points; ++j)
+              real_points[j] = points[ids_and_hints[first + j].first];
+
+            const bool use_batch = !cell->is_artificial();
+            if (use_batch)
+              mapping.transform_points_real_to_unit_cell(cell,
+                                                         real_points,
+                                                         unit_points);
+
+            for (unsigned int j = 0; j < n_points; ++j)
+              if (use_batch && cell->reference_cell().contains_point(
+                                 unit_points[j], -interior_margin))
+                cells_and_ref_points[first + j] =
+                  std::make_pair(cell, unit_points[j]);
+              else
+                cells_and_ref_points[first + j] =
+                  GridTools::find_active_cell_around_point(cache,
+                                                           real_points[j],
+                                                           cell);
+          }
+      },
+      1);
+
+    // Finally store the results. Use a map from the cells to their position
+    // in the output vectors, rather than searching through the output
+    // vectors, which would take time proportional to the number of cells for
+    // each point.
+    std::map<typename Triangulation<dim, spacedim>::active_cell_iterator,
+             unsigned int>
+      cell_to_output_index;
+    for (unsigned int i = 0; i < ids_and_hints.size(); ++i)
+      {
+        const unsigned int id        = ids_and_hints[i].first;
+        const auto        &cell      = cells_and_ref_points[i].first;
+        const auto        &ref_point = cells_and_ref_points[i].second;
+
+        if (cell.state() == IteratorState::valid)
+          {
+            const auto [it, inserted] =
+              cell_to_output_index.emplace(cell, cells_out.size());
+            if (inserted)
+              {
+                cells_out.emplace_back(cell);
+                qpoints_out.emplace_back(std::vector<Point<dim>>({ref_point}));
+                maps_out.emplace_back(std::vector<unsigned int>({id}));
+              }
+            else
+              {
+                qpoints_out[it->second].emplace_back(ref_point);
+                maps_out[it->second].emplace_back(id);
+              }
+          }
+        else
+          missing_points_out.emplace_back(id);
+      }
+
     // Now make sure we send out the rest of the points that we did not find.
     for (unsigned int i = 0; i < np; ++i)
       if (found_points[i] == false)
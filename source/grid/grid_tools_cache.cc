@@ -13,25 +13,73 @@
 // ------------------------------------------------------------------------
 
 #include <deal.II/base/bounding_box.h>
+#include <deal.II/base/memory_consumption.h>
 #include <deal.II/base/mpi_stub.h>
 
 #include <deal.II/grid/filtered_iterator.h>
 #include <deal.II/grid/grid_tools.h>
 #include <deal.II/grid/grid_tools_cache.h>
 
+DEAL_II_DISABLE_EXTRA_DIAGNOSTICS
+#include <boost/geometry/algorithms/equals.hpp>
+DEAL_II_ENABLE_EXTRA_DIAGNOSTICS
+
 DEAL_II_NAMESPACE_OPEN
 
 namespace GridTools
 {
+  namespace
+  {
+    /**
+     * Remove @p value from @p tree, and return whether it was found.
+     *
+     * BOOST.Geometry can not compare one-dimensional geometries, which is
+     * necessary to find the entry to remove. In that case, nothing is removed
+     * and the function returns false.
+     */
+    template <int spacedim, typename TreeType, typename ValueType>
+    bool
+    remove_from_rtree(TreeType &tree, const ValueType &value)
+    {
+      if constexpr (spacedim > 1)
+        return tree.remove(value) > 0;
+      else
+        {
+          (void)tree;
+          (void)value;
+          return false;
+        }
+    }
+  } // namespace
+
+
+
+  template <int dim, int spacedim>
+  std::size_t
+  LocallyOwnedActiveCells<dim, spacedim>::memory_consumption() const
+  {
+    return MemoryConsumption::memory_consumption(levels) +
+           MemoryConsumption::memory_consumption(indices) +
+           MemoryConsumption::memory_consumption(active_cell_indices) +
+           MemoryConsumption::memory_consumption(vertex_ptr) +
+           MemoryConsumption::memory_consumption(vertex_indices) +
+           MemoryConsumption::memory_consumption(face_ptr) +
+           MemoryConsumption::memory_consumption(face_boundary_ids) +
+           MemoryConsumption::memory_consumption(material_ids) +
+           MemoryConsumption::memory_consumption(measures);
+  }
+
+
+
   template <int dim, int spacedim>
   Cache<dim, spacedim>::Cache(const Triangulation<dim, spacedim> &tria,
                               const Mapping<dim, spacedim>       &mapping)
     : update_flags(update_all)
     , tria(&tria)
     , mapping(&mapping)
+    , local_refinement_in_progress(false)
   {
-    tria_change_signal =
-      tria.signals.any_change.connect([&]() { mark_for_update(update_all); });
+    connect_to_triangulation_signals();
   }
 
 
@@ -40,9 +88,9 @@ namespace GridTools
   Cache<dim, spacedim>::Cache(const Triangulation<dim, spacedim> &tria)
     : update_flags(update_all)
     , tria(&tria)
+    , local_refinement_in_progress(false)
   {
-    tria_change_signal =
-      tria.signals.any_change.connect([&]() { mark_for_update(update_all); });
+    connect_to_triangulation_signals();
 
     // Allow users to set this class up with an empty Triangulation and no
     // Mapping argument by deferring Mapping assignment until after the
@@ -71,6 +119,73 @@ namespace GridTools
       tria_change_signal.disconnect();
     if (tria_create_signal.connected())
       tria_create_signal.disconnect();
+    if (tria_pre_refinement_signal.connected())
+      tria_pre_refinement_signal.disconnect();
+    if (tria_pre_coarsening_on_cell_signal.connected())
+      tria_pre_coarsening_on_cell_signal.disconnect();
+    if (tria_post_refinement_on_cell_signal.connected())
+      tria_post_refinement_on_cell_signal.disconnect();
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  Cache<dim, spacedim>::connect_to_triangulation_signals()
+  {
+    // The any_change signal is also triggered at the end of every refinement
+    // cycle. If we have recorded the cells changed in this cycle, we can use
+    // them to update some of the structures instead of recomputing them.
+    tria_change_signal = tria->signals.any_change.connect([&]() {
+      if (local_refinement_in_progress)
+        update_after_local_refinement();
+      else
+        mark_for_update(update_all);
+    });
+
+    // Incremental updates are only implemented for serial triangulations
+    // of hypercube cells: for parallel triangulations, the refinement cycle
+    // may be accompanied by changes of the ownership of cells, or even by
+    // cells being created and removed on the current process.
+    tria_pre_refinement_signal = tria->signals.pre_refinement.connect([&]() {
+      refined_cells.clear();
+      coarsened_cells.clear();
+      coarsened_vertices.clear();
+      coarsened_cell_bounding_boxes.clear();
+      local_refinement_in_progress =
+        (dynamic_cast<const parallel::TriangulationBase<dim, spacedim> *>(
+           &*tria) == nullptr) &&
+        tria->all_reference_cells_are_hyper_cube();
+    });
+
+    tria_pre_coarsening_on_cell_signal =
+      tria->signals.pre_coarsening_on_cell.connect(
+        [&](const typename Triangulation<dim, spacedim>::cell_iterator &cell) {
+          if (local_refinement_in_progress == false)
+            return;
+
+          // The children are deleted after this signal, so record now what
+          // we will need to remove them from the cached structures.
+          const bool need_bounding_boxes =
+            !(update_flags & update_cell_bounding_boxes_rtree) ||
+            !(update_flags & update_locally_owned_cell_bounding_boxes_rtree);
+          coarsened_cells.push_back(cell);
+          for (const auto &child : cell->child_iterators())
+            {
+              for (const unsigned int v : child->vertex_indices())
+                coarsened_vertices.push_back(child->vertex_index(v));
+              if (need_bounding_boxes)
+                coarsened_cell_bounding_boxes.emplace_back(
+                  mapping->get_bounding_box(child), child);
+            }
+        });
+
+    tria_post_refinement_on_cell_signal =
+      tria->signals.post_refinement_on_cell.connect(
+        [&](const typename Triangulation<dim, spacedim>::cell_iterator &cell) {
+          if (local_refinement_in_progress)
+            refined_cells.push_back(cell);
+        });
   }
 
 
@@ -84,6 +199,245 @@ namespace GridTools
 
 
 
+  template <int dim, int spacedim>
+  void
+  Cache<dim, spacedim>::update_after_local_refinement()
+  {
+    using active_cell_iterator =
+      typename Triangulation<dim, spacedim>::active_cell_iterator;
+
+    local_refinement_in_progress = false;
+
+    const CacheUpdateFlags incremental_flags =
+      update_vertex_to_cell_map | update_used_vertices |
+      update_used_vertices_rtree | update_cell_bounding_boxes_rtree |
+      update_locally_owned_cell_bounding_boxes_rtree;
+
+    // Everything else, including the vertex to cell center directions that
+    // are derived from the vertex to cell map, is recomputed from scratch.
+    mark_for_update(update_all & ~incremental_flags);
+
+    if ((update_flags & incremental_flags) == incremental_flags)
+      return;
+
+    // The active cells that did not exist before this refinement cycle.
+    std::vector<active_cell_iterator> new_cells;
+    for (const auto &cell : refined_cells)
+      for (const auto &child : cell->child_iterators())
+        new_cells.push_back(child);
+    for (const auto &cell : coarsened_cells)
+      new_cells.push_back(cell);
+
+    // The vertices whose entries in the vertex-based structures may have
+    // changed. These are all vertices of the new and of the removed cells,
+    // which for cells that are refined include the vertices on the faces
+    // and edges that are now hanging for coarser neighbors.
+    std::vector<unsigned int> changed_vertices = coarsened_vertices;
+    for (const auto &cell : new_cells)
+      for (const unsigned int v : cell->vertex_indices())
+        changed_vertices.push_back(cell->vertex_index(v));
+    std::sort(changed_vertices.begin(), changed_vertices.end());
+    changed_vertices.erase(std::unique(changed_vertices.begin(),
+                                       changed_vertices.end()),
+                           changed_vertices.end());
+    const auto vertex_changed = [&](const unsigned int v) {
+      return std::binary_search(changed_vertices.begin(),
+                                changed_vertices.end(),
+                                v);
+    };
+
+    if (!(update_flags & update_vertex_to_cell_map))
+      {
+        std::lock_guard<std::mutex> lock(vertex_to_cells_mutex);
+
+        // Collect the active cells that touch one of the changed vertices,
+        // and clear the entries of these vertices. All cells that touch
+        // such a vertex but are not new already touched it before the
+        // refinement cycle, or share a vertex with a cell that was refined,
+        // so the old entries give us these cells. Some of these cells may
+        // have been removed in the meantime, so only keep the ones that
+        // still exist and are active.
+        std::vector<active_cell_iterator> touching_cells = new_cells;
+        vertex_to_cells.resize(tria->n_vertices());
+        for (const unsigned int v : changed_vertices)
+          {
+            for (const auto &cell : vertex_to_cells[v])
+              if (static_cast<unsigned int>(cell->level()) <
+                    tria->n_levels() &&
+                  static_cast<unsigned int>(cell->index()) <
+                    tria->n_raw_cells(cell->level()) &&
+                  cell->used() && cell->is_active())
+                touching_cells.push_back(cell);
+            vertex_to_cells[v].clear();
+          }
+        std::sort(touching_cells.begin(), touching_cells.end());
+        touching_cells.erase(std::unique(touching_cells.begin(),
+                                         touching_cells.end()),
+                             touching_cells.end());
+
+        // Then re-insert the entries of the changed vertices, following the
+        // rules used in GridTools::vertex_to_cell_map(). For meshes without
+        // hanging nodes, the rules for faces and edges do not add anything
+        // beyond the vertices of the cells themselves, so they can be
+        // applied unconditionally.
+        for (const auto &cell : touching_cells)
+          {
+            for (const unsigned int v : cell->vertex_indices())
+              if (vertex_changed(cell->vertex_index(v)))
+                vertex_to_cells[cell->vertex_index(v)].insert(cell);
+
+            for (const unsigned int f : cell->face_indices())
+              if ((cell->at_boundary(f) == false) &&
+                  (cell->neighbor(f)->is_active()))
+                {
+                  const active_cell_iterator adjacent_cell =
+                    cell->neighbor(f);
+                  for (unsigned int j = 0; j < cell->face(f)->n_vertices();
+                       ++j)
+                    if (vertex_changed(cell->face(f)->vertex_index(j)))
+                      vertex_to_cells[cell->face(f)->vertex_index(j)].insert(
+                        adjacent_cell);
+                }
+
+            if (dim == 3)
+              for (unsigned int l = 0; l < cell->n_lines(); ++l)
+                if (cell->line(l)->has_children() &&
+                    vertex_changed(cell->line(l)->child(0)->vertex_index(1)))
+                  vertex_to_cells[cell->line(l)->child(0)->vertex_index(1)]
+                    .insert(cell);
+          }
+      }
+
+    // Remove the vertices that are no longer used, and add or update the
+    // vertices of the new cells, with their locations as seen by the
+    // mapping. The latter also takes care of vertices whose index was freed
+    // by coarsening and then reused by refinement.
+    std::vector<std::pair<Point<spacedim>, unsigned int>> removed_vertices;
+    std::vector<std::pair<Point<spacedim>, unsigned int>> added_vertices;
+    if (!(update_flags & update_used_vertices))
+      {
+        std::lock_guard<std::mutex> lock(used_vertices_mutex);
+
+        for (const unsigned int v : changed_vertices)
+          if (tria->vertex_used(v) == false)
+            {
+              const auto it = used_vertices.find(v);
+              if (it != used_vertices.end())
+                {
+                  removed_vertices.emplace_back(it->second, v);
+                  used_vertices.erase(it);
+                }
+            }
+
+        for (const auto &cell : new_cells)
+          {
+            const auto vs = mapping->get_vertices(cell);
+            for (unsigned int i = 0; i < vs.size(); ++i)
+              {
+                const auto [it, inserted] =
+                  used_vertices.emplace(cell->vertex_index(i), vs[i]);
+                if (inserted)
+                  added_vertices.emplace_back(vs[i], it->first);
+                else if (it->second != vs[i])
+                  {
+                    removed_vertices.emplace_back(it->second, it->first);
+                    added_vertices.emplace_back(vs[i], it->first);
+                    it->second = vs[i];
+                  }
+              }
+          }
+      }
+    else
+      mark_for_update(update_used_vertices_rtree);
+
+    if (!(update_flags & update_used_vertices_rtree))
+      {
+        std::lock_guard<std::mutex> lock(used_vertices_rtree_mutex);
+        bool                        success = true;
+        for (const auto &entry : removed_vertices)
+          if (remove_from_rtree<spacedim>(used_vertices_rtree, entry) == false)
+            {
+              success = false;
+              break;
+            }
+        if (success)
+          used_vertices_rtree.insert(added_vertices.begin(),
+                                     added_vertices.end());
+        else
+          mark_for_update(update_used_vertices_rtree);
+      }
+
+    // Finally update the trees of cell bounding boxes: remove the boxes of
+    // the cells that were refined and of the children that were removed,
+    // and add the boxes of the new cells.
+    if (!(update_flags & update_cell_bounding_boxes_rtree) ||
+        !(update_flags & update_locally_owned_cell_bounding_boxes_rtree))
+      {
+        using BoxAndCell =
+          std::pair<BoundingBox<spacedim>, active_cell_iterator>;
+
+        std::vector<
+          std::pair<BoundingBox<spacedim>,
+                    typename Triangulation<dim, spacedim>::cell_iterator>>
+          removed_boxes = coarsened_cell_bounding_boxes;
+        for (const auto &cell : refined_cells)
+          removed_boxes.emplace_back(mapping->get_bounding_box(cell), cell);
+
+        std::vector<BoxAndCell> added_boxes;
+        added_boxes.reserve(new_cells.size());
+        for (const auto &cell : new_cells)
+          added_boxes.emplace_back(mapping->get_bounding_box(cell), cell);
+
+        // Update a tree, and return whether this was successful. The tree
+        // stores active cell iterators, so we can not look up the removed
+        // cells (which are no longer active, or no longer exist) directly;
+        // rather, search for them among the entries whose boxes intersect
+        // the recorded box.
+        const auto update_tree = [&](RTree<BoxAndCell> &tree) {
+          namespace bgi = boost::geometry::index;
+
+          std::vector<BoxAndCell> found;
+          for (const auto &[box, cell] : removed_boxes)
+            {
+              found.clear();
+              tree.query(bgi::intersects(box) &&
+                           bgi::satisfies([&](const BoxAndCell &entry) {
+                             return entry.second->level() == cell->level() &&
+                                    entry.second->index() == cell->index();
+                           }),
+                         std::back_inserter(found));
+              if (found.size() != 1 ||
+                  remove_from_rtree<spacedim>(tree, found[0]) == false)
+                return false;
+            }
+          tree.insert(added_boxes.begin(), added_boxes.end());
+          return true;
+        };
+
+        if (!(update_flags & update_cell_bounding_boxes_rtree))
+          {
+            std::lock_guard<std::mutex> lock(cell_bounding_boxes_rtree_mutex);
+            if (update_tree(cell_bounding_boxes_rtree) == false)
+              mark_for_update(update_cell_bounding_boxes_rtree);
+          }
+
+        if (!(update_flags & update_locally_owned_cell_bounding_boxes_rtree))
+          {
+            std::lock_guard<std::mutex> lock(
+              locally_owned_cell_bounding_boxes_rtree_mutex);
+            if (update_tree(locally_owned_cell_bounding_boxes_rtree) == false)
+              mark_for_update(update_locally_owned_cell_bounding_boxes_rtree);
+          }
+      }
+
+    refined_cells.clear();
+    coarsened_cells.clear();
+    coarsened_vertices.clear();
+    coarsened_cell_bounding_boxes.clear();
+  }
+
+
+
   template <int dim, int spacedim>
   const std::vector<
     std::set<typename Triangulation<dim, spacedim>::active_cell_iterator>> &
@@ -359,6 +713,92 @@ namespace GridTools
     return vertices_with_ghost_neighbors;
   }
 
+
+
+  template <int dim, int spacedim>
+  const LocallyOwnedActiveCells<dim, spacedim> &
+  Cache<dim, spacedim>::get_locally_owned_active_cells() const
+  {
+    // In the following, we will first check whether the data structure
+    // in question needs to be updated (in which case we update it, and
+    // reset the flag that indices that this needs to happen to zero), and
+    // then return it. Make this thread-safe by using a mutex to guard
+    // all of this:
+    std::lock_guard<std::mutex> lock(locally_owned_active_cells_mutex);
+
+    if (update_flags & update_locally_owned_active_cells)
+      {
+        LocallyOwnedActiveCells<dim, spacedim> &data =
+          locally_owned_active_cells;
+
+        // Walking the cell hierarchy is inherently sequential, so first
+        // collect the cells and the offsets into the compressed vertex and
+        // face arrays in one sweep...
+        std::vector<
+          typename Triangulation<dim, spacedim>::active_cell_iterator>
+          cells;
+        if (const parallel::TriangulationBase<dim, spacedim> *parallel_tria =
+              dynamic_cast<const parallel::TriangulationBase<dim, spacedim> *>(
+                &*tria))
+          cells.reserve(parallel_tria->n_locally_owned_active_cells());
+        else
+          cells.reserve(tria->n_active_cells());
+
+        data.vertex_ptr.clear();
+        data.face_ptr.clear();
+        data.vertex_ptr.push_back(0);
+        data.face_ptr.push_back(0);
+        for (const auto &cell : tria->active_cell_iterators() |
+                                  IteratorFilters::LocallyOwnedCell())
+          {
+            cells.push_back(cell);
+            data.vertex_ptr.push_back(data.vertex_ptr.back() +
+                                      cell->n_vertices());
+            data.face_ptr.push_back(data.face_ptr.back() + cell->n_faces());
+          }
+
+        const unsigned int n_cells = cells.size();
+        data.levels.resize(n_cells);
+        data.indices.resize(n_cells);
+        data.active_cell_indices.resize(n_cells);
+        data.material_ids.resize(n_cells);
+        data.measures.resize(n_cells);
+        data.vertex_indices.resize(data.vertex_ptr.back());
+        data.face_boundary_ids.resize(data.face_ptr.back());
+
+        // ...and then fill the arrays, which touches the vertex locations
+        // and the face data of each cell, in parallel.
+        parallel::apply_to_subranges(
+          0U,
+          n_cells,
+          [&](const unsigned int begin, const unsigned int end) {
+            for (unsigned int i = begin; i < end; ++i)
+              {
+                const auto &cell            = cells[i];
+                data.levels[i]              = cell->level();
+                data.indices[i]             = cell->index();
+                data.active_cell_indices[i] = cell->active_cell_index();
+                data.material_ids[i]        = cell->material_id();
+                data.measures[i]            = cell->measure();
+
+                for (const unsigned int v : cell->vertex_indices())
+                  data.vertex_indices[data.vertex_ptr[i] + v] =
+                    cell->vertex_index(v);
+                for (const unsigned int f : cell->face_indices())
+                  data.face_boundary_ids[data.face_ptr[i] + f] =
+                    cell->face(f)->boundary_id();
+              }
+          },
+          256);
+
+        // Atomically clear the flag that indicates that this data member
+        // needs to be updated:
+        update_flags &= ~update_locally_owned_active_cells;
+      }
+
+    return locally_owned_active_cells;
+  }
+
 #include "grid/grid_tools_cache.inst"
 
 } // namespace GridTools
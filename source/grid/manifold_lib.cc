@@ -1623,8 +1623,18 @@ TorusManifold<dim>::push_forward_gradient(const Point<3> &chart_point) const
 template <int dim, int spacedim>
 TransfiniteInterpolationManifold<dim,
                                  spacedim>::TransfiniteInterpolationManifold()
+  : TransfiniteInterpolationManifold(1U << 16)
+{}
+
+
+
+template <int dim, int spacedim>
+TransfiniteInterpolationManifold<dim, spacedim>::
+  TransfiniteInterpolationManifold(const unsigned int max_cached_chart_points)
   : triangulation(nullptr)
   , level_coarse(-1)
+  , max_cached_chart_points(max_cached_chart_points)
+  , max_cached_chart_points_per_cell(0)
 {
   AssertThrow(dim > 1, ExcNotImplemented());
 }
@@ -1637,6 +1647,8 @@ TransfiniteInterpolationManifold<dim,
 {
   if (clear_signal.connected())
     clear_signal.disconnect();
+  if (mesh_movement_signal.connected())
+    mesh_movement_signal.disconnect();
 }
 
 
@@ -1645,7 +1657,8 @@ template <int dim, int spacedim>
 std::unique_ptr<Manifold<dim, spacedim>>
 TransfiniteInterpolationManifold<dim, spacedim>::clone() const
 {
-  auto ptr = new TransfiniteInterpolationManifold<dim, spacedim>();
+  auto ptr = new TransfiniteInterpolationManifold<dim, spacedim>(
+    max_cached_chart_points);
   if (triangulation)
     ptr->initialize(*triangulation);
   return std::unique_ptr<Manifold<dim, spacedim>>(ptr);
@@ -1664,9 +1677,24 @@ TransfiniteInterpolationManifold<dim, spacedim>::initialize(
   clear_signal = triangulation.signals.clear.connect([&]() -> void {
     this->triangulation = nullptr;
     this->level_coarse  = -1;
+    this->chart_point_caches.clear();
   });
+  // The cached chart points are invalid once the vertices have been moved:
+  mesh_movement_signal.disconnect();
+  mesh_movement_signal =
+    triangulation.signals.mesh_movement.connect([&]() -> void {
+      for (ChartPointCache &cache : this->chart_point_caches)
+        {
+          std::lock_guard<std::mutex> lock(cache.mutex);
+          cache.chart_points.clear();
+        }
+    });
   level_coarse = triangulation.last()->level();
   coarse_cell_is_flat.resize(triangulation.n_cells(level_coarse), false);
+  chart_point_caches.clear();
+  chart_point_caches.resize(triangulation.n_cells(level_coarse));
+  max_cached_chart_points_per_cell =
+    max_cached_chart_points / std::max(triangulation.n_cells(level_coarse), 1U);
   quadratic_approximation.clear();
 
   // In case of dim == spacedim we perform a quadratic approximation in
@@ -2067,6 +2095,74 @@ TransfiniteInterpolationManifold<dim, spacedim>::push_forward_gradient(
 
 
 
+template <int dim, int spacedim>
+bool
+TransfiniteInterpolationManifold<dim, spacedim>::uses_chart_point_cache(
+  const unsigned int cell_index) const
+{
+  // the pull back on flat cells is cheap enough not to be cached
+  return max_cached_chart_points_per_cell > 0 &&
+         coarse_cell_is_flat[cell_index] == false;
+}
+
+
+
+template <int dim, int spacedim>
+bool
+TransfiniteInterpolationManifold<dim, spacedim>::find_cached_chart_point(
+  const unsigned int     cell_index,
+  const Point<spacedim> &p,
+  Point<dim>            &chart_point) const
+{
+  if (uses_chart_point_cache(cell_index) == false)
+    return false;
+
+  std::array<double, spacedim> coordinates;
+  for (unsigned int d = 0; d < spacedim; ++d)
+    coordinates[d] = p[d];
+
+  AssertIndexRange(cell_index, chart_point_caches.size());
+  ChartPointCache            &cache = chart_point_caches[cell_index];
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  const auto entry = cache.chart_points.find(coordinates);
+  if (entry == cache.chart_points.end())
+    return false;
+
+  chart_point = entry->second;
+  return true;
+}
+
+
+
+template <int dim, int spacedim>
+void
+TransfiniteInterpolationManifold<dim, spacedim>::cache_chart_point(
+  const unsigned int     cell_index,
+  const Point<spacedim> &p,
+  const Point<dim>      &chart_point) const
+{
+  if (uses_chart_point_cache(cell_index) == false)
+    return;
+
+  std::array<double, spacedim> coordinates;
+  for (unsigned int d = 0; d < spacedim; ++d)
+    coordinates[d] = p[d];
+
+  AssertIndexRange(cell_index, chart_point_caches.size());
+  ChartPointCache            &cache = chart_point_caches[cell_index];
+  std::lock_guard<std::mutex> lock(cache.mutex);
+
+  // Limit the memory held by the cache: The typical access pattern of mesh
+  // refinement and of MappingQ is local, so start over once the cache has
+  // grown large rather than keeping track of the least recently used entries
+  if (cache.chart_points.size() >= max_cached_chart_points_per_cell)
+    cache.chart_points.clear();
+
+  cache.chart_points.emplace(coordinates, chart_point);
+}
+
+
+
 template <int dim, int spacedim>
 Point<dim>
 TransfiniteInterpolationManifold<dim, spacedim>::pull_back(
@@ -2434,6 +2530,52 @@ TransfiniteInterpolationManifold<dim, spacedim>::compute_chart_points(
   auto compute_chart_point =
     [&](const typename Triangulation<dim, spacedim>::cell_iterator &cell,
         const unsigned int point_index) {
+      if (uses_chart_point_cache(cell->index()))
+        {
+          // The vertices of the triangulation might have been moved since
+          // the chart point was cached without the mesh_movement signal
+          // being triggered (e.g. by GridTools::distort_random() or by
+          // manual changes of the vertices), so check the cached chart
+          // point by one evaluation of the forward map, which is much
+          // cheaper than a pull back, and recompute it if the check fails.
+          // The tolerance is ten times the one used by pull_back().
+          if (find_cached_chart_point(cell->index(),
+                                      surrounding_points[point_index],
+                                      chart_points[point_index]) &&
+              (surrounding_points[point_index] -
+               compute_transfinite_interpolation(
+                 *cell,
+                 chart_points[point_index],
+                 coarse_cell_is_flat[cell->index()]))
+                  .norm_square() <
+                1e-20 * Utilities::fixed_power<2>(cell->diameter()))
+            return;
+
+          // A cached chart point must be the same no matter in which context
+          // the point was pulled back first, or else the result would depend
+          // on the order of previous calls (e.g., with several threads). So
+          // only use initial guesses that depend on the point itself.
+          Point<dim> guess = quadratic_approximation[cell->index()].compute(
+            surrounding_points[point_index]);
+          chart_points[point_index] =
+            pull_back(cell, surrounding_points[point_index], guess);
+          if (chart_points[point_index][0] ==
+              internal::invalid_pull_back_coordinate)
+            {
+              for (unsigned int d = 0; d < dim; ++d)
+                guess[d] = 0.5;
+              chart_points[point_index] =
+                pull_back(cell, surrounding_points[point_index], guess);
+            }
+
+          if (chart_points[point_index][0] !=
+              internal::invalid_pull_back_coordinate)
+            cache_chart_point(cell->index(),
+                              surrounding_points[point_index],
+                              chart_points[point_index]);
+          return;
+        }
+
       Point<dim> guess;
       // an optimization: keep track of whether or not we used the quadratic
       // approximation so that we don't call pull_back with the same
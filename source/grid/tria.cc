@@ -18,6 +18,7 @@
 #include <deal.II/base/mpi.templates.h>
 #include <deal.II/base/mpi_large_count.h>
 #include <deal.II/base/mpi_stub.h>
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/thread_management.h>
 #include <deal.II/base/utilities.h>
 
@@ -35,13 +36,17 @@
 #include <deal.II/grid/tria_iterator.h>
 #include <deal.II/grid/tria_levels.h>
 
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
 #include <boost/archive/text_iarchive.hpp>
 #include <boost/archive/text_oarchive.hpp>
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cmath>
 #include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <functional>
 #include <limits>
@@ -49,6 +54,7 @@
 #include <map>
 #include <memory>
 #include <numeric>
+#include <sstream>
 
 
 DEAL_II_NAMESPACE_OPEN
@@ -56,6 +62,56 @@ DEAL_II_NAMESPACE_OPEN
 
 namespace internal
 {
+  /**
+   * The first line of the files written by Triangulation::save(), used to
+   * identify the binary format of the archive that follows it.
+   */
+  constexpr const char *binary_triangulation_file_magic =
+    "deal.II binary triangulation archive";
+
+  /**
+   * The version of the binary format written by Triangulation::save(). It
+   * has to be incremented whenever the layout of the archive changes.
+   */
+  constexpr unsigned int binary_triangulation_file_version = 1;
+
+  namespace
+  {
+    /**
+     * Return a description of the byte order and the sizes of the
+     * fundamental types of the current machine. A binary archive can only
+     * be read on a machine for which this description is the same as on the
+     * one that wrote it, so Triangulation::save() stores it in the second
+     * line of its files and Triangulation::load() compares it.
+     */
+    std::string
+    binary_triangulation_file_platform()
+    {
+      const std::uint32_t probe = 1;
+      unsigned char       first_byte;
+      std::memcpy(&first_byte, &probe, 1);
+
+      std::ostringstream description;
+      description << (first_byte == 1 ? "little-endian" : "big-endian")
+                  << " bool=" << sizeof(bool) << " int=" << sizeof(int)
+                  << " long=" << sizeof(long)
+                  << " size_t=" << sizeof(std::size_t)
+                  << " double=" << sizeof(double);
+      return description.str();
+    }
+
+
+
+    /**
+     * The minimal number of cells (or other objects) in the chunks into which
+     * the loops over all cells of a level, or over all objects created
+     * during refinement, are split for working on them in parallel.
+     */
+    constexpr unsigned int minimum_parallel_grain_size = 1024;
+  } // namespace
+
+
+
   namespace TriangulationImplementation
   {
     NumberCache<1>::NumberCache()
@@ -747,13 +803,16 @@ namespace internal
             size_header +
             static_cast<MPI_Offset>(global_first_cell) * bytes_per_cell;
 
-          ierr =
-            Utilities::MPI::LargeCount::File_write_at_c(fh,
-                                                        my_global_file_position,
-                                                        src_data_fixed.data(),
-                                                        src_data_fixed.size(),
-                                                        MPI_BYTE,
-                                                        MPI_STATUS_IGNORE);
+          // Use the collective variant so that the MPI-IO implementation can
+          // aggregate the contiguous pieces of all processes into large
+          // writes.
+          ierr = Utilities::MPI::LargeCount::File_write_at_all_c(
+            fh,
+            my_global_file_position,
+            src_data_fixed.data(),
+            src_data_fixed.size(),
+            MPI_BYTE,
+            MPI_STATUS_IGNORE);
           AssertThrowMPI(ierr);
 
           ierr = MPI_File_close(&fh);
@@ -804,7 +863,7 @@ namespace internal
                               std::numeric_limits<int>::max()),
                           ExcNotImplemented());
 
-              ierr = Utilities::MPI::LargeCount::File_write_at_c(
+              ierr = Utilities::MPI::LargeCount::File_write_at_all_c(
                 fh,
                 my_global_file_position,
                 src_sizes_variable.data(),
@@ -832,7 +891,7 @@ namespace internal
               prefix_sum;
 
             // Write data consecutively into file.
-            ierr = Utilities::MPI::LargeCount::File_write_at_c(
+            ierr = Utilities::MPI::LargeCount::File_write_at_all_c(
               fh,
               my_global_file_position,
               src_data_variable.data(),
@@ -949,7 +1008,7 @@ namespace internal
           // location in the file.
           sizes_fixed_cumulative.resize(1 + n_attached_deserialize_fixed +
                                         (variable_size_data_stored ? 1 : 0));
-          ierr = Utilities::MPI::LargeCount::File_read_at_c(
+          ierr = Utilities::MPI::LargeCount::File_read_at_all_c(
             fh,
             0,
             sizes_fixed_cumulative.data(),
@@ -973,13 +1032,13 @@ namespace internal
             size_header +
             static_cast<MPI_Offset>(global_first_cell) * bytes_per_cell;
 
-          ierr =
-            Utilities::MPI::LargeCount::File_read_at_c(fh,
-                                                       my_global_file_position,
-                                                       dest_data_fixed.data(),
-                                                       dest_data_fixed.size(),
-                                                       MPI_BYTE,
-                                                       MPI_STATUS_IGNORE);
+          ierr = Utilities::MPI::LargeCount::File_read_at_all_c(
+            fh,
+            my_global_file_position,
+            dest_data_fixed.data(),
+            dest_data_fixed.size(),
+            MPI_BYTE,
+            MPI_STATUS_IGNORE);
           AssertThrowMPI(ierr);
 
 
@@ -1016,7 +1075,7 @@ namespace internal
             const MPI_Offset my_global_file_position_sizes =
               static_cast<MPI_Offset>(global_first_cell) * sizeof(unsigned int);
 
-            ierr = Utilities::MPI::LargeCount::File_read_at_c(
+            ierr = Utilities::MPI::LargeCount::File_read_at_all_c(
               fh,
               my_global_file_position_sizes,
               dest_sizes_variable.data(),
@@ -1048,7 +1107,7 @@ namespace internal
 
             dest_data_variable.resize(size_on_proc);
 
-            ierr = Utilities::MPI::LargeCount::File_read_at_c(
+            ierr = Utilities::MPI::LargeCount::File_read_at_all_c(
               fh,
               my_global_file_position,
               dest_data_variable.data(),
@@ -2359,8 +2418,12 @@ namespace internal
               tria_objects.boundary_or_material_id.reserve(new_size);
               tria_objects.boundary_or_material_id.resize(new_size);
 
-              tria_objects.user_data.reserve(new_size);
-              tria_objects.user_data.resize(new_size);
+              // user data is only allocated once it is first set
+              if (tria_objects.user_data_is_allocated())
+                {
+                  tria_objects.user_data.reserve(new_size);
+                  tria_objects.user_data.resize(new_size);
+                }
 
               tria_objects.manifold_id.reserve(new_size);
               tria_objects.manifold_id.insert(tria_objects.manifold_id.end(),
@@ -2424,8 +2487,12 @@ namespace internal
                                                 tria_objects.manifold_id.size(),
                                               numbers::flat_manifold_id);
 
-              tria_objects.user_data.reserve(new_size);
-              tria_objects.user_data.resize(new_size);
+              // user data is only allocated once it is first set
+              if (tria_objects.user_data_is_allocated())
+                {
+                  tria_objects.user_data.reserve(new_size);
+                  tria_objects.user_data.resize(new_size);
+                }
 
               tria_objects.refinement_cases.reserve(new_size);
               tria_objects.refinement_cases.insert(
@@ -2460,7 +2527,8 @@ namespace internal
       Assert(tria_object.n_objects() == tria_object.manifold_id.size(),
              ExcMemoryInexact(tria_object.n_objects(),
                               tria_object.manifold_id.size()));
-      Assert(tria_object.n_objects() == tria_object.user_data.size(),
+      Assert(tria_object.user_data.empty() ||
+               tria_object.n_objects() == tria_object.user_data.size(),
              ExcMemoryInexact(tria_object.n_objects(),
                               tria_object.user_data.size()));
 
@@ -3671,7 +3739,8 @@ namespace internal
             BoundaryOrMaterialId());
         obj.manifold_id.assign(size, -1);
         obj.user_flags.assign(size, false);
-        obj.user_data.resize(size);
+        obj.user_data.clear();
+        obj.user_data_allocation.is_allocated = false;
 
         if (structdim > 1) // TODO: why?
           obj.refinement_cases.assign(size, 0);
@@ -5052,85 +5121,224 @@ namespace internal
             triangulation.vertices_used.resize(needed_vertices, false);
           }
 
+        // The new vertices, lines, and cells are created in two phases. We
+        // first walk over the objects to be refined in the order in which
+        // they would be refined one after the other, count how many new
+        // objects each of them needs, and give out the free slots in the
+        // arrays of vertices, lines, and cells in this order. This phase is
+        // cheap and also sets all flags that are stored in bit fields (such
+        // as the used flags), which cannot be written concurrently. We then
+        // fill in the new objects in parallel, including the computation of
+        // the locations of new vertices through the manifolds, which is the
+        // expensive part of refinement. Since each object only writes into
+        // the slots it has been given, the numbering of the new objects does
+        // not depend on the number of threads and is the same as if we had
+        // created them one after the other.
+        using raw_line_iterator =
+          typename Triangulation<dim, spacedim>::raw_line_iterator;
+        using raw_cell_iterator =
+          typename Triangulation<dim, spacedim>::raw_cell_iterator;
+
         unsigned int next_unused_vertex = 0;
+        const auto   get_next_unused_vertex = [&triangulation,
+                                             &next_unused_vertex]() {
+          while (next_unused_vertex < triangulation.vertices_used.size() &&
+                 triangulation.vertices_used[next_unused_vertex] == true)
+            ++next_unused_vertex;
+          Assert(next_unused_vertex < triangulation.vertices.size(),
+                 ExcMessage(
+                   "Internal error: During refinement, the triangulation "
+                   "wants to access an element of the 'vertices' array "
+                   "but it turns out that the array is not large "
+                   "enough."));
+          triangulation.vertices_used[next_unused_vertex] = true;
+          return next_unused_vertex;
+        };
 
-        {
-          typename Triangulation<dim, spacedim>::active_line_iterator
-            line = triangulation.begin_active_line(),
-            endl = triangulation.end_line();
-          typename Triangulation<dim, spacedim>::raw_line_iterator
-            next_unused_line = triangulation.begin_raw_line();
+        const std::vector<bool> &lines_used = triangulation.faces->lines.used;
 
-          for (; line != endl; ++line)
+        {
+          std::vector<typename Triangulation<dim, spacedim>::line_iterator>
+            lines_to_refine;
+          for (typename Triangulation<dim, spacedim>::active_line_iterator
+                 line = triangulation.begin_active_line();
+               line != triangulation.end_line();
+               ++line)
             if (line->user_flag_set())
-              {
-                // This line needs to be refined. Find the next unused vertex
-                // and set it appropriately
-                while (triangulation.vertices_used[next_unused_vertex] == true)
-                  ++next_unused_vertex;
-                Assert(next_unused_vertex < triangulation.vertices.size(),
-                       ExcMessage(
-                         "Internal error: During refinement, the triangulation "
-                         "wants to access an element of the 'vertices' array "
-                         "but it turns out that the array is not large "
-                         "enough."));
-                triangulation.vertices_used[next_unused_vertex] = true;
+              lines_to_refine.push_back(line);
 
-                triangulation.vertices[next_unused_vertex] = line->center(true);
+          // each line needs a new vertex and a pair of consecutive new lines
+          std::vector<unsigned int> new_vertex(lines_to_refine.size());
+          std::vector<unsigned int> first_child(lines_to_refine.size());
+          unsigned int              next_unused_line = 0;
+          for (unsigned int i = 0; i < lines_to_refine.size(); ++i)
+            {
+              new_vertex[i] = get_next_unused_vertex();
 
-                bool pair_found = false;
-                for (; next_unused_line != endl; ++next_unused_line)
-                  if (!next_unused_line->used() &&
-                      !(++next_unused_line)->used())
-                    {
-                      --next_unused_line;
-                      pair_found = true;
-                      break;
-                    }
-                Assert(pair_found, ExcInternalError());
+              while (next_unused_line + 1 < lines_used.size() &&
+                     (lines_used[next_unused_line] == true ||
+                      lines_used[next_unused_line + 1] == true))
+                ++next_unused_line;
+              Assert(next_unused_line + 1 < lines_used.size(),
+                     ExcInternalError());
+              first_child[i] = next_unused_line;
 
-                line->set_children(0, next_unused_line->index());
+              for (unsigned int c = 0; c < 2; ++c)
+                {
+                  const raw_line_iterator child(&triangulation,
+                                                0,
+                                                next_unused_line + c);
+                  AssertIsNotUsed(child);
+                  child->set_used_flag();
+                  child->clear_user_flag();
+                }
+              next_unused_line += 2;
 
-                const typename Triangulation<dim, spacedim>::raw_line_iterator
-                  children[2] = {next_unused_line, ++next_unused_line};
+              lines_to_refine[i]->clear_user_flag();
+            }
 
-                AssertIsNotUsed(children[0]);
-                AssertIsNotUsed(children[1]);
+          dealii::parallel::apply_to_subranges(
+            0U,
+            static_cast<unsigned int>(lines_to_refine.size()),
+            [&](const unsigned int begin, const unsigned int end) {
+              for (unsigned int i = begin; i < end; ++i)
+                {
+                  const auto &line = lines_to_refine[i];
 
-                children[0]->set_bounding_object_indices(
-                  {line->vertex_index(0), next_unused_vertex});
-                children[1]->set_bounding_object_indices(
-                  {next_unused_vertex, line->vertex_index(1)});
+                  triangulation.vertices[new_vertex[i]] = line->center(true);
 
-                for (auto &child : children)
-                  {
-                    child->set_used_flag();
-                    child->clear_children();
-                    child->clear_user_data();
-                    child->clear_user_flag();
-                    child->set_boundary_id_internal(line->boundary_id());
-                    child->set_manifold_id(line->manifold_id());
-                    // Line orientation is relative to the cell it is on so
-                    // those cannot be set at this point.
-                  }
+                  line->set_children(0, first_child[i]);
 
-                line->clear_user_flag();
-              }
+                  const std::array<raw_line_iterator, 2> children{
+                    {raw_line_iterator(&triangulation, 0, first_child[i]),
+                     raw_line_iterator(&triangulation,
+                                       0,
+                                       first_child[i] + 1)}};
+
+                  children[0]->set_bounding_object_indices(
+                    {line->vertex_index(0), new_vertex[i]});
+                  children[1]->set_bounding_object_indices(
+                    {new_vertex[i], line->vertex_index(1)});
+
+                  for (const auto &child : children)
+                    {
+                      child->clear_children();
+                      child->clear_user_data();
+                      child->set_boundary_id_internal(line->boundary_id());
+                      child->set_manifold_id(line->manifold_id());
+                      // Line orientation is relative to the cell it is on so
+                      // those cannot be set at this point.
+                    }
+                }
+            },
+            minimum_parallel_grain_size);
         }
 
         reserve_space(triangulation.faces->lines, 0, n_single_lines);
 
-        typename Triangulation<dim, spacedim>::DistortedCellList
-          cells_with_distorted_children;
+        // collect the cells to be refined, level by level, and count the new
+        // vertices, lines, and cells each of them needs. the prefix sums of
+        // these counts tell us where in the lists of new objects the ones of
+        // each cell are stored
+        std::vector<typename Triangulation<dim, spacedim>::cell_iterator>
+          cells_to_refine;
+        for (int level = 0;
+             level < static_cast<int>(triangulation.levels.size()) - 1;
+             ++level)
+          for (const auto &cell :
+               triangulation.active_cell_iterators_on_level(level))
+            if (cell->refine_flag_set())
+              {
+                AssertThrow(cell->reference_cell() ==
+                                ReferenceCells::Triangle ||
+                              cell->reference_cell() ==
+                                ReferenceCells::Quadrilateral,
+                            ExcNotImplemented());
+                cells_to_refine.push_back(cell);
+              }
 
-        typename Triangulation<dim, spacedim>::raw_line_iterator
-          next_unused_line = triangulation.begin_raw_line();
+        const unsigned int n_cells_to_refine = cells_to_refine.size();
+        std::vector<unsigned int> vertex_offsets(n_cells_to_refine + 1, 0);
+        std::vector<unsigned int> line_offsets(n_cells_to_refine + 1, 0);
+        std::vector<unsigned int> child_offsets(n_cells_to_refine + 1, 0);
+        for (unsigned int i = 0; i < n_cells_to_refine; ++i)
+          {
+            const bool is_quad = cells_to_refine[i]->reference_cell() ==
+                                 ReferenceCells::Quadrilateral;
+            vertex_offsets[i + 1] = is_quad ? 1 : 0;
+            line_offsets[i + 1]   = is_quad ? 4 : 3;
+            child_offsets[i + 1] =
+              cells_to_refine[i]->reference_cell().n_isotropic_children();
+          }
+        std::partial_sum(vertex_offsets.begin(),
+                         vertex_offsets.end(),
+                         vertex_offsets.begin());
+        std::partial_sum(line_offsets.begin(),
+                         line_offsets.end(),
+                         line_offsets.begin());
+        std::partial_sum(child_offsets.begin(),
+                         child_offsets.end(),
+                         child_offsets.begin());
+
+        std::vector<unsigned int> new_vertex_indices(vertex_offsets.back());
+        std::vector<unsigned int> new_line_indices(line_offsets.back());
+        std::vector<unsigned int> new_cell_indices(child_offsets.back());
+        {
+          unsigned int              next_unused_line = 0;
+          std::vector<unsigned int> next_unused_cell(
+            triangulation.levels.size(), 0);
+          for (unsigned int i = 0; i < n_cells_to_refine; ++i)
+            {
+              const auto &cell = cells_to_refine[i];
+
+              for (unsigned int j = vertex_offsets[i]; j < vertex_offsets[i + 1];
+                   ++j)
+                new_vertex_indices[j] = get_next_unused_vertex();
+
+              for (unsigned int j = line_offsets[i]; j < line_offsets[i + 1];
+                   ++j)
+                {
+                  while (next_unused_line < lines_used.size() &&
+                         lines_used[next_unused_line] == true)
+                    ++next_unused_line;
+                  const raw_line_iterator new_line(&triangulation,
+                                                   0,
+                                                   next_unused_line);
+                  AssertIsNotUsed(new_line);
+                  new_line->set_used_flag();
+                  new_line->clear_user_flag();
+                  new_line_indices[j] = next_unused_line++;
+                }
+
+              // children are stored in pairs of consecutive cells
+              const unsigned int child_level = cell->level() + 1;
+              const std::vector<bool> &cells_used =
+                triangulation.levels[child_level]->cells.used;
+              unsigned int &next_cell = next_unused_cell[child_level];
+              for (unsigned int j = child_offsets[i], c = 0;
+                   j < child_offsets[i + 1];
+                   ++j, ++c)
+                {
+                  if (c % 2 == 0)
+                    while (next_cell < cells_used.size() &&
+                           cells_used[next_cell] == true)
+                      ++next_cell;
+                  const raw_cell_iterator child(&triangulation,
+                                                child_level,
+                                                next_cell);
+                  AssertIsNotUsed(child);
+                  child->set_used_flag();
+                  child->clear_user_flag();
+                  new_cell_indices[j] = next_cell++;
+                }
+            }
+        }
 
-        const auto create_children = [](auto         &triangulation,
-                                        unsigned int &next_unused_vertex,
-                                        auto         &next_unused_line,
-                                        auto         &next_unused_cell,
-                                        const auto   &cell) {
+        const auto create_children = [&triangulation](
+                                       const auto         &cell,
+                                       const unsigned int *cell_new_vertices,
+                                       const unsigned int *cell_new_lines,
+                                       const unsigned int *cell_new_cells) {
           const auto ref_case = cell->refine_flag_set();
           cell->clear_refine_flag();
 
@@ -5155,25 +5363,13 @@ namespace internal
 
           if (cell->reference_cell() == ReferenceCells::Quadrilateral)
             {
-              while (triangulation.vertices_used[next_unused_vertex] == true)
-                ++next_unused_vertex;
-              Assert(
-                next_unused_vertex < triangulation.vertices.size(),
-                ExcMessage(
-                  "Internal error: During refinement, the triangulation wants "
-                  "to access an element of the 'vertices' array but it turns "
-                  "out that the array is not large enough."));
-              triangulation.vertices_used[next_unused_vertex] = true;
-
-              new_vertices[8] = next_unused_vertex;
-
-              triangulation.vertices[next_unused_vertex] =
+              new_vertices[8] = cell_new_vertices[0];
+
+              triangulation.vertices[new_vertices[8]] =
                 cell->center(true, true);
             }
 
-          std::array<typename Triangulation<dim, spacedim>::raw_line_iterator,
-                     12>
-                                                       new_lines;
+          std::array<raw_line_iterator, 12>            new_lines;
           std::array<types::geometric_orientation, 12> inherited_orientations;
           inherited_orientations.fill(numbers::default_geometric_orientation);
           unsigned int lmin = 0;
@@ -5201,14 +5397,8 @@ namespace internal
             }
 
           for (unsigned int l = lmin; l < lmax; ++l)
-            {
-              while (next_unused_line->used() == true)
-                ++next_unused_line;
-              new_lines[l] = next_unused_line;
-              ++next_unused_line;
-
-              AssertIsNotUsed(new_lines[l]);
-            }
+            new_lines[l] =
+              raw_line_iterator(&triangulation, 0, cell_new_lines[l - lmin]);
 
           // set up lines which have parents:
           for (const unsigned int face_no : cell->face_indices())
@@ -5263,8 +5453,6 @@ namespace internal
 
           for (unsigned int l = lmin; l < lmax; ++l)
             {
-              new_lines[l]->set_used_flag();
-              new_lines[l]->clear_user_flag();
               new_lines[l]->clear_user_data();
               new_lines[l]->clear_children();
               // new lines are always internal.
@@ -5275,8 +5463,6 @@ namespace internal
 
           typename Triangulation<dim, spacedim>::raw_cell_iterator
             subcells[GeometryInfo<dim>::max_children_per_cell];
-          while (next_unused_cell->used() == true)
-            ++next_unused_cell;
 
           unsigned int n_children = 0;
           if (cell->reference_cell() == ReferenceCells::Triangle)
@@ -5287,14 +5473,9 @@ namespace internal
             AssertThrow(false, ExcNotImplemented());
 
           for (unsigned int i = 0; i < n_children; ++i)
-            {
-              AssertIsNotUsed(next_unused_cell);
-              subcells[i] = next_unused_cell;
-              ++next_unused_cell;
-              if (i % 2 == 1 && i < n_children - 1)
-                while (next_unused_cell->used() == true)
-                  ++next_unused_cell;
-            }
+            subcells[i] = raw_cell_iterator(&triangulation,
+                                            cell->level() + 1,
+                                            cell_new_cells[i]);
 
           // Assign lines to child cells:
           constexpr unsigned int X = numbers::invalid_unsigned_int;
@@ -5325,9 +5506,7 @@ namespace internal
                    new_lines[child_lines[i][2]]->index(),
                    new_lines[child_lines[i][3]]->index()});
 
-              subcells[i]->set_used_flag();
               subcells[i]->clear_refine_flag();
-              subcells[i]->clear_user_flag();
               subcells[i]->clear_user_data();
               subcells[i]->clear_children();
               // inherit material properties
@@ -5338,8 +5517,7 @@ namespace internal
               triangulation.levels[subcells[i]->level()]
                 ->reference_cell[subcells[i]->index()] = cell->reference_cell();
 
-              // Finally, now that children are marked as used, we can set
-              // orientation flags:
+              // Finally, set orientation flags:
               for (unsigned int face_no : cell->face_indices())
                 subcells[i]->set_combined_face_orientation(
                   face_no, inherited_orientations[child_lines[i][face_no]]);
@@ -5359,44 +5537,55 @@ namespace internal
             cell->set_children(2 * i, subcells[2 * i]->index());
 
           cell->set_refinement_case(ref_case);
-
-          if (dim == spacedim - 1)
-            for (unsigned int c = 0; c < n_children; ++c)
-              cell->child(c)->set_direction_flag(cell->direction_flag());
         };
 
-        for (int level = 0;
-             level < static_cast<int>(triangulation.levels.size()) - 1;
-             ++level)
+        // create the children of all cells in parallel, and remember which
+        // of them are distorted
+        std::vector<std::uint8_t> has_distorted_children_flag(
+          n_cells_to_refine, 0);
+        dealii::parallel::apply_to_subranges(
+          0U,
+          n_cells_to_refine,
+          [&](const unsigned int begin, const unsigned int end) {
+            for (unsigned int i = begin; i < end; ++i)
+              {
+                const auto &cell = cells_to_refine[i];
+                create_children(cell,
+                                new_vertex_indices.data() + vertex_offsets[i],
+                                new_line_indices.data() + line_offsets[i],
+                                new_cell_indices.data() + child_offsets[i]);
+
+                if (cell->reference_cell() == ReferenceCells::Quadrilateral &&
+                    check_for_distorted_cells &&
+                    has_distorted_children<dim, spacedim>(cell))
+                  has_distorted_children_flag[i] = 1;
+              }
+          },
+          minimum_parallel_grain_size);
+
+        // finally set the direction flags, which are stored in a bit field,
+        // and inform the listeners in the order in which the cells would
+        // have been refined one after the other
+        typename Triangulation<dim, spacedim>::DistortedCellList
+          cells_with_distorted_children;
+        for (unsigned int i = 0; i < n_cells_to_refine; ++i)
           {
-            typename Triangulation<dim, spacedim>::raw_cell_iterator
-              next_unused_cell = triangulation.begin_raw(level + 1);
+            const auto &cell = cells_to_refine[i];
 
-            for (const auto &cell :
-                 triangulation.active_cell_iterators_on_level(level))
-              if (cell->refine_flag_set())
-                {
-                  create_children(triangulation,
-                                  next_unused_vertex,
-                                  next_unused_line,
-                                  next_unused_cell,
-                                  cell);
+            if (dim == spacedim - 1)
+              for (unsigned int c = 0; c < cell->n_children(); ++c)
+                cell->child(c)->set_direction_flag(cell->direction_flag());
 
-                  if (cell->reference_cell() == ReferenceCells::Quadrilateral &&
-                      check_for_distorted_cells &&
-                      has_distorted_children<dim, spacedim>(cell))
-                    cells_with_distorted_children.distorted_cells.push_back(
-                      cell);
+            if (has_distorted_children_flag[i] == 1)
+              cells_with_distorted_children.distorted_cells.push_back(cell);
 
-                  triangulation.signals.post_refinement_on_cell(cell);
-                }
+            triangulation.signals.post_refinement_on_cell(cell);
           }
 
         return cells_with_distorted_children;
       }
 
 
-
       /**
        * A function that performs the
        * refinement of a triangulation in 1d.
@@ -6157,6 +6346,15 @@ namespace internal
                              ExcInternalError());
           }
 
+        // As in 2d, the new vertices, lines, faces, and cells are created in
+        // two phases: we first give out the free slots to the objects to be
+        // refined in the order in which they would be refined one after the
+        // other, setting all flags that are stored in bit fields on the way,
+        // and then fill in the new objects in parallel. This way, the
+        // numbering of the new objects does not depend on the number of
+        // threads. The orientations of the lines of new faces are also stored
+        // in a bit field, so they are computed in parallel into a buffer
+        // first and then copied sequentially.
         unsigned int current_vertex = 0;
 
         // helper function - find the next available vertex number and mark it
@@ -6173,77 +6371,135 @@ namespace internal
           return next_vertex;
         };
 
+        // the value used in the buffers of line orientations below for the
+        // lines of new faces whose orientation is not set while filling in
+        // the new faces
+        const std::array<types::geometric_orientation, 4> unset_orientations{
+          {numbers::invalid_geometric_orientation,
+           numbers::invalid_geometric_orientation,
+           numbers::invalid_geometric_orientation,
+           numbers::invalid_geometric_orientation}};
+
+        // copy the orientations from such a buffer into the bit field in
+        // which they are stored
+        const auto set_line_orientations =
+          [](const raw_quad_iterator                           &new_face,
+             const std::array<types::geometric_orientation, 4> &orientations) {
+            for (unsigned int l = 0; l < 4; ++l)
+              if (orientations[l] != numbers::invalid_geometric_orientation)
+                new_face->set_line_orientation(l, orientations[l]);
+          };
+
         // LINES
         {
-          typename Triangulation<dim, spacedim>::active_line_iterator
-            line = triangulation.begin_active_line(),
-            endl = triangulation.end_line();
-          raw_line_iterator next_unused_line = triangulation.begin_raw_line();
+          std::vector<typename Triangulation<dim, spacedim>::line_iterator>
+            lines_to_refine;
+          for (typename Triangulation<dim, spacedim>::active_line_iterator
+                 line = triangulation.begin_active_line();
+               line != triangulation.end_line();
+               ++line)
+            if (line->user_flag_set())
+              lines_to_refine.push_back(line);
 
-          for (; line != endl; ++line)
+          // each line needs a new vertex and a pair of consecutive new lines
+          std::vector<unsigned int> new_vertex(lines_to_refine.size());
+          std::vector<unsigned int> first_child(lines_to_refine.size());
+          for (unsigned int i = 0; i < lines_to_refine.size(); ++i)
             {
-              if (line->user_flag_set() == false)
-                continue;
-
-              next_unused_line =
+              raw_line_iterator next_unused_line =
                 triangulation.faces->lines.template next_free_pair_object<1>(
                   triangulation);
               Assert(next_unused_line.state() == IteratorState::valid,
                      ExcInternalError());
 
               // now we found two consecutive unused lines, such
-              // that the children of a line will be consecutive.
-              // then set the child pointer of the present line
-              line->set_children(0, next_unused_line->index());
+              // that the children of a line will be consecutive
+              first_child[i] = next_unused_line->index();
 
               const std::array<raw_line_iterator, 2> children{
                 {next_unused_line, ++next_unused_line}};
-
-              AssertIsNotUsed(children[0]);
-              AssertIsNotUsed(children[1]);
+              for (const auto &child : children)
+                {
+                  AssertIsNotUsed(child);
+                  child->set_used_flag();
+                  child->clear_user_flag();
+                }
 
               current_vertex =
                 get_next_unused_vertex(current_vertex,
                                        triangulation.vertices_used);
-              triangulation.vertices[current_vertex] = line->center(true);
+              new_vertex[i] = current_vertex;
 
-              children[0]->set_bounding_object_indices(
-                {line->vertex_index(0), current_vertex});
-              children[1]->set_bounding_object_indices(
-                {current_vertex, line->vertex_index(1)});
+              lines_to_refine[i]->clear_user_flag();
+            }
 
-              const auto manifold_id = line->manifold_id();
-              const auto boundary_id = line->boundary_id();
-              for (const auto &child : children)
+          dealii::parallel::apply_to_subranges(
+            0U,
+            static_cast<unsigned int>(lines_to_refine.size()),
+            [&](const unsigned int begin, const unsigned int end) {
+              for (unsigned int i = begin; i < end; ++i)
                 {
-                  child->set_used_flag();
-                  child->clear_children();
-                  child->clear_user_data();
-                  child->clear_user_flag();
-                  child->set_boundary_id_internal(boundary_id);
-                  child->set_manifold_id(manifold_id);
-                }
+                  const auto &line = lines_to_refine[i];
 
-              line->clear_user_flag();
-            }
+                  triangulation.vertices[new_vertex[i]] = line->center(true);
+
+                  // set the child pointer of the present line
+                  line->set_children(0, first_child[i]);
+
+                  const std::array<raw_line_iterator, 2> children{
+                    {raw_line_iterator(&triangulation, 0, first_child[i]),
+                     raw_line_iterator(&triangulation,
+                                       0,
+                                       first_child[i] + 1)}};
+
+                  children[0]->set_bounding_object_indices(
+                    {line->vertex_index(0), new_vertex[i]});
+                  children[1]->set_bounding_object_indices(
+                    {new_vertex[i], line->vertex_index(1)});
+
+                  const auto manifold_id = line->manifold_id();
+                  const auto boundary_id = line->boundary_id();
+                  for (const auto &child : children)
+                    {
+                      child->clear_children();
+                      child->clear_user_data();
+                      child->set_boundary_id_internal(boundary_id);
+                      child->set_manifold_id(manifold_id);
+                    }
+                }
+            },
+            minimum_parallel_grain_size);
         }
 
         // FACES (i.e., quads or triangles, or both)
         {
-          typename Triangulation<dim, spacedim>::face_iterator
-            face = triangulation.begin_face(),
-            endf = triangulation.end_face();
-
-          for (; face != endf; ++face)
+          std::vector<typename Triangulation<dim, spacedim>::face_iterator>
+            faces_to_refine;
+          for (typename Triangulation<dim, spacedim>::face_iterator face =
+                 triangulation.begin_face();
+               face != triangulation.end_face();
+               ++face)
+            if (face->user_flag_set())
+              faces_to_refine.push_back(face);
+
+          // every face is divided into four faces and needs up to four new
+          // lines (4 quadrilateral, 3 triangle) and one new vertex for
+          // quadrilaterals
+          const unsigned int n_faces_to_refine = faces_to_refine.size();
+          std::vector<std::array<raw_line_iterator, 4>> new_lines_of_faces(
+            n_faces_to_refine);
+          std::vector<std::array<raw_quad_iterator, 4>> new_faces_of_faces(
+            n_faces_to_refine);
+          std::vector<unsigned int> new_vertex(n_faces_to_refine,
+                                               numbers::invalid_unsigned_int);
+          for (unsigned int i = 0; i < n_faces_to_refine; ++i)
             {
-              if (face->user_flag_set() == false)
-                continue;
-
-              const auto reference_face_type = face->reference_cell();
+              const auto &face                = faces_to_refine[i];
+              const auto  reference_face_type = face->reference_cell();
 
               // 1) create new lines (property is set later)
-              // maximum of 4 new lines (4 quadrilateral, 3 triangle)
-              std::array<raw_line_iterator, 4> new_lines;
+              std::array<raw_line_iterator, 4> &new_lines =
+                new_lines_of_faces[i];
               if (reference_face_type == ReferenceCells::Quadrilateral)
                 {
                   for (unsigned int l = 0; l < 2; ++l)
@@ -6267,17 +6523,12 @@ namespace internal
                   DEAL_II_NOT_IMPLEMENTED();
                 }
 
-              if constexpr (running_in_debug_mode())
-                {
-                  for (const unsigned int line : face->line_indices())
-                    AssertIsNotUsed(new_lines[line]);
-                }
-
               // 2) create new face (properties are set below). Both triangles
               // and quads are divided in four. (For historical reasons, we
               // only have 'raw_quad_iterator', not 'raw_face_iterator', but the
               // former also works if a face is actually a triangle.)
-              std::array<raw_quad_iterator, 4> new_faces;
+              std::array<raw_quad_iterator, 4> &new_faces =
+                new_faces_of_faces[i];
               for (unsigned int f = 0; f < 2; ++f)
                 {
                   auto next_unused_quad =
@@ -6286,359 +6537,473 @@ namespace internal
 
                   new_faces[2 * f]     = next_unused_quad;
                   new_faces[2 * f + 1] = ++next_unused_quad;
-
-                  face->set_children(2 * f, new_faces[2 * f]->index());
-                }
-              face->set_refinement_case(RefinementCase<2>::cut_xy);
-
-              if constexpr (running_in_debug_mode())
-                {
-                  for (const auto &quad : new_faces)
-                    AssertIsNotUsed(quad);
                 }
 
-              // 3) set vertex indices and set new vertex
-
-              // Maximum of 9 vertices per refined face (9 for Quadrilateral, 6
-              // for Triangle)
-              std::array<unsigned int, 9> vertex_indices = {};
-              unsigned int                k              = 0;
-              for (const auto i : face->vertex_indices())
-                vertex_indices[k++] = face->vertex_index(i);
-
-              for (const auto i : face->line_indices())
-                vertex_indices[k++] = face->line(i)->child(0)->vertex_index(1);
-
+              // 3) set new vertex
               if (reference_face_type == ReferenceCells::Quadrilateral)
                 {
                   current_vertex =
                     get_next_unused_vertex(current_vertex,
                                            triangulation.vertices_used);
-                  vertex_indices[k++] = current_vertex;
-
-                  triangulation.vertices[current_vertex] =
-                    face->center(true, true);
+                  new_vertex[i] = current_vertex;
                 }
 
-              // 4) set new lines on these faces and their properties
-              std::array<raw_line_iterator, 12> lines;
-              unsigned int                      n_lines = 0;
-              for (unsigned int l = 0; l < face->n_lines(); ++l)
-                for (unsigned int c = 0; c < 2; ++c)
-                  lines[n_lines++] = face->line(l)->child(
-                    child_line_index(c, face->line_orientation(l)));
-
-              for (unsigned int l = 0; l < face->n_lines(); ++l)
-                lines[n_lines++] = new_lines[l];
-
-              std::array<int, 12> line_indices;
-              for (unsigned int i = 0; i < n_lines; ++i)
-                line_indices[i] = lines[i]->index();
-
-              static constexpr dealii::ndarray<unsigned int, 12, 2>
-                line_vertices_quad{{{{0, 4}},
-                                    {{4, 2}},
-                                    {{1, 5}},
-                                    {{5, 3}},
-                                    {{0, 6}},
-                                    {{6, 1}},
-                                    {{2, 7}},
-                                    {{7, 3}},
-                                    {{6, 8}},
-                                    {{8, 7}},
-                                    {{4, 8}},
-                                    {{8, 5}}}};
-
-              static constexpr dealii::ndarray<unsigned int, 4, 4>
-                quad_lines_quad{{{{0, 8, 4, 10}},
-                                 {{8, 2, 5, 11}},
-                                 {{1, 9, 10, 6}},
-                                 {{9, 3, 11, 7}}}};
-
-              static constexpr dealii::ndarray<unsigned int, 12, 2>
-                line_vertices_tri{{{{0, 3}},
-                                   {{3, 1}},
-                                   {{1, 4}},
-                                   {{4, 2}},
-                                   {{2, 5}},
-                                   {{5, 0}},
-                                   {{3, 4}},
-                                   {{4, 5}},
-                                   {{3, 5}},
-                                   {{X, X}},
-                                   {{X, X}},
-                                   {{X, X}}}};
-
-              static constexpr dealii::ndarray<unsigned int, 4, 4>
-                tri_lines_tri{{{{0, 8, 5, X}},
-                               {{1, 2, 6, X}},
-                               {{7, 3, 4, X}},
-                               {{6, 7, 8, X}}}};
-
-              static constexpr dealii::ndarray<unsigned int, 4, 4, 2>
-                tri_line_vertices_tri{
-                  {{{{{0, 3}}, {{3, 5}}, {{5, 0}}, {{X, X}}}},
-                   {{{{3, 1}}, {{1, 4}}, {{4, 3}}, {{X, X}}}},
-                   {{{{5, 4}}, {{4, 2}}, {{2, 5}}, {{X, X}}}},
-                   {{{{3, 4}}, {{4, 5}}, {{5, 3}}, {{X, X}}}}}};
-
-              const auto &line_vertices =
-                (reference_face_type == ReferenceCells::Quadrilateral) ?
-                  line_vertices_quad :
-                  line_vertices_tri;
-              const auto &face_lines =
-                (reference_face_type == ReferenceCells::Quadrilateral) ?
-                  quad_lines_quad :
-                  tri_lines_tri;
-
-              for (unsigned int i = 0, j = 2 * face->n_lines();
-                   i < face->n_lines();
-                   ++i, ++j)
+              for (const unsigned int line : face->line_indices())
                 {
-                  auto &new_line = new_lines[i];
-                  new_line->set_bounding_object_indices(
-                    {vertex_indices[line_vertices[j][0]],
-                     vertex_indices[line_vertices[j][1]]});
-                  new_line->set_used_flag();
-                  new_line->clear_user_flag();
-                  new_line->clear_user_data();
-                  new_line->clear_children();
-                  new_line->set_boundary_id_internal(face->boundary_id());
-                  new_line->set_manifold_id(face->manifold_id());
+                  AssertIsNotUsed(new_lines[line]);
+                  new_lines[line]->set_used_flag();
+                  new_lines[line]->clear_user_flag();
                 }
 
-              // 5) set properties of faces
-              for (unsigned int i = 0; i < new_faces.size(); ++i)
+              for (const auto &new_face : new_faces)
                 {
-                  auto &new_face = new_faces[i];
-
+                  AssertIsNotUsed(new_face);
                   // TODO: we assume here that all children have the same type
                   // as the parent
                   triangulation.faces->set_quad_type(new_face->index(),
                                                      reference_face_type);
-
-                  if (reference_face_type == ReferenceCells::Triangle)
-                    new_face->set_bounding_object_indices(
-                      {line_indices[face_lines[i][0]],
-                       line_indices[face_lines[i][1]],
-                       line_indices[face_lines[i][2]]});
-                  else if (reference_face_type == ReferenceCells::Quadrilateral)
-                    new_face->set_bounding_object_indices(
-                      {line_indices[face_lines[i][0]],
-                       line_indices[face_lines[i][1]],
-                       line_indices[face_lines[i][2]],
-                       line_indices[face_lines[i][3]]});
-                  else
-                    DEAL_II_NOT_IMPLEMENTED();
-
                   new_face->set_used_flag();
                   new_face->clear_user_flag();
-                  new_face->clear_user_data();
-                  new_face->clear_children();
-                  new_face->set_boundary_id_internal(face->boundary_id());
-                  new_face->set_manifold_id(face->manifold_id());
+                }
+
+              face->clear_user_flag();
+            }
 
-                  [[maybe_unused]] std::set<unsigned int> s;
+          // the orientations of the lines of the four new faces of each face,
+          // or invalid_geometric_orientation for those that are not set here
+          std::vector<std::array<types::geometric_orientation, 4>>
+            new_line_orientations(4 * n_faces_to_refine, unset_orientations);
 
-                  // ... and fix orientation of lines of face for triangles,
-                  // using an expensive algorithm, quadrilaterals are treated
-                  // a few lines below by a cheaper algorithm
-                  if (reference_face_type == ReferenceCells::Triangle)
+          dealii::parallel::apply_to_subranges(
+            0U,
+            n_faces_to_refine,
+            [&](const unsigned int begin, const unsigned int end) {
+              for (unsigned int n = begin; n < end; ++n)
+                {
+                  const auto &face                = faces_to_refine[n];
+                  const auto  reference_face_type = face->reference_cell();
+                  const std::array<raw_line_iterator, 4> &new_lines =
+                    new_lines_of_faces[n];
+                  const std::array<raw_quad_iterator, 4> &new_faces =
+                    new_faces_of_faces[n];
+                  std::array<types::geometric_orientation, 4>
+                    *line_orientations = new_line_orientations.data() + 4 * n;
+
+                  for (unsigned int f = 0; f < 2; ++f)
+                    face->set_children(2 * f, new_faces[2 * f]->index());
+                  face->set_refinement_case(RefinementCase<2>::cut_xy);
+                  // 3) set vertex indices and the location of the new vertex
+
+                  // Maximum of 9 vertices per refined face (9 for
+                  // Quadrilateral, 6 for Triangle)
+                  std::array<unsigned int, 9> vertex_indices = {};
+                  unsigned int                k              = 0;
+                  for (const auto i : face->vertex_indices())
+                    vertex_indices[k++] = face->vertex_index(i);
+
+                  for (const auto i : face->line_indices())
+                    vertex_indices[k++] =
+                      face->line(i)->child(0)->vertex_index(1);
+
+                  if (reference_face_type == ReferenceCells::Quadrilateral)
                     {
-                      for (const auto f : new_face->line_indices())
-                        {
-                          const std::array<unsigned int, 2> vertices_0 = {
-                            {lines[face_lines[i][f]]->vertex_index(0),
-                             lines[face_lines[i][f]]->vertex_index(1)}};
+                      vertex_indices[k++] = new_vertex[n];
 
-                          const std::array<unsigned int, 2> vertices_1 = {
-                            {vertex_indices[tri_line_vertices_tri[i][f][0]],
-                             vertex_indices[tri_line_vertices_tri[i][f][1]]}};
+                      triangulation.vertices[new_vertex[n]] =
+                        face->center(true, true);
+                    }
 
-                          const auto orientation =
-                            ReferenceCells::Line.get_combined_orientation(
-                              make_array_view(vertices_0),
-                              make_array_view(vertices_1));
+                  // 4) set new lines on these faces and their properties
+                  std::array<raw_line_iterator, 12> lines;
+                  unsigned int                      n_lines = 0;
+                  for (unsigned int l = 0; l < face->n_lines(); ++l)
+                    for (unsigned int c = 0; c < 2; ++c)
+                      lines[n_lines++] = face->line(l)->child(
+                        child_line_index(c, face->line_orientation(l)));
+
+                  for (unsigned int l = 0; l < face->n_lines(); ++l)
+                    lines[n_lines++] = new_lines[l];
+
+                  std::array<int, 12> line_indices;
+                  for (unsigned int i = 0; i < n_lines; ++i)
+                    line_indices[i] = lines[i]->index();
+
+                  static constexpr dealii::ndarray<unsigned int, 12, 2>
+                    line_vertices_quad{{{{0, 4}},
+                                        {{4, 2}},
+                                        {{1, 5}},
+                                        {{5, 3}},
+                                        {{0, 6}},
+                                        {{6, 1}},
+                                        {{2, 7}},
+                                        {{7, 3}},
+                                        {{6, 8}},
+                                        {{8, 7}},
+                                        {{4, 8}},
+                                        {{8, 5}}}};
+
+                  static constexpr dealii::ndarray<unsigned int, 4, 4>
+                    quad_lines_quad{{{{0, 8, 4, 10}},
+                                     {{8, 2, 5, 11}},
+                                     {{1, 9, 10, 6}},
+                                     {{9, 3, 11, 7}}}};
+
+                  static constexpr dealii::ndarray<unsigned int, 12, 2>
+                    line_vertices_tri{{{{0, 3}},
+                                       {{3, 1}},
+                                       {{1, 4}},
+                                       {{4, 2}},
+                                       {{2, 5}},
+                                       {{5, 0}},
+                                       {{3, 4}},
+                                       {{4, 5}},
+                                       {{3, 5}},
+                                       {{X, X}},
+                                       {{X, X}},
+                                       {{X, X}}}};
+
+                  static constexpr dealii::ndarray<unsigned int, 4, 4>
+                    tri_lines_tri{{{{0, 8, 5, X}},
+                                   {{1, 2, 6, X}},
+                                   {{7, 3, 4, X}},
+                                   {{6, 7, 8, X}}}};
+
+                  static constexpr dealii::ndarray<unsigned int, 4, 4, 2>
+                    tri_line_vertices_tri{
+                      {{{{{0, 3}}, {{3, 5}}, {{5, 0}}, {{X, X}}}},
+                       {{{{3, 1}}, {{1, 4}}, {{4, 3}}, {{X, X}}}},
+                       {{{{5, 4}}, {{4, 2}}, {{2, 5}}, {{X, X}}}},
+                       {{{{3, 4}}, {{4, 5}}, {{5, 3}}, {{X, X}}}}}};
+
+                  const auto &line_vertices =
+                    (reference_face_type == ReferenceCells::Quadrilateral) ?
+                      line_vertices_quad :
+                      line_vertices_tri;
+                  const auto &face_lines =
+                    (reference_face_type == ReferenceCells::Quadrilateral) ?
+                      quad_lines_quad :
+                      tri_lines_tri;
+
+                  for (unsigned int i = 0, j = 2 * face->n_lines();
+                       i < face->n_lines();
+                       ++i, ++j)
+                    {
+                      auto &new_line = new_lines[i];
+                      new_line->set_bounding_object_indices(
+                        {vertex_indices[line_vertices[j][0]],
+                         vertex_indices[line_vertices[j][1]]});
+                      new_line->clear_user_data();
+                      new_line->clear_children();
+                      new_line->set_boundary_id_internal(face->boundary_id());
+                      new_line->set_manifold_id(face->manifold_id());
+                    }
+
+                  // 5) set properties of faces
+                  for (unsigned int i = 0; i < new_faces.size(); ++i)
+                    {
+                      auto &new_face = new_faces[i];
+
+                      if (reference_face_type == ReferenceCells::Triangle)
+                        new_face->set_bounding_object_indices(
+                          {line_indices[face_lines[i][0]],
+                           line_indices[face_lines[i][1]],
+                           line_indices[face_lines[i][2]]});
+                      else if (reference_face_type ==
+                               ReferenceCells::Quadrilateral)
+                        new_face->set_bounding_object_indices(
+                          {line_indices[face_lines[i][0]],
+                           line_indices[face_lines[i][1]],
+                           line_indices[face_lines[i][2]],
+                           line_indices[face_lines[i][3]]});
+                      else
+                        DEAL_II_NOT_IMPLEMENTED();
+
+                      new_face->clear_user_data();
+                      new_face->clear_children();
+                      new_face->set_boundary_id_internal(face->boundary_id());
+                      new_face->set_manifold_id(face->manifold_id());
 
+                      [[maybe_unused]] std::set<unsigned int> s;
+
+                      // ... and fix orientation of lines of face for
+                      // triangles, using an expensive algorithm,
+                      // quadrilaterals are treated a few lines below by a
+                      // cheaper algorithm
+                      if (reference_face_type == ReferenceCells::Triangle)
+                        {
+                          for (const auto f : new_face->line_indices())
+                            {
+                              const std::array<unsigned int, 2> vertices_0 = {
+                                {lines[face_lines[i][f]]->vertex_index(0),
+                                 lines[face_lines[i][f]]->vertex_index(1)}};
+
+                              const std::array<unsigned int, 2> vertices_1 = {
+                                {vertex_indices
+                                   [tri_line_vertices_tri[i][f][0]],
+                                 vertex_indices
+                                   [tri_line_vertices_tri[i][f][1]]}};
+
+                              const auto orientation =
+                                ReferenceCells::Line.get_combined_orientation(
+                                  make_array_view(vertices_0),
+                                  make_array_view(vertices_1));
+
+                              if constexpr (library_build_mode ==
+                                            LibraryBuildMode::debug)
+                                {
+                                  for (const auto i : vertices_0)
+                                    s.insert(i);
+                                  for (const auto i : vertices_1)
+                                    s.insert(i);
+                                }
+
+                              line_orientations[i][f] = orientation;
+                            }
                           if constexpr (library_build_mode ==
                                         LibraryBuildMode::debug)
                             {
-                              for (const auto i : vertices_0)
-                                s.insert(i);
-                              for (const auto i : vertices_1)
-                                s.insert(i);
+                              AssertDimension(s.size(), 3);
                             }
-
-                          new_face->set_line_orientation(f, orientation);
-                        }
-                      if constexpr (library_build_mode ==
-                                    LibraryBuildMode::debug)
-                        {
-                          AssertDimension(s.size(), 3);
                         }
                     }
-                }
 
-              // fix orientation of lines of faces for quadrilaterals with
-              // cheap algorithm
-              if (reference_face_type == ReferenceCells::Quadrilateral)
-                {
-                  static constexpr dealii::ndarray<unsigned int, 4, 2>
-                    quad_child_boundary_lines{
-                      {{{0, 2}}, {{1, 3}}, {{0, 1}}, {{2, 3}}}};
-
-                  for (unsigned int i = 0; i < 4; ++i)
-                    for (unsigned int j = 0; j < 2; ++j)
-                      new_faces[quad_child_boundary_lines[i][j]]
-                        ->set_line_orientation(i, face->line_orientation(i));
+                  // fix orientation of lines of faces for quadrilaterals with
+                  // cheap algorithm
+                  if (reference_face_type == ReferenceCells::Quadrilateral)
+                    {
+                      static constexpr dealii::ndarray<unsigned int, 4, 2>
+                        quad_child_boundary_lines{
+                          {{{0, 2}}, {{1, 3}}, {{0, 1}}, {{2, 3}}}};
+
+                      for (unsigned int i = 0; i < 4; ++i)
+                        for (unsigned int j = 0; j < 2; ++j)
+                          line_orientations[quad_child_boundary_lines[i][j]]
+                                           [i] = face->line_orientation(i);
+                    }
                 }
+            },
+            minimum_parallel_grain_size);
 
-              face->clear_user_flag();
-            }
+          for (unsigned int n = 0; n < n_faces_to_refine; ++n)
+            for (unsigned int f = 0; f < 4; ++f)
+              set_line_orientations(new_faces_of_faces[n][f],
+                                    new_line_orientations[4 * n + f]);
         }
 
-        typename Triangulation<3, spacedim>::DistortedCellList
-          cells_with_distorted_children;
-
-        typename Triangulation<dim, spacedim>::active_cell_iterator cell =
-          triangulation.begin_active(0);
+        // CELLS
+        //
+        // collect the cells to be refined, level by level, and count the new
+        // vertices, lines, and faces each of them needs. the prefix sums of
+        // these counts tell us where in the lists of new objects the ones of
+        // each cell are stored. We always get 8 children per refined cell,
+        // whether from refinement of a hex or a tet.
+        std::vector<typename Triangulation<dim, spacedim>::cell_iterator>
+          cells_to_refine;
         for (unsigned int level = 0; level != triangulation.levels.size() - 1;
              ++level)
+          for (const auto &cell :
+               triangulation.active_cell_iterators_on_level(level))
+            if (cell->refine_flag_set() != RefinementCase<dim>::no_refinement)
+              cells_to_refine.push_back(cell);
+
+        const unsigned int n_cells_to_refine = cells_to_refine.size();
+        std::vector<unsigned int> vertex_offsets(n_cells_to_refine + 1, 0);
+        std::vector<unsigned int> line_offsets(n_cells_to_refine + 1, 0);
+        std::vector<unsigned int> face_offsets(n_cells_to_refine + 1, 0);
+        for (unsigned int i = 0; i < n_cells_to_refine; ++i)
           {
-            typename Triangulation<dim, spacedim>::raw_cell_iterator
-              next_unused_cell = triangulation.begin_raw(level + 1);
-            Assert(cell == triangulation.end() ||
-                     cell->level() >= static_cast<int>(level),
-                   ExcInternalError());
+            const auto &reference_cell_type =
+              cells_to_refine[i]->reference_cell();
+            if (reference_cell_type == ReferenceCells::Hexahedron)
+              {
+                vertex_offsets[i + 1] = 1;
+                line_offsets[i + 1]   = 6;
+                face_offsets[i + 1]   = 12;
+              }
+            else if (reference_cell_type == ReferenceCells::Tetrahedron)
+              {
+                vertex_offsets[i + 1] = 0;
+                line_offsets[i + 1]   = 1;
+                face_offsets[i + 1]   = 8;
+              }
+            else
+              DEAL_II_NOT_IMPLEMENTED();
+          }
+        std::partial_sum(vertex_offsets.begin(),
+                         vertex_offsets.end(),
+                         vertex_offsets.begin());
+        std::partial_sum(line_offsets.begin(),
+                         line_offsets.end(),
+                         line_offsets.begin());
+        std::partial_sum(face_offsets.begin(),
+                         face_offsets.end(),
+                         face_offsets.begin());
+
+        std::vector<unsigned int>      new_vertices(vertex_offsets.back());
+        std::vector<raw_line_iterator> new_lines_of_cells(line_offsets.back());
+        std::vector<raw_quad_iterator> new_faces_of_cells(face_offsets.back());
+        std::vector<typename Triangulation<dim, spacedim>::raw_cell_iterator>
+          new_cells_of_cells(8 * n_cells_to_refine);
+        {
+          typename Triangulation<dim, spacedim>::raw_cell_iterator
+            next_unused_cell;
+          for (unsigned int i = 0; i < n_cells_to_refine; ++i)
+            {
+              const auto        &cell                = cells_to_refine[i];
+              const auto        &reference_cell_type = cell->reference_cell();
+              const unsigned int level               = cell->level();
+
+              for (unsigned int l = line_offsets[i]; l < line_offsets[i + 1];
+                   ++l)
+                {
+                  auto &new_line = new_lines_of_cells[l];
+                  new_line =
+                    triangulation.faces->lines
+                      .template next_free_single_object<1>(triangulation);
+
+                  AssertIsNotUsed(new_line);
+                  new_line->set_used_flag();
+                  new_line->clear_user_flag();
+                }
+
+              for (unsigned int f = face_offsets[i]; f < face_offsets[i + 1];
+                   ++f)
+                {
+                  auto &new_face = new_faces_of_cells[f];
+                  new_face =
+                    triangulation.faces->quads
+                      .template next_free_single_object<2>(triangulation);
+
+                  // TODO: faces of children have the same type as the faces
+                  //  of the parent
+                  triangulation.faces->set_quad_type(
+                    new_face->index(),
+                    reference_cell_type.face_reference_cell(0));
 
-            for (; cell != triangulation.end() &&
-                   cell->level() == static_cast<int>(level);
-                 ++cell)
+                  AssertIsNotUsed(new_face);
+                  new_face->set_used_flag();
+                  new_face->clear_user_flag();
+                  for (const auto j : new_face->line_indices())
+                    new_face->set_line_orientation(
+                      j, numbers::default_geometric_orientation);
+                }
+
+              for (unsigned int c = 0; c < 8; ++c)
+                {
+                  if (c % 2 == 0)
+                    next_unused_cell =
+                      triangulation.levels[level + 1]->cells.next_free_hex(
+                        triangulation, level + 1);
+                  else
+                    ++next_unused_cell;
+
+                  auto &new_cell = new_cells_of_cells[8 * i + c];
+                  new_cell       = next_unused_cell;
+
+                  // children have the same type as the parent
+                  triangulation.levels[new_cell->level()]
+                    ->reference_cell[new_cell->index()] = reference_cell_type;
+
+                  AssertIsNotUsed(new_cell);
+                  new_cell->set_used_flag();
+                  new_cell->clear_user_flag();
+                }
+
+              // the single new vertex in the center of a hex
+              for (unsigned int v = vertex_offsets[i];
+                   v < vertex_offsets[i + 1];
+                   ++v)
+                {
+                  current_vertex =
+                    get_next_unused_vertex(current_vertex,
+                                           triangulation.vertices_used);
+                  new_vertices[v] = current_vertex;
+                }
+            }
+        }
+
+        // The vertex indices of the cells (including the new ones) and the
+        // line chosen to cut tets into children, which are needed again when
+        // setting up the new cells, as well as the buffer for the
+        // orientations of the lines of the new faces.
+        std::vector<std::array<unsigned int, 27>> vertex_indices_of_cells(
+          n_cells_to_refine);
+        std::vector<unsigned int> chosen_lines_tetrahedron(n_cells_to_refine,
+                                                           0);
+        std::vector<std::array<types::geometric_orientation, 4>>
+          new_face_line_orientations(face_offsets.back(), unset_orientations);
+
+        // set up the new lines and faces of all cells in parallel
+        dealii::parallel::apply_to_subranges(
+          0U,
+          n_cells_to_refine,
+          [&](const unsigned int begin, const unsigned int end) {
+            for (unsigned int i = begin; i < end; ++i)
               {
-                if (cell->refine_flag_set() ==
-                    RefinementCase<dim>::no_refinement)
-                  continue;
+                const auto &cell                = cells_to_refine[i];
+                const auto &reference_cell_type = cell->reference_cell();
 
                 const RefinementCase<dim> ref_case = cell->refine_flag_set();
                 cell->clear_refine_flag();
                 cell->set_refinement_case(ref_case);
 
-                unsigned int n_new_lines = 0;
-                unsigned int n_new_faces = 0;
-                unsigned int n_new_cells = 0;
-
-                const auto &reference_cell_type = cell->reference_cell();
-                if (reference_cell_type == ReferenceCells::Hexahedron)
+                const unsigned int n_new_lines =
+                  line_offsets[i + 1] - line_offsets[i];
+                const unsigned int n_new_faces =
+                  face_offsets[i + 1] - face_offsets[i];
+                const raw_line_iterator *new_lines =
+                  new_lines_of_cells.data() + line_offsets[i];
+                const raw_quad_iterator *new_faces =
+                  new_faces_of_cells.data() + face_offsets[i];
+                typename Triangulation<dim, spacedim>::raw_cell_iterator
+                  *new_cells = new_cells_of_cells.data() + 8 * i;
+                std::array<types::geometric_orientation, 4> *line_orientations =
+                  new_face_line_orientations.data() + face_offsets[i];
+
+                for (unsigned int l = 0; l < n_new_lines; ++l)
                   {
-                    n_new_lines = 6;
-                    n_new_faces = 12;
-                    n_new_cells = 8;
-                  }
-                else if (reference_cell_type == ReferenceCells::Tetrahedron)
-                  {
-                    n_new_lines = 1;
-                    n_new_faces = 8;
-                    n_new_cells = 8;
-                  }
-                else
-                  DEAL_II_NOT_IMPLEMENTED();
-
-                std::array<raw_line_iterator, 6> new_lines;
-                for (unsigned int i = 0; i < n_new_lines; ++i)
-                  {
-                    new_lines[i] =
-                      triangulation.faces->lines
-                        .template next_free_single_object<1>(triangulation);
-
-                    AssertIsNotUsed(new_lines[i]);
-                    new_lines[i]->set_used_flag();
-                    new_lines[i]->clear_user_flag();
-                    new_lines[i]->clear_user_data();
-                    new_lines[i]->clear_children();
-                    new_lines[i]->set_boundary_id_internal(
+                    new_lines[l]->clear_user_data();
+                    new_lines[l]->clear_children();
+                    new_lines[l]->set_boundary_id_internal(
                       numbers::internal_face_boundary_id);
-                    new_lines[i]->set_manifold_id(cell->manifold_id());
+                    new_lines[l]->set_manifold_id(cell->manifold_id());
                   }
 
-                std::array<raw_quad_iterator, 12> new_faces;
-                for (unsigned int i = 0; i < n_new_faces; ++i)
+                for (unsigned int f = 0; f < n_new_faces; ++f)
                   {
-                    new_faces[i] =
-                      triangulation.faces->quads
-                        .template next_free_single_object<2>(triangulation);
-
-                    auto &new_face = new_faces[i];
-
-                    // TODO: faces of children have the same type as the faces
-                    //  of the parent
-                    triangulation.faces->set_quad_type(
-                      new_face->index(),
-                      reference_cell_type.face_reference_cell(0));
-
-                    AssertIsNotUsed(new_face);
-                    new_face->set_used_flag();
-                    new_face->clear_user_flag();
+                    const auto &new_face = new_faces[f];
                     new_face->clear_user_data();
                     new_face->clear_children();
                     new_face->set_boundary_id_internal(
                       numbers::internal_face_boundary_id);
                     new_face->set_manifold_id(cell->manifold_id());
-                    for (const auto j : new_faces[i]->line_indices())
-                      new_face->set_line_orientation(
-                        j, numbers::default_geometric_orientation);
                   }
 
-                // We always get 8 children per refined cell, whether from
-                // refinement of a hex or a tet:
-                std::array<
-                  typename Triangulation<dim, spacedim>::raw_cell_iterator,
-                  8>
-                  new_cells;
-                {
-                  for (unsigned int i = 0; i < n_new_cells; ++i)
-                    {
-                      if (i % 2 == 0)
-                        next_unused_cell =
-                          triangulation.levels[level + 1]->cells.next_free_hex(
-                            triangulation, level + 1);
-                      else
-                        ++next_unused_cell;
-
-                      new_cells[i] = next_unused_cell;
-
-                      auto &new_cell = new_cells[i];
-
-                      // children have the same type as the parent
-                      triangulation.levels[new_cell->level()]
-                        ->reference_cell[new_cell->index()] =
-                        reference_cell_type;
-
-                      AssertIsNotUsed(new_cell);
-                      new_cell->set_used_flag();
-                      new_cell->clear_user_flag();
-                      new_cell->clear_user_data();
-                      new_cell->clear_children();
-                      new_cell->set_material_id(cell->material_id());
-                      new_cell->set_manifold_id(cell->manifold_id());
-                      new_cell->set_subdomain_id(cell->subdomain_id());
-
-                      if (i % 2)
-                        new_cell->set_parent(cell->index());
-
-                      // set the orientation flag to its default state for all
-                      // faces initially. later on go the other way round and
-                      // reset faces that are at the boundary of the mother cube
-                      for (const auto f : new_cell->face_indices())
-                        new_cell->set_combined_face_orientation(
-                          f, numbers::default_geometric_orientation);
-                    }
-                  for (unsigned int i = 0; i < n_new_cells / 2; ++i)
-                    cell->set_children(2 * i, new_cells[2 * i]->index());
-                }
-
+                for (unsigned int c = 0; c < 8; ++c)
+                  {
+                    auto &new_cell = new_cells[c];
+                    new_cell->clear_user_data();
+                    new_cell->clear_children();
+                    new_cell->set_material_id(cell->material_id());
+                    new_cell->set_manifold_id(cell->manifold_id());
+                    new_cell->set_subdomain_id(cell->subdomain_id());
+
+                    if (c % 2)
+                      new_cell->set_parent(cell->index());
+
+                    // set the orientation flag to its default state for all
+                    // faces initially. later on go the other way round and
+                    // reset faces that are at the boundary of the mother cube
+                    for (const auto f : new_cell->face_indices())
+                      new_cell->set_combined_face_orientation(
+                        f, numbers::default_geometric_orientation);
+                  }
+                for (unsigned int c = 0; c < 4; ++c)
+                  cell->set_children(2 * c, new_cells[2 * c]->index());
                 {
                   // load vertex indices
-                  std::array<unsigned int, 27> vertex_indices = {};
+                  std::array<unsigned int, 27> &vertex_indices =
+                    vertex_indices_of_cells[i];
 
                   {
                     unsigned int k = 0;
@@ -6679,17 +7044,17 @@ namespace internal
                             cell->face(i)->child(0)->vertex_index(3);
 
                         // Set single new vertex in the center
-                        current_vertex =
-                          get_next_unused_vertex(current_vertex,
-                                                 triangulation.vertices_used);
-                        vertex_indices[k++] = current_vertex;
+                        const unsigned int new_vertex =
+                          new_vertices[vertex_offsets[i]];
+                        vertex_indices[k++] = new_vertex;
 
-                        triangulation.vertices[current_vertex] =
+                        triangulation.vertices[new_vertex] =
                           cell->center(true, true);
                       }
                   }
 
-                  unsigned int chosen_line_tetrahedron = 0;
+                  unsigned int &chosen_line_tetrahedron =
+                    chosen_lines_tetrahedron[i];
                   // set up new lines
                   if (reference_cell_type == ReferenceCells::Hexahedron)
                     {
@@ -6930,186 +7295,228 @@ namespace internal
                                 make_array_view(vertices_0),
                                 make_array_view(vertices_1));
 
-                            new_face->set_line_orientation(l, orientation);
+                            line_orientations[q][l] = orientation;
 
                             // on a hex, inject the status of the current line
                             // also to the line on the other quad along the
                             // same direction
                             if (reference_cell_type ==
                                 ReferenceCells::Hexahedron)
-                              new_faces[representative_lines[q % 4][1] + q -
-                                        (q % 4)]
-                                ->set_line_orientation(l, orientation);
+                              line_orientations[representative_lines[q % 4][1] +
+                                                q - (q % 4)][l] = orientation;
                           }
                       }
                   }
+                }
+              }
+          },
+          minimum_parallel_grain_size);
+
+        for (unsigned int f = 0; f < new_faces_of_cells.size(); ++f)
+          set_line_orientations(new_faces_of_cells[f],
+                                new_face_line_orientations[f]);
+
+        // then set up the new cells, which for tets requires the orientations
+        // of the lines of the new faces copied above, and remember which of
+        // them are distorted
+        std::vector<std::uint8_t> has_distorted_children_flag(
+          n_cells_to_refine, 0);
+        dealii::parallel::apply_to_subranges(
+          0U,
+          n_cells_to_refine,
+          [&](const unsigned int begin, const unsigned int end) {
+            for (unsigned int i = begin; i < end; ++i)
+              {
+                const auto &cell                = cells_to_refine[i];
+                const auto &reference_cell_type = cell->reference_cell();
 
-                  // set up new cell
-                  {
-                    std::array<int, 36> face_indices;
-
-                    if (reference_cell_type == ReferenceCells::Hexahedron)
-                      {
-                        for (unsigned int i = 0; i < n_new_faces; ++i)
-                          face_indices[i] = new_faces[i]->index();
-
-                        for (unsigned int f = 0, k = n_new_faces; f < 6; ++f)
-                          for (unsigned int c = 0; c < 4; ++c, ++k)
-                            face_indices[k] =
-                              cell->face(f)->isotropic_child_index(
-                                GeometryInfo<dim>::standard_to_real_face_vertex(
-                                  c,
-                                  cell->face_orientation(f),
-                                  cell->face_flip(f),
-                                  cell->face_rotation(f)));
-                      }
-                    else if (reference_cell_type == ReferenceCells::Tetrahedron)
-                      {
-                        // list of the indices of the surfaces which define the
-                        // 8 new tets. the indices 0-7 are the new quads defined
-                        // above (so 0-3 cut off the corners and 4-7 separate
-                        // the remaining octahedral), the indices between 8-11
-                        // are the children of the first face, from 12-15 of the
-                        // second, etc.
-                        for (unsigned int i = 0; i < n_new_faces; ++i)
-                          face_indices[i] = new_faces[i]->index();
-
-                        for (unsigned int f = 0, k = n_new_faces; f < 4; ++f)
-                          for (unsigned int c = 0; c < 4; ++c, ++k)
-                            {
-                              const auto combined_orientation =
-                                cell->combined_face_orientation(f);
-                              face_indices[k] = cell->face(f)->child_index(
-                                (c == 3) ? 3 :
-                                           reference_cell_type
-                                             .standard_to_real_face_vertex(
-                                               c, f, combined_orientation));
-                            }
-                      }
-                    else
-                      {
-                        DEAL_II_NOT_IMPLEMENTED();
-                      }
-
-                    // indices of the faces which define the new tets
-                    // the ordering of the tets is arbitrary
-                    // the first 4 determine the tets cutting of the corners
-                    // the last 4 are ordered after their appearance in the
-                    // faces.
-                    // the ordering within the faces is determined by
-                    // convention for the tetrahedron unit cell, see
-                    // cell_vertices_tet below
-                    const auto cell_faces =
-                      cell->reference_cell().new_isotropic_child_cell_faces(
-                        chosen_line_tetrahedron);
+                const unsigned int n_new_faces =
+                  face_offsets[i + 1] - face_offsets[i];
+                const raw_quad_iterator *new_faces =
+                  new_faces_of_cells.data() + face_offsets[i];
+                const typename Triangulation<dim, spacedim>::raw_cell_iterator
+                  *new_cells = new_cells_of_cells.data() + 8 * i;
+                const std::array<unsigned int, 27> &vertex_indices =
+                  vertex_indices_of_cells[i];
+                const unsigned int chosen_line_tetrahedron =
+                  chosen_lines_tetrahedron[i];
+                // set up new cell
+                {
+                  std::array<int, 36> face_indices;
 
-                    for (unsigned int c = 0;
-                         c < GeometryInfo<dim>::max_children_per_cell;
-                         ++c)
-                      {
-                        auto      &new_cell       = new_cells[c];
-                        const auto reference_cell = new_cell->reference_cell();
+                  if (reference_cell_type == ReferenceCells::Hexahedron)
+                    {
+                      for (unsigned int i = 0; i < n_new_faces; ++i)
+                        face_indices[i] = new_faces[i]->index();
 
-                        if (reference_cell == ReferenceCells::Tetrahedron)
+                      for (unsigned int f = 0, k = n_new_faces; f < 6; ++f)
+                        for (unsigned int c = 0; c < 4; ++c, ++k)
+                          face_indices[k] =
+                            cell->face(f)->isotropic_child_index(
+                              GeometryInfo<dim>::standard_to_real_face_vertex(
+                                c,
+                                cell->face_orientation(f),
+                                cell->face_flip(f),
+                                cell->face_rotation(f)));
+                    }
+                  else if (reference_cell_type == ReferenceCells::Tetrahedron)
+                    {
+                      // list of the indices of the surfaces which define the
+                      // 8 new tets. the indices 0-7 are the new quads defined
+                      // above (so 0-3 cut off the corners and 4-7 separate
+                      // the remaining octahedral), the indices between 8-11
+                      // are the children of the first face, from 12-15 of the
+                      // second, etc.
+                      for (unsigned int i = 0; i < n_new_faces; ++i)
+                        face_indices[i] = new_faces[i]->index();
+
+                      for (unsigned int f = 0, k = n_new_faces; f < 4; ++f)
+                        for (unsigned int c = 0; c < 4; ++c, ++k)
                           {
-                            new_cell->set_bounding_object_indices(
-                              {face_indices[cell_faces[c][0]],
-                               face_indices[cell_faces[c][1]],
-                               face_indices[cell_faces[c][2]],
-                               face_indices[cell_faces[c][3]]});
-
-
-                            // for tets, we need to go through the faces and
-                            // figure the orientation out the hard way
-                            for (const auto f : new_cell->face_indices())
-                              {
-                                const auto &face = new_cell->face(f);
-
-                                Assert(face->n_vertices() == 3,
-                                       ExcInternalError());
+                            const auto combined_orientation =
+                              cell->combined_face_orientation(f);
+                            face_indices[k] = cell->face(f)->child_index(
+                              (c == 3) ? 3 :
+                                         reference_cell_type
+                                           .standard_to_real_face_vertex(
+                                             c, f, combined_orientation));
+                          }
+                    }
+                  else
+                    {
+                      DEAL_II_NOT_IMPLEMENTED();
+                    }
 
-                                const std::array<unsigned int, 3> vertices_0 = {
-                                  {face->vertex_index(0),
-                                   face->vertex_index(1),
-                                   face->vertex_index(2)}};
-
-                                // the 8 child tets are each defined by 4
-                                // vertices the ordering of the tets has to be
-                                // consistent with above the ordering within the
-                                // tets is given by the reference tet i.e.
-                                // looking at the fifth line the first 3
-                                // vertices are given by face 11, the last
-                                // vertex is the remaining of the tet
-                                const auto new_cell_vertices =
-                                  cell->reference_cell()
-                                    .new_isotropic_child_cell_vertices(
-                                      chosen_line_tetrahedron)[c];
-
-                                // arrange after vertices of the faces of the
-                                // unit cell
-                                std::array<unsigned int, 3> vertices_1;
-                                for (unsigned int face_vertex_no :
-                                     face->vertex_indices())
-                                  {
-                                    const auto cell_vertex_no =
-                                      reference_cell.face_to_cell_vertices(
-                                        f,
-                                        face_vertex_no,
-                                        numbers::default_geometric_orientation);
-                                    vertices_1[face_vertex_no] = vertex_indices
-                                      [new_cell_vertices[cell_vertex_no]];
-                                  }
+                  // indices of the faces which define the new tets
+                  // the ordering of the tets is arbitrary
+                  // the first 4 determine the tets cutting of the corners
+                  // the last 4 are ordered after their appearance in the
+                  // faces.
+                  // the ordering within the faces is determined by
+                  // convention for the tetrahedron unit cell, see
+                  // cell_vertices_tet below
+                  const auto cell_faces =
+                    cell->reference_cell().new_isotropic_child_cell_faces(
+                      chosen_line_tetrahedron);
+
+                  for (unsigned int c = 0;
+                       c < GeometryInfo<dim>::max_children_per_cell;
+                       ++c)
+                    {
+                      auto      &new_cell       = new_cells[c];
+                      const auto reference_cell = new_cell->reference_cell();
 
-                                new_cell->set_combined_face_orientation(
-                                  f,
-                                  face->reference_cell()
-                                    .get_combined_orientation(
-                                      make_const_array_view(vertices_1),
-                                      make_array_view(vertices_0)));
-                              }
-                          }
-                        else if (new_cell->n_faces() == 6)
+                      if (reference_cell == ReferenceCells::Tetrahedron)
+                        {
                           new_cell->set_bounding_object_indices(
                             {face_indices[cell_faces[c][0]],
                              face_indices[cell_faces[c][1]],
                              face_indices[cell_faces[c][2]],
-                             face_indices[cell_faces[c][3]],
-                             face_indices[cell_faces[c][4]],
-                             face_indices[cell_faces[c][5]]});
-                        else
-                          DEAL_II_NOT_IMPLEMENTED();
-                      }
+                             face_indices[cell_faces[c][3]]});
 
-                    // for hexes, we can simply inherit the orientation values
-                    // from the parent on the outer faces; the inner faces can
-                    // be skipped as their orientation is always the default
-                    // one set above
-                    static constexpr dealii::ndarray<unsigned int, 6, 4>
-                      face_to_child_indices_hex{{{{0, 2, 4, 6}},
-                                                 {{1, 3, 5, 7}},
-                                                 {{0, 1, 4, 5}},
-                                                 {{2, 3, 6, 7}},
-                                                 {{0, 1, 2, 3}},
-                                                 {{4, 5, 6, 7}}}};
-                    if (cell->n_faces() == 6)
-                      for (const auto f : cell->face_indices())
-                        {
-                          const auto combined_orientation =
-                            cell->combined_face_orientation(f);
-                          for (unsigned int c = 0; c < 4; ++c)
-                            new_cells[face_to_child_indices_hex[f][c]]
-                              ->set_combined_face_orientation(
-                                f, combined_orientation);
+
+                          // for tets, we need to go through the faces and
+                          // figure the orientation out the hard way
+                          for (const auto f : new_cell->face_indices())
+                            {
+                              const auto &face = new_cell->face(f);
+
+                              Assert(face->n_vertices() == 3,
+                                     ExcInternalError());
+
+                              const std::array<unsigned int, 3> vertices_0 = {
+                                {face->vertex_index(0),
+                                 face->vertex_index(1),
+                                 face->vertex_index(2)}};
+
+                              // the 8 child tets are each defined by 4
+                              // vertices the ordering of the tets has to be
+                              // consistent with above the ordering within the
+                              // tets is given by the reference tet i.e.
+                              // looking at the fifth line the first 3
+                              // vertices are given by face 11, the last
+                              // vertex is the remaining of the tet
+                              const auto new_cell_vertices =
+                                cell->reference_cell()
+                                  .new_isotropic_child_cell_vertices(
+                                    chosen_line_tetrahedron)[c];
+
+                              // arrange after vertices of the faces of the
+                              // unit cell
+                              std::array<unsigned int, 3> vertices_1;
+                              for (unsigned int face_vertex_no :
+                                   face->vertex_indices())
+                                {
+                                  const auto cell_vertex_no =
+                                    reference_cell.face_to_cell_vertices(
+                                      f,
+                                      face_vertex_no,
+                                      numbers::default_geometric_orientation);
+                                  vertices_1[face_vertex_no] = vertex_indices
+                                    [new_cell_vertices[cell_vertex_no]];
+                                }
+
+                              new_cell->set_combined_face_orientation(
+                                f,
+                                face->reference_cell()
+                                  .get_combined_orientation(
+                                    make_const_array_view(vertices_1),
+                                    make_array_view(vertices_0)));
+                            }
                         }
-                  }
+                      else if (new_cell->n_faces() == 6)
+                        new_cell->set_bounding_object_indices(
+                          {face_indices[cell_faces[c][0]],
+                           face_indices[cell_faces[c][1]],
+                           face_indices[cell_faces[c][2]],
+                           face_indices[cell_faces[c][3]],
+                           face_indices[cell_faces[c][4]],
+                           face_indices[cell_faces[c][5]]});
+                      else
+                        DEAL_II_NOT_IMPLEMENTED();
+                    }
+
+                  // for hexes, we can simply inherit the orientation values
+                  // from the parent on the outer faces; the inner faces can
+                  // be skipped as their orientation is always the default
+                  // one set above
+                  static constexpr dealii::ndarray<unsigned int, 6, 4>
+                    face_to_child_indices_hex{{{{0, 2, 4, 6}},
+                                               {{1, 3, 5, 7}},
+                                               {{0, 1, 4, 5}},
+                                               {{2, 3, 6, 7}},
+                                               {{0, 1, 2, 3}},
+                                               {{4, 5, 6, 7}}}};
+                  if (cell->n_faces() == 6)
+                    for (const auto f : cell->face_indices())
+                      {
+                        const auto combined_orientation =
+                          cell->combined_face_orientation(f);
+                        for (unsigned int c = 0; c < 4; ++c)
+                          new_cells[face_to_child_indices_hex[f][c]]
+                            ->set_combined_face_orientation(
+                              f, combined_orientation);
+                      }
                 }
 
                 if (check_for_distorted_cells &&
                     has_distorted_children<dim, spacedim>(cell))
-                  cells_with_distorted_children.distorted_cells.push_back(cell);
-
-                triangulation.signals.post_refinement_on_cell(cell);
+                  has_distorted_children_flag[i] = 1;
               }
+          },
+          minimum_parallel_grain_size);
+
+        // finally inform the listeners in the order in which the cells would
+        // have been refined one after the other
+        typename Triangulation<3, spacedim>::DistortedCellList
+          cells_with_distorted_children;
+        for (unsigned int i = 0; i < n_cells_to_refine; ++i)
+          {
+            if (has_distorted_children_flag[i] == 1)
+              cells_with_distorted_children.distorted_cells.push_back(
+                cells_to_refine[i]);
+
+            triangulation.signals.post_refinement_on_cell(cells_to_refine[i]);
           }
 
         triangulation.faces->quads.clear_user_data();
@@ -13087,6 +13494,384 @@ namespace internal
         refine_flags[level] = levels[level]->refine_flags;
       return refine_flags;
     }
+
+
+
+
+    /**
+     * Number those of the first @p n_cells (raw) cells of the given level
+     * for which @p predicate returns true consecutively, starting at
+     * @p first_index, and pass the index of each such cell to @p set_index.
+     * Return the index following the last one given out.
+     *
+     * The numbering is done in two phases: we first count the cells
+     * satisfying the predicate within fixed-size blocks of cells in
+     * parallel, then compute the first index of each block and finally fill
+     * in the indices, again in parallel. Since the blocks do not depend on
+     * the number of threads, the result is the same as that of a sequential
+     * loop over the cells of the level.
+     */
+    template <int dim, int spacedim, typename Predicate, typename SetIndex>
+    types::global_cell_index
+    number_cells_on_level(const Triangulation<dim, spacedim> &triangulation,
+                          const unsigned int                  level,
+                          const unsigned int                  n_cells,
+                          const types::global_cell_index      first_index,
+                          const Predicate                    &predicate,
+                          const SetIndex                     &set_index)
+    {
+      const unsigned int n_blocks =
+        (n_cells + minimum_parallel_grain_size - 1) /
+        minimum_parallel_grain_size;
+
+      const auto work_on_blocks = [&](const auto &function) {
+        dealii::parallel::apply_to_subranges(
+          0U,
+          n_blocks,
+          [&](const unsigned int begin_block, const unsigned int end_block) {
+            for (unsigned int block = begin_block; block < end_block; ++block)
+              {
+                const unsigned int begin =
+                  block * minimum_parallel_grain_size;
+                const unsigned int end =
+                  std::min(begin + minimum_parallel_grain_size, n_cells);
+                function(block, begin, end);
+              }
+          },
+          1);
+      };
+
+      std::vector<types::global_cell_index> block_start(n_blocks + 1, 0);
+      work_on_blocks([&](const unsigned int block,
+                         const unsigned int begin,
+                         const unsigned int end) {
+        for (unsigned int index = begin; index < end; ++index)
+          if (predicate(TriaRawIterator<CellAccessor<dim, spacedim>>(
+                &triangulation, level, index)))
+            ++block_start[block + 1];
+      });
+
+      block_start[0] = first_index;
+      for (unsigned int block = 0; block < n_blocks; ++block)
+        block_start[block + 1] += block_start[block];
+
+      work_on_blocks([&](const unsigned int block,
+                         const unsigned int begin,
+                         const unsigned int end) {
+        types::global_cell_index next_index = block_start[block];
+        for (unsigned int index = begin; index < end; ++index)
+          {
+            const TriaRawIterator<CellAccessor<dim, spacedim>> cell(
+              &triangulation, level, index);
+            if (predicate(cell))
+              set_index(cell, next_index++);
+          }
+      });
+
+      return block_start[n_blocks];
+    }
+
+
+
+    /**
+     * For each vertex, compute the highest level any of the adjacent active
+     * cells will have after the next refinement step, judging by the
+     * refinement and coarsening flags currently set. If the coarsen flag is
+     * set on a cell, we tentatively assume that the cell will be coarsened.
+     * This isn't always true (the coarsen flag could be removed again) and
+     * so we may make an error here, which callers correct by iterating.
+     *
+     * The active cells are worked on in parallel. Because several cells share
+     * a vertex, the entries are updated with atomic operations; as we only
+     * take the maximum, the result does not depend on the order of updates.
+     */
+    template <int dim, int spacedim>
+    std::vector<int>
+    compute_vertex_levels(const Triangulation<dim, spacedim> &triangulation)
+    {
+      std::vector<std::atomic<int>> vertex_level(triangulation.n_vertices());
+
+      for (unsigned int level = 0; level < triangulation.n_levels(); ++level)
+        dealii::parallel::apply_to_subranges(
+          0U,
+          triangulation.n_raw_cells(level),
+          [&](const unsigned int begin, const unsigned int end) {
+            for (unsigned int index = begin; index < end; ++index)
+              {
+                const TriaRawIterator<CellAccessor<dim, spacedim>> cell(
+                  &triangulation, level, index);
+                if (cell->used() == false || cell->has_children())
+                  continue;
+
+                int new_level = cell->level();
+                if (cell->refine_flag_set())
+                  new_level += 1;
+                else if (cell->coarsen_flag_set())
+                  new_level -= 1;
+
+                for (const unsigned int vertex : cell->vertex_indices())
+                  {
+                    std::atomic<int> &entry =
+                      vertex_level[cell->vertex_index(vertex)];
+                    int current = entry.load(std::memory_order_relaxed);
+                    while (current < new_level &&
+                           !entry.compare_exchange_weak(
+                             current, new_level, std::memory_order_relaxed))
+                      ;
+                  }
+              }
+          },
+          minimum_parallel_grain_size);
+
+      std::vector<int> result(vertex_level.size());
+      for (unsigned int v = 0; v < vertex_level.size(); ++v)
+        result[v] = vertex_level[v].load(std::memory_order_relaxed);
+      return result;
+    }
+
+
+
+    /**
+     * Limit the level difference of neighboring cells at each vertex to one,
+     * i.e., the step of Triangulation::prepare_coarsening_and_refinement()
+     * enabled by Triangulation::limit_level_difference_at_vertices.
+     *
+     * This produces the same flags as a loop over all active cells in
+     * reverse order that refines (and does not coarsen) a cell not yet
+     * flagged for refinement if one of its vertices has a level larger than
+     * the cell's level plus one, does not coarsen it if one of its vertices
+     * has a level at least that large, and updates the levels of the
+     * vertices of newly flagged cells right away. In such a loop, whether a
+     * cell is refined only depends on finer cells, which have all been
+     * visited before, so we can decide this for all cells of a level in
+     * parallel. Whether a cell of the same level is no longer coarsened
+     * also depends on the newly flagged cells of this level that have been
+     * visited before it, i.e., that have a larger index; we record the
+     * largest index of those at each vertex to answer this question, again
+     * in parallel. Only the coarsen flags, which are stored in a bit field,
+     * are changed sequentially.
+     */
+    template <int dim, int spacedim>
+    void
+    limit_level_difference_at_vertices(
+      const Triangulation<dim, spacedim> &triangulation)
+    {
+      std::vector<int> vertex_level = compute_vertex_levels(triangulation);
+
+      // for each vertex, one plus the largest index of the cells of the
+      // present level adjacent to it that have been newly flagged for
+      // refinement, or zero if there is no such cell
+      std::vector<std::atomic<unsigned int>> last_refined_cell(
+        triangulation.n_vertices());
+
+      // what to do with each cell of the present level
+      enum Action : std::uint8_t
+      {
+        keep,
+        do_not_coarsen,
+        refine
+      };
+
+      for (int level = triangulation.n_levels() - 1; level >= 0; --level)
+        {
+          const unsigned int  n_cells = triangulation.n_raw_cells(level);
+          std::vector<Action> actions(n_cells, keep);
+
+          dealii::parallel::apply_to_subranges(
+            0U,
+            n_cells,
+            [&](const unsigned int begin, const unsigned int end) {
+              for (unsigned int index = begin; index < end; ++index)
+                {
+                  const TriaRawIterator<CellAccessor<dim, spacedim>> cell(
+                    &triangulation, level, index);
+                  if (cell->used() == false || cell->has_children() ||
+                      cell->refine_flag_set())
+                    continue;
+
+                  for (const unsigned int vertex : cell->vertex_indices())
+                    if (vertex_level[cell->vertex_index(vertex)] >
+                        level + 1)
+                      actions[index] = refine;
+                    else if (vertex_level[cell->vertex_index(vertex)] ==
+                               level + 1 &&
+                             actions[index] == keep)
+                      actions[index] = do_not_coarsen;
+
+                  if (actions[index] == refine)
+                    for (const unsigned int vertex : cell->vertex_indices())
+                      {
+                        std::atomic<unsigned int> &entry =
+                          last_refined_cell[cell->vertex_index(vertex)];
+                        unsigned int current =
+                          entry.load(std::memory_order_relaxed);
+                        while (current < index + 1 &&
+                               !entry.compare_exchange_weak(
+                                 current,
+                                 index + 1,
+                                 std::memory_order_relaxed))
+                          ;
+                      }
+                }
+            },
+            minimum_parallel_grain_size);
+
+          dealii::parallel::apply_to_subranges(
+            0U,
+            n_cells,
+            [&](const unsigned int begin, const unsigned int end) {
+              for (unsigned int index = begin; index < end; ++index)
+                {
+                  const TriaRawIterator<CellAccessor<dim, spacedim>> cell(
+                    &triangulation, level, index);
+                  if (cell->used() == false || cell->has_children() ||
+                      cell->refine_flag_set() || actions[index] != keep)
+                    continue;
+
+                  for (const unsigned int vertex : cell->vertex_indices())
+                    if (last_refined_cell[cell->vertex_index(vertex)].load(
+                          std::memory_order_relaxed) > index + 1)
+                      actions[index] = do_not_coarsen;
+                }
+            },
+            minimum_parallel_grain_size);
+
+          for (unsigned int index = 0; index < n_cells; ++index)
+            if (actions[index] != keep)
+              {
+                const TriaRawIterator<CellAccessor<dim, spacedim>> cell(
+                  &triangulation, level, index);
+                cell->clear_coarsen_flag();
+                if (actions[index] == refine)
+                  cell->set_refine_flag();
+              }
+
+          // the newly flagged cells raise the levels of their vertices, and
+          // we reset the entries of the vertices for the next level
+          dealii::parallel::apply_to_subranges(
+            0U,
+            n_cells,
+            [&](const unsigned int begin, const unsigned int end) {
+              for (unsigned int index = begin; index < end; ++index)
+                if (actions[index] == refine)
+                  {
+                    const TriaRawIterator<CellAccessor<dim, spacedim>> cell(
+                      &triangulation, level, index);
+                    for (const unsigned int vertex : cell->vertex_indices())
+                      if (last_refined_cell[cell->vertex_index(vertex)]
+                            .exchange(0, std::memory_order_relaxed) != 0)
+                        vertex_level[cell->vertex_index(vertex)] =
+                          std::max(vertex_level[cell->vertex_index(vertex)],
+                                   level + 1);
+                  }
+            },
+            minimum_parallel_grain_size);
+        }
+    }
+
+
+
+    /**
+     * Make sure that no face is refined twice, i.e., the step of
+     * Triangulation::prepare_coarsening_and_refinement() that sets the
+     * refine flag of all active neighbors of a cell flagged for refinement
+     * that are coarser than the cell, and removes the coarsen flag of all
+     * its active neighbors, repeated until no more flags are set. This
+     * function may only be called if all refine flags are isotropic and no
+     * anisotropic smoothing is requested, in which case these are the only
+     * changes of flags this step makes. The result does not depend on the
+     * order in which the cells are treated, and so we work on all of them
+     * in parallel in Jacobi-style sweeps: each sweep collects the cells to
+     * be flagged in a separate buffer, and then sets their flags, until a
+     * sweep does not flag any new cells.
+     */
+    template <int dim, int spacedim>
+    void
+    enforce_isotropic_refinement_at_faces(
+      const Triangulation<dim, spacedim> &triangulation)
+    {
+      const unsigned int n_levels = triangulation.n_levels();
+
+      // call the given function on the active neighbors of all active
+      // cells flagged for refinement, in parallel
+      const auto for_neighbors_of_refined_cells = [&](const auto &function) {
+        for (unsigned int level = 0; level < n_levels; ++level)
+          dealii::parallel::apply_to_subranges(
+            0U,
+            triangulation.n_raw_cells(level),
+            [&](const unsigned int begin, const unsigned int end) {
+              for (unsigned int index = begin; index < end; ++index)
+                {
+                  const TriaRawIterator<CellAccessor<dim, spacedim>> cell(
+                    &triangulation, level, index);
+                  if (cell->used() == false || cell->has_children() ||
+                      !cell->refine_flag_set())
+                    continue;
+
+                  for (const auto f : cell->face_indices())
+                    {
+                      const bool has_periodic_neighbor =
+                        cell->has_periodic_neighbor(f);
+                      if (cell->at_boundary(f) && !has_periodic_neighbor)
+                        continue;
+
+                      const auto neighbor =
+                        cell->neighbor_or_periodic_neighbor(f);
+                      if (neighbor->is_active())
+                        function(neighbor,
+                                 has_periodic_neighbor ?
+                                   cell->periodic_neighbor_is_coarser(f) :
+                                   cell->neighbor_is_coarser(f));
+                    }
+                }
+            },
+            minimum_parallel_grain_size);
+      };
+
+      std::vector<std::vector<std::atomic<bool>>> flagged(n_levels);
+      for (unsigned int level = 0; level < n_levels; ++level)
+        flagged[level] =
+          std::vector<std::atomic<bool>>(triangulation.n_raw_cells(level));
+
+      bool changed = true;
+      while (changed)
+        {
+          changed = false;
+
+          for_neighbors_of_refined_cells(
+            [&](const auto &neighbor, const bool neighbor_is_coarser) {
+              if (neighbor_is_coarser && !neighbor->refine_flag_set())
+                flagged[neighbor->level()][neighbor->index()].store(
+                  true, std::memory_order_relaxed);
+            });
+
+          for (unsigned int level = 0; level < n_levels; ++level)
+            for (unsigned int index = 0; index < flagged[level].size(); ++index)
+              if (flagged[level][index].load(std::memory_order_relaxed))
+                {
+                  const TriaRawIterator<CellAccessor<dim, spacedim>> cell(
+                    &triangulation, level, index);
+                  cell->clear_coarsen_flag();
+                  cell->set_refine_flag();
+                  flagged[level][index].store(false, std::memory_order_relaxed);
+                  changed = true;
+                }
+        }
+
+      for_neighbors_of_refined_cells([&](const auto &neighbor, const bool) {
+        if (neighbor->coarsen_flag_set())
+          flagged[neighbor->level()][neighbor->index()].store(
+            true, std::memory_order_relaxed);
+      });
+
+      for (unsigned int level = 0; level < n_levels; ++level)
+        for (unsigned int index = 0; index < flagged[level].size(); ++index)
+          if (flagged[level][index].load(std::memory_order_relaxed))
+            TriaRawIterator<CellAccessor<dim, spacedim>>(&triangulation,
+                                                         level,
+                                                         index)
+              ->clear_coarsen_flag();
+    }
   } // namespace
 } // namespace internal
 
@@ -13708,12 +14493,19 @@ template <int dim, int spacedim>
 DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
 void Triangulation<dim, spacedim>::save(const std::string &file_basename) const
 {
-  // Save triangulation information.
+  // Save triangulation information. We use a binary archive, preceded by a
+  // line that identifies the format, so that load() can distinguish these
+  // files from the text archives written by earlier versions, and a line
+  // with the format version and the platform the archive was written on.
   {
-    std::ofstream ofs_tria(file_basename + "_triangulation.data");
+    std::ofstream ofs_tria(file_basename + "_triangulation.data",
+                           std::ios::binary);
     AssertThrow(ofs_tria.fail() == false, ExcIO());
 
-    boost::archive::text_oarchive oa(ofs_tria, boost::archive::no_header);
+    ofs_tria << internal::binary_triangulation_file_magic << '\n'
+             << internal::binary_triangulation_file_version << ' '
+             << internal::binary_triangulation_file_platform() << '\n';
+    boost::archive::binary_oarchive oa(ofs_tria, boost::archive::no_header);
     save(oa,
          internal::CellAttachedDataSerializer<dim, spacedim>::version_number);
   }
@@ -13744,14 +14536,63 @@ void Triangulation<dim, spacedim>::load(const std::string &file_basename)
   // overwrites everything:
   clear();
 
-  // Load triangulation information.
+  // Load triangulation information. Files without the binary format
+  // identifier in the first line are text archives written by earlier
+  // versions of this function.
   {
-    std::ifstream ifs_tria(file_basename + "_triangulation.data");
+    std::ifstream ifs_tria(file_basename + "_triangulation.data",
+                           std::ios::binary);
     AssertThrow(ifs_tria.fail() == false, ExcIO());
 
-    boost::archive::text_iarchive ia(ifs_tria, boost::archive::no_header);
-    load(ia,
-         internal::CellAttachedDataSerializer<dim, spacedim>::version_number);
+    std::string firstline;
+    std::getline(ifs_tria, firstline);
+    if (firstline == internal::binary_triangulation_file_magic)
+      {
+        unsigned int file_version = 0;
+        ifs_tria >> file_version;
+        AssertThrow(file_version ==
+                      internal::binary_triangulation_file_version,
+                    ExcMessage("The file <" + file_basename +
+                               "_triangulation.data> has been written with "
+                               "version " +
+                               std::to_string(file_version) +
+                               " of the binary triangulation format, but "
+                               "this version of deal.II can only read "
+                               "version " +
+                               std::to_string(
+                                 internal::binary_triangulation_file_version) +
+                               "."));
+
+        std::string file_platform;
+        ifs_tria.get();
+        std::getline(ifs_tria, file_platform);
+        const std::string platform =
+          internal::binary_triangulation_file_platform();
+        AssertThrow(file_platform == platform,
+                    ExcMessage("The file <" + file_basename +
+                               "_triangulation.data> has been written on a "
+                               "machine with byte order and type sizes <" +
+                               file_platform +
+                               ">, which differ from the ones of this "
+                               "machine <" +
+                               platform +
+                               ">. The binary archive can not be read here."));
+
+        boost::archive::binary_iarchive ia(ifs_tria,
+                                           boost::archive::no_header);
+        load(ia,
+             internal::CellAttachedDataSerializer<dim,
+                                                  spacedim>::version_number);
+      }
+    else
+      {
+        ifs_tria.clear();
+        ifs_tria.seekg(0);
+        boost::archive::text_iarchive ia(ifs_tria, boost::archive::no_header);
+        load(ia,
+             internal::CellAttachedDataSerializer<dim,
+                                                  spacedim>::version_number);
+      }
   }
 
   // Load attached data.
@@ -15938,15 +16779,25 @@ template <int dim, int spacedim>
 DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
 void Triangulation<dim, spacedim>::reset_active_cell_indices()
 {
-  unsigned int active_cell_index = 0;
-  for (raw_cell_iterator cell = begin_raw(); cell != end(); ++cell)
-    if ((cell->used() == false) || cell->has_children())
-      cell->set_active_cell_index(numbers::invalid_unsigned_int);
-    else
-      {
-        cell->set_active_cell_index(active_cell_index);
-        ++active_cell_index;
-      }
+  types::global_cell_index active_cell_index = 0;
+  for (unsigned int level = 0; level < levels.size(); ++level)
+    {
+      std::fill(levels[level]->active_cell_indices.begin(),
+                levels[level]->active_cell_indices.end(),
+                numbers::invalid_unsigned_int);
+      active_cell_index = internal::number_cells_on_level(
+        *this,
+        level,
+        levels[level]->refine_flags.size(),
+        active_cell_index,
+        [](const raw_cell_iterator &cell) {
+          return cell->used() && !cell->has_children();
+        },
+        [](const raw_cell_iterator             &cell,
+           const types::global_cell_index index) {
+          cell->set_active_cell_index(index);
+        });
+    }
 
   Assert(active_cell_index == n_active_cells(), ExcInternalError());
 }
@@ -15957,17 +16808,32 @@ template <int dim, int spacedim>
 DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
 void Triangulation<dim, spacedim>::reset_global_cell_indices()
 {
-  {
-    types::global_cell_index cell_index = 0;
-    for (const auto &cell : active_cell_iterators())
-      cell->set_global_active_cell_index(cell_index++);
-  }
-
+  types::global_cell_index active_cell_index = 0;
   for (unsigned int l = 0; l < levels.size(); ++l)
     {
-      types::global_cell_index cell_index = 0;
-      for (const auto &cell : cell_iterators_on_level(l))
-        cell->set_global_level_cell_index(cell_index++);
+      active_cell_index = internal::number_cells_on_level(
+        *this,
+        l,
+        levels[l]->refine_flags.size(),
+        active_cell_index,
+        [](const raw_cell_iterator &cell) {
+          return cell->used() && !cell->has_children();
+        },
+        [](const raw_cell_iterator             &cell,
+           const types::global_cell_index index) {
+          cell->set_global_active_cell_index(index);
+        });
+
+      internal::number_cells_on_level(
+        *this,
+        l,
+        levels[l]->refine_flags.size(),
+        0,
+        [](const raw_cell_iterator &cell) { return cell->used(); },
+        [](const raw_cell_iterator             &cell,
+           const types::global_cell_index index) {
+          cell->set_global_level_cell_index(index);
+        });
     }
 }
 
@@ -15984,93 +16850,107 @@ void Triangulation<dim, spacedim>::reset_cell_vertex_indices_cache()
       cache.resize(levels[l]->refine_flags.size() *
                      ReferenceCells::max_n_vertices<dim>(),
                    numbers::invalid_unsigned_int);
-      for (const auto &cell : cell_iterators_on_level(l))
-        {
-          const unsigned int my_index =
-            cell->index() * ReferenceCells::max_n_vertices<dim>();
-
-          // to reduce the cost of this function when passing down into quads,
-          // then lines, then vertices, we use a more low-level access method
-          // for hexahedral cells, where we can streamline most of the logic
-          const ReferenceCell ref_cell = cell->reference_cell();
-          if (ref_cell == ReferenceCells::Hexahedron)
-            for (unsigned int face = 4; face < 6; ++face)
-              {
-                const auto face_iter = cell->face(face);
-                const std::array<types::geometric_orientation, 2>
-                  line_orientations{{face_iter->line_orientation(0),
-                                     face_iter->line_orientation(1)}};
-                const std::array<unsigned int, 2> line_vertex_indices{
-                  {line_orientations[0] ==
-                     numbers::default_geometric_orientation,
-                   line_orientations[1] ==
-                     numbers::default_geometric_orientation}};
-                const std::array<unsigned int, 4> raw_vertex_indices{
-                  {face_iter->line(0)->vertex_index(1 - line_vertex_indices[0]),
-                   face_iter->line(1)->vertex_index(1 - line_vertex_indices[1]),
-                   face_iter->line(0)->vertex_index(line_vertex_indices[0]),
-                   face_iter->line(1)->vertex_index(line_vertex_indices[1])}};
-
-                const auto combined_orientation =
-                  levels[l]->face_orientations.get_combined_orientation(
-                    cell->index() * ReferenceCells::max_n_faces<dim>() + face);
-                const std::array<unsigned int, 4> vertex_order{
-                  {ref_cell.standard_to_real_face_vertex(0,
-                                                         face,
-                                                         combined_orientation),
-                   ref_cell.standard_to_real_face_vertex(1,
-                                                         face,
-                                                         combined_orientation),
-                   ref_cell.standard_to_real_face_vertex(2,
-                                                         face,
-                                                         combined_orientation),
-                   ref_cell.standard_to_real_face_vertex(
-                     3, face, combined_orientation)}};
-
-                const unsigned int index = my_index + 4 * (face - 4);
-                for (unsigned int i = 0; i < 4; ++i)
-                  cache[index + i] = raw_vertex_indices[vertex_order[i]];
-              }
-          else if (ref_cell == ReferenceCells::Quadrilateral)
+      const auto fill_cache = [&](const raw_cell_iterator &cell) {
+        const unsigned int my_index =
+          cell->index() * ReferenceCells::max_n_vertices<dim>();
+
+        // to reduce the cost of this function when passing down into quads,
+        // then lines, then vertices, we use a more low-level access method
+        // for hexahedral cells, where we can streamline most of the logic
+        const ReferenceCell ref_cell = cell->reference_cell();
+        if (ref_cell == ReferenceCells::Hexahedron)
+          for (unsigned int face = 4; face < 6; ++face)
             {
+              const auto face_iter = cell->face(face);
               const std::array<types::geometric_orientation, 2>
-                line_orientations{
-                  {cell->line_orientation(0), cell->line_orientation(1)}};
+                line_orientations{{face_iter->line_orientation(0),
+                                   face_iter->line_orientation(1)}};
               const std::array<unsigned int, 2> line_vertex_indices{
-                {line_orientations[0] == numbers::default_geometric_orientation,
+                {line_orientations[0] ==
+                   numbers::default_geometric_orientation,
                  line_orientations[1] ==
                    numbers::default_geometric_orientation}};
               const std::array<unsigned int, 4> raw_vertex_indices{
-                {cell->line(0)->vertex_index(1 - line_vertex_indices[0]),
-                 cell->line(1)->vertex_index(1 - line_vertex_indices[1]),
-                 cell->line(0)->vertex_index(line_vertex_indices[0]),
-                 cell->line(1)->vertex_index(line_vertex_indices[1])}};
+                {face_iter->line(0)->vertex_index(1 - line_vertex_indices[0]),
+                 face_iter->line(1)->vertex_index(1 - line_vertex_indices[1]),
+                 face_iter->line(0)->vertex_index(line_vertex_indices[0]),
+                 face_iter->line(1)->vertex_index(line_vertex_indices[1])}};
+
+              const auto combined_orientation =
+                levels[l]->face_orientations.get_combined_orientation(
+                  cell->index() * ReferenceCells::max_n_faces<dim>() + face);
+              const std::array<unsigned int, 4> vertex_order{
+                {ref_cell.standard_to_real_face_vertex(0,
+                                                       face,
+                                                       combined_orientation),
+                 ref_cell.standard_to_real_face_vertex(1,
+                                                       face,
+                                                       combined_orientation),
+                 ref_cell.standard_to_real_face_vertex(2,
+                                                       face,
+                                                       combined_orientation),
+                 ref_cell.standard_to_real_face_vertex(
+                   3, face, combined_orientation)}};
+
+              const unsigned int index = my_index + 4 * (face - 4);
               for (unsigned int i = 0; i < 4; ++i)
-                cache[my_index + i] = raw_vertex_indices[i];
-            }
-          else if (ref_cell == ReferenceCells::Line)
-            {
-              cache[my_index + 0] = cell->vertex_index(0);
-              cache[my_index + 1] = cell->vertex_index(1);
+                cache[index + i] = raw_vertex_indices[vertex_order[i]];
             }
-          else
+        else if (ref_cell == ReferenceCells::Quadrilateral)
+          {
+            const std::array<types::geometric_orientation, 2>
+              line_orientations{
+                {cell->line_orientation(0), cell->line_orientation(1)}};
+            const std::array<unsigned int, 2> line_vertex_indices{
+              {line_orientations[0] == numbers::default_geometric_orientation,
+               line_orientations[1] ==
+                 numbers::default_geometric_orientation}};
+            const std::array<unsigned int, 4> raw_vertex_indices{
+              {cell->line(0)->vertex_index(1 - line_vertex_indices[0]),
+               cell->line(1)->vertex_index(1 - line_vertex_indices[1]),
+               cell->line(0)->vertex_index(line_vertex_indices[0]),
+               cell->line(1)->vertex_index(line_vertex_indices[1])}};
+            for (unsigned int i = 0; i < 4; ++i)
+              cache[my_index + i] = raw_vertex_indices[i];
+          }
+        else if (ref_cell == ReferenceCells::Line)
+          {
+            cache[my_index + 0] = cell->vertex_index(0);
+            cache[my_index + 1] = cell->vertex_index(1);
+          }
+        else
+          {
+            Assert(dim == 2 || dim == 3, ExcInternalError());
+            for (const unsigned int i : cell->vertex_indices())
+              {
+                const auto [face_index, vertex_index] =
+                  ref_cell.standard_vertex_to_face_and_vertex_index(i);
+                const auto vertex_within_face_index =
+                  ref_cell.standard_to_real_face_vertex(
+                    vertex_index,
+                    face_index,
+                    cell->combined_face_orientation(face_index));
+                cache[my_index + i] =
+                  cell->face(face_index)
+                    ->vertex_index(vertex_within_face_index);
+              }
+          }
+      };
+
+      // each cell only writes into its own part of the cache, so we can
+      // work on the cells in parallel
+      parallel::apply_to_subranges(
+        0U,
+        static_cast<unsigned int>(levels[l]->refine_flags.size()),
+        [&](const unsigned int begin, const unsigned int end) {
+          for (unsigned int index = begin; index < end; ++index)
             {
-              Assert(dim == 2 || dim == 3, ExcInternalError());
-              for (const unsigned int i : cell->vertex_indices())
-                {
-                  const auto [face_index, vertex_index] =
-                    ref_cell.standard_vertex_to_face_and_vertex_index(i);
-                  const auto vertex_within_face_index =
-                    ref_cell.standard_to_real_face_vertex(
-                      vertex_index,
-                      face_index,
-                      cell->combined_face_orientation(face_index));
-                  cache[my_index + i] =
-                    cell->face(face_index)
-                      ->vertex_index(vertex_within_face_index);
-                }
+              const raw_cell_iterator cell(this, l, index);
+              if (cell->used())
+                fill_cache(cell);
             }
-        }
+        },
+        internal::minimum_parallel_grain_size);
     }
 }
 
@@ -16543,35 +17423,11 @@ void Triangulation<dim, spacedim>::fix_coarsen_flags()
                             "mesh smoothing must not be set!"));
 
           // store highest level one of the cells adjacent to a vertex
-          // belongs to
-          std::vector<int> vertex_level(vertices.size(), 0);
-          for (const auto &cell : this->active_cell_iterators())
-            {
-              if (cell->refine_flag_set())
-                for (const unsigned int vertex : cell->vertex_indices())
-                  vertex_level[cell->vertex_index(vertex)] =
-                    std::max(vertex_level[cell->vertex_index(vertex)],
-                             cell->level() + 1);
-              else if (!cell->coarsen_flag_set())
-                for (const unsigned int vertex : cell->vertex_indices())
-                  vertex_level[cell->vertex_index(vertex)] =
-                    std::max(vertex_level[cell->vertex_index(vertex)],
-                             cell->level());
-              else
-                {
-                  // if coarsen flag is set then tentatively assume
-                  // that the cell will be coarsened. this isn't
-                  // always true (the coarsen flag could be removed
-                  // again) and so we may make an error here. we try
-                  // to correct this by iterating over the entire
-                  // process until we are converged
-                  Assert(cell->coarsen_flag_set(), ExcInternalError());
-                  for (const unsigned int vertex : cell->vertex_indices())
-                    vertex_level[cell->vertex_index(vertex)] =
-                      std::max(vertex_level[cell->vertex_index(vertex)],
-                               cell->level() - 1);
-                }
-            }
+          // belongs to. this may be wrong for cells with coarsen flags,
+          // which we try to correct by iterating over the entire process
+          // until we are converged
+          std::vector<int> vertex_level =
+            internal::compute_vertex_levels(*this);
 
 
           // loop over all cells in reverse order. do so because we
@@ -16624,37 +17480,74 @@ void Triangulation<dim, spacedim>::fix_coarsen_flags()
       for (const auto &acell : this->active_cell_iterators_on_level(0))
         acell->clear_coarsen_flag();
 
-      const cell_iterator endc = end();
-      for (cell_iterator cell = begin(n_levels() - 1); cell != endc; --cell)
+      //
+      // the decision for a cell depends on the flags of its children and on
+      // the coarsen flags of the grandchildren of its neighbors, which have
+      // been fixed when working on the next finer level. we therefore go
+      // from the finest to the coarsest level, and on each level first
+      // decide for all cells in parallel (the expensive part, as we have to
+      // look at the neighbors), and then update the flags of the children
+      // sequentially since the coarsen flags are stored in a bit field
+      std::vector<std::uint8_t> coarsen_children;
+      for (int level = static_cast<int>(n_levels()) - 2; level >= 0; --level)
         {
-          // nothing to do if we are already on the finest level
-          if (cell->is_active())
-            continue;
+          const unsigned int n_cells = levels[level]->refine_flags.size();
+          coarsen_children.assign(n_cells, 0);
+
+          parallel::apply_to_subranges(
+            0U,
+            n_cells,
+            [&](const unsigned int begin, const unsigned int end) {
+              for (unsigned int index = begin; index < end; ++index)
+                {
+                  const raw_cell_iterator raw_cell(this, level, index);
+
+                  // nothing to do if we are already on the finest level
+                  if (raw_cell->used() == false || raw_cell->is_active())
+                    continue;
+
+                  const cell_iterator cell(raw_cell);
+
+                  // flag the children for coarsening again if all
+                  // children were flagged and if the policy allows it
+                  bool all_children_flagged = true;
+                  for (unsigned int c = 0; c < cell->n_children(); ++c)
+                    if (!cell->child(c)->is_active() ||
+                        !cell->child(c)->coarsen_flag_set())
+                      {
+                        all_children_flagged = false;
+                        break;
+                      }
 
-          const unsigned int n_children       = cell->n_children();
-          unsigned int       flagged_children = 0;
-          for (unsigned int child = 0; child < n_children; ++child)
+                  if (all_children_flagged &&
+                      this->policy->coarsening_allowed(cell))
+                    coarsen_children[index] = 1;
+                }
+            },
+            internal::minimum_parallel_grain_size);
+
+          for (const auto &cell : cell_iterators_on_level(level))
             {
-              const auto child_cell = cell->child(child);
-              if (child_cell->is_active() && child_cell->coarsen_flag_set())
+              if (cell->is_active())
+                continue;
+
+              for (unsigned int c = 0; c < cell->n_children(); ++c)
                 {
-                  ++flagged_children;
-                  // clear flag since we don't need it anymore
-                  child_cell->clear_coarsen_flag();
+                  const auto child_cell = cell->child(c);
+                  if (child_cell->is_active())
+                    {
+                      if (coarsen_children[cell->index()] == 1)
+                        {
+                          Assert(child_cell->refine_flag_set() == false,
+                                 ExcInternalError());
+                          child_cell->set_coarsen_flag();
+                        }
+                      else
+                        // clear flag since we don't need it anymore
+                        child_cell->clear_coarsen_flag();
+                    }
                 }
             }
-
-          // flag the children for coarsening again if all children were
-          // flagged and if the policy allows it
-          if (flagged_children == n_children &&
-              this->policy->coarsening_allowed(cell))
-            for (unsigned int c = 0; c < n_children; ++c)
-              {
-                Assert(cell->child(c)->refine_flag_set() == false,
-                       ExcInternalError());
-
-                cell->child(c)->set_coarsen_flag();
-              }
         }
 
       // now see if anything has changed in the last iteration of this
@@ -17197,75 +18090,11 @@ bool Triangulation<dim, spacedim>::prepare_coarsening_and_refinement()
                             "limit_level_difference_at_vertices flag for "
                             "mesh smoothing must not be set!"));
 
-          // store highest level one of the cells adjacent to a vertex
-          // belongs to
-          std::vector<int> vertex_level(vertices.size(), 0);
-          for (const auto &cell : active_cell_iterators())
-            {
-              if (cell->refine_flag_set())
-                for (const unsigned int vertex : cell->vertex_indices())
-                  vertex_level[cell->vertex_index(vertex)] =
-                    std::max(vertex_level[cell->vertex_index(vertex)],
-                             cell->level() + 1);
-              else if (!cell->coarsen_flag_set())
-                for (const unsigned int vertex : cell->vertex_indices())
-                  vertex_level[cell->vertex_index(vertex)] =
-                    std::max(vertex_level[cell->vertex_index(vertex)],
-                             cell->level());
-              else
-                {
-                  // if coarsen flag is set then tentatively assume
-                  // that the cell will be coarsened. this isn't
-                  // always true (the coarsen flag could be removed
-                  // again) and so we may make an error here
-                  Assert(cell->coarsen_flag_set(), ExcInternalError());
-                  for (const unsigned int vertex : cell->vertex_indices())
-                    vertex_level[cell->vertex_index(vertex)] =
-                      std::max(vertex_level[cell->vertex_index(vertex)],
-                               cell->level() - 1);
-                }
-            }
-
-
-          // loop over all cells in reverse order. do so because we
-          // can then update the vertex levels on the adjacent
-          // vertices and maybe already flag additional cells in this
-          // loop
-          //
-          // note that not only may we have to add additional
-          // refinement flags, but we will also have to remove
-          // coarsening flags on cells adjacent to vertices that will
-          // see refinement
-          for (active_cell_iterator cell = last_active(); cell != end(); --cell)
-            if (cell->refine_flag_set() == false)
-              {
-                for (const unsigned int vertex : cell->vertex_indices())
-                  if (vertex_level[cell->vertex_index(vertex)] >=
-                      cell->level() + 1)
-                    {
-                      // remove coarsen flag...
-                      cell->clear_coarsen_flag();
-
-                      // ...and if necessary also refine the current
-                      // cell, at the same time updating the level
-                      // information about vertices
-                      if (vertex_level[cell->vertex_index(vertex)] >
-                          cell->level() + 1)
-                        {
-                          cell->set_refine_flag();
-
-                          for (const unsigned int v : cell->vertex_indices())
-                            vertex_level[cell->vertex_index(v)] =
-                              std::max(vertex_level[cell->vertex_index(v)],
-                                       cell->level() + 1);
-                        }
-
-                      // continue and see whether we may, for example,
-                      // go into the inner'if'
-                      // above based on a
-                      // different vertex
-                    }
-              }
+          // flag additional cells for refinement where the level of a
+          // vertex is larger than the level of an adjacent cell plus one,
+          // and remove coarsening flags on cells adjacent to vertices that
+          // will see refinement
+          internal::limit_level_difference_at_vertices(*this);
         }
 
       //-----------------------------------
@@ -17460,7 +18289,27 @@ bool Triangulation<dim, spacedim>::prepare_coarsening_and_refinement()
       //    global loop. when this function terminates, the
       //    requirement will be fulfilled. However, it might be faster
       //    to insert an inner loop here.
+      //
+      //    if all refine flags are isotropic and no anisotropic
+      //    smoothing is requested, all this reduces to refining coarser
+      //    neighbors of cells flagged for refinement, which is done in
+      //    parallel by a separate function, and the loop below has
+      //    nothing left to do.
+      bool only_isotropic_refinement =
+        !anisotropic_refinement &&
+        !(smooth_grid & allow_anisotropic_smoothing);
+      for (const auto &level : levels)
+        for (const std::uint8_t flag : level->refine_flags)
+          if (flag != RefinementCase<dim>::no_refinement &&
+              flag != RefinementCase<dim>::isotropic_refinement)
+            only_isotropic_refinement = false;
+
       bool changed = true;
+      if (only_isotropic_refinement)
+        {
+          internal::enforce_isotropic_refinement_at_faces(*this);
+          changed = false;
+        }
       while (changed)
         {
           changed                   = false;
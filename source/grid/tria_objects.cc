@@ -61,6 +61,21 @@ namespace internal
     }
 
 
+    void
+    TriaObjects::allocate_user_data()
+    {
+      std::lock_guard<std::mutex> lock(user_data_allocation.mutex);
+      if (user_data_allocation.is_allocated.load(std::memory_order_relaxed) ==
+          false)
+        {
+          user_data.resize(n_objects());
+          user_data_allocation.is_allocated.store(true,
+                                                  std::memory_order_release);
+        }
+    }
+
+
+
     std::size_t
     TriaObjects::memory_consumption() const
     {
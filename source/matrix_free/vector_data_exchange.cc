@@ -1359,6 +1359,22 @@ namespace internal
 
 
 
+      const std::vector<unsigned int> &
+      Full::get_sm_ghost_ranks() const
+      {
+        return sm_ghost_ranks;
+      }
+
+
+
+      const std::vector<unsigned int> &
+      Full::get_sm_import_ranks() const
+      {
+        return sm_import_ranks;
+      }
+
+
+
       void
       Full::reset_ghost_values(const ArrayView<double> &ghost_array) const
       {
@@ -0,0 +1,143 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Check that the DoF indices and values that DoFCellAccessor returns with
+// DoFHandler::enable_cell_dof_indices_cache() are the same as without the
+// cache, also after renumbering and after refining the mesh and distributing
+// the DoFs again.
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_renumbering.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_system.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/hp/fe_collection.h>
+
+#include <deal.II/lac/vector.h>
+
+#include "../tests.h"
+
+
+
+template <int dim>
+std::vector<double>
+get_all_dof_indices_and_values(const DoFHandler<dim> &dof_handler)
+{
+  Vector<double> vector(dof_handler.n_dofs());
+  for (unsigned int i = 0; i < vector.size(); ++i)
+    vector(i) = i;
+
+  Vector<double>                       sum(dof_handler.n_dofs());
+  std::vector<double>                  all_values;
+  std::vector<double>                  values;
+  std::vector<double>                  ones;
+  std::vector<types::global_dof_index> indices;
+  for (const auto &cell : dof_handler.active_cell_iterators())
+    {
+      const unsigned int n_dofs = cell->get_fe().n_dofs_per_cell();
+      indices.resize(n_dofs);
+      values.resize(n_dofs);
+      ones.assign(n_dofs, 1.);
+
+      cell->get_dof_indices(indices);
+      cell->get_dof_values(vector, values.begin(), values.end());
+      cell->distribute_local_to_global(ones.begin(), ones.end(), sum);
+
+      for (unsigned int i = 0; i < n_dofs; ++i)
+        AssertThrow(values[i] == indices[i], ExcInternalError());
+      all_values.insert(all_values.end(), indices.begin(), indices.end());
+    }
+  all_values.insert(all_values.end(), sum.begin(), sum.end());
+
+  return all_values;
+}
+
+
+
+template <int dim>
+void
+check_cache(DoFHandler<dim> &dof_handler)
+{
+  AssertThrow(dof_handler.has_cell_dof_indices_cache(), ExcInternalError());
+  const std::vector<double> cached =
+    get_all_dof_indices_and_values(dof_handler);
+
+  dof_handler.enable_cell_dof_indices_cache(false);
+  AssertThrow(dof_handler.has_cell_dof_indices_cache() == false,
+              ExcInternalError());
+  AssertThrow(get_all_dof_indices_and_values(dof_handler) == cached,
+              ExcInternalError());
+
+  dof_handler.enable_cell_dof_indices_cache();
+}
+
+
+
+template <int dim>
+void
+test(const hp::FECollection<dim> &fe)
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_ball(tria);
+  tria.refine_global(1);
+  for (const auto &cell : tria.active_cell_iterators())
+    if (cell->center()[0] > 0.2)
+      cell->set_refine_flag();
+  tria.execute_coarsening_and_refinement();
+
+  DoFHandler<dim> dof_handler(tria);
+  unsigned int    counter = 0;
+  for (const auto &cell : dof_handler.active_cell_iterators())
+    cell->set_active_fe_index(counter++ % fe.size());
+
+  dof_handler.enable_cell_dof_indices_cache();
+  AssertThrow(dof_handler.has_cell_dof_indices_cache() == false,
+              ExcInternalError());
+
+  dof_handler.distribute_dofs(fe);
+  check_cache(dof_handler);
+
+  DoFRenumbering::Cuthill_McKee(dof_handler);
+  check_cache(dof_handler);
+
+  // the cache is invalidated by refinement and rebuilt by distribute_dofs()
+  tria.refine_global(1);
+  AssertThrow(dof_handler.has_cell_dof_indices_cache() == false,
+              ExcInternalError());
+  dof_handler.distribute_dofs(fe);
+  check_cache(dof_handler);
+
+  deallog << "OK for " << fe[0].get_name();
+  for (unsigned int i = 1; i < fe.size(); ++i)
+    deallog << ", " << fe[i].get_name();
+  deallog << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2>(hp::FECollection<2>(FE_Q<2>(2)));
+  test<2>(hp::FECollection<2>(FESystem<2>(FE_Q<2>(3), 2)));
+  test<2>(hp::FECollection<2>(FE_Q<2>(1), FE_Q<2>(3)));
+  test<3>(hp::FECollection<3>(FE_Q<3>(2)));
+  test<3>(hp::FECollection<3>(FE_Q<3>(1), FE_Q<3>(3)));
+}
@@ -0,0 +1,106 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Check that DoFHandler::distribute_dofs() and
+// DoFHandler::distribute_mg_dofs() produce the same numbering when the DoFs
+// are enumerated by several threads as when they are enumerated by a single
+// thread.
+
+#include <deal.II/base/multithread_info.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_system.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include "../tests.h"
+
+
+
+template <int dim>
+std::vector<types::global_dof_index>
+get_all_dof_indices(const FiniteElement<dim> &fe,
+                    const Triangulation<dim> &tria,
+                    const unsigned int        n_threads)
+{
+  MultithreadInfo::set_thread_limit(n_threads);
+
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+  dof_handler.distribute_mg_dofs();
+
+  std::vector<types::global_dof_index> all_indices;
+  std::vector<types::global_dof_index> indices(fe.n_dofs_per_cell());
+  for (const auto &cell : dof_handler.active_cell_iterators())
+    {
+      cell->get_dof_indices(indices);
+      all_indices.insert(all_indices.end(), indices.begin(), indices.end());
+    }
+  for (const auto &cell : dof_handler.cell_iterators())
+    {
+      cell->get_mg_dof_indices(indices);
+      all_indices.insert(all_indices.end(), indices.begin(), indices.end());
+    }
+  all_indices.push_back(dof_handler.n_dofs());
+
+  return all_indices;
+}
+
+
+
+template <int dim>
+void
+test()
+{
+  Triangulation<dim> tria(
+    Triangulation<dim>::limit_level_difference_at_vertices);
+  GridGenerator::hyper_ball(tria);
+  tria.refine_global(1);
+  for (unsigned int cycle = 0; cycle < 2; ++cycle)
+    {
+      for (const auto &cell : tria.active_cell_iterators())
+        if (cell->center()[0] > 0.2)
+          cell->set_refine_flag();
+      tria.execute_coarsening_and_refinement();
+    }
+
+  const FE_Q<dim>     fe_q(3);
+  const FESystem<dim> fe_system(FE_Q<dim>(2), dim, FE_Q<dim>(1), 1);
+  for (const FiniteElement<dim> *fe :
+       std::vector<const FiniteElement<dim> *>{&fe_q, &fe_system})
+    {
+      const std::vector<types::global_dof_index> indices_sequential =
+        get_all_dof_indices(*fe, tria, 1);
+      const std::vector<types::global_dof_index> indices_parallel =
+        get_all_dof_indices(*fe, tria, 4);
+
+      AssertThrow(indices_sequential == indices_parallel, ExcInternalError());
+
+      deallog << "OK for " << fe->get_name() << std::endl;
+    }
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2>();
+  test<3>();
+}
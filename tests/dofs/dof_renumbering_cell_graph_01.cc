@@ -0,0 +1,112 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Check DoFRenumbering::cell_graph_Cuthill_McKee() for active and level
+// degrees of freedom: starting from a random numbering, the renumbering
+// must produce a much smaller bandwidth of the sparsity pattern.
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_renumbering.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+
+#include <deal.II/multigrid/mg_tools.h>
+
+#include "../tests.h"
+
+
+
+void
+check_bandwidth(const DynamicSparsityPattern &dsp_random,
+                const DynamicSparsityPattern &dsp_renumbered)
+{
+  AssertThrow(dsp_renumbered.n_nonzero_elements() ==
+                dsp_random.n_nonzero_elements(),
+              ExcInternalError());
+
+  // the bandwidth of a random numbering is close to the number of DoFs, so
+  // only check on meshes that are large enough for the difference to be
+  // significant
+  if (dsp_random.n_rows() > 1000)
+    AssertThrow(2 * dsp_renumbered.bandwidth() < dsp_random.bandwidth(),
+                ExcInternalError());
+}
+
+
+
+template <int dim>
+void
+test()
+{
+  Triangulation<dim> tria(
+    Triangulation<dim>::limit_level_difference_at_vertices);
+  GridGenerator::hyper_ball(tria);
+  tria.refine_global(5 - dim);
+  for (const auto &cell : tria.active_cell_iterators())
+    if (cell->center()[0] > 0.3)
+      cell->set_refine_flag();
+  tria.execute_coarsening_and_refinement();
+
+  FE_Q<dim>       fe(2);
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+  dof_handler.distribute_mg_dofs();
+
+  {
+    DoFRenumbering::random(dof_handler);
+    DynamicSparsityPattern dsp_random(dof_handler.n_dofs());
+    DoFTools::make_sparsity_pattern(dof_handler, dsp_random);
+
+    DoFRenumbering::cell_graph_Cuthill_McKee(dof_handler);
+    DynamicSparsityPattern dsp_renumbered(dof_handler.n_dofs());
+    DoFTools::make_sparsity_pattern(dof_handler, dsp_renumbered);
+
+    check_bandwidth(dsp_random, dsp_renumbered);
+  }
+
+  for (unsigned int level = 0; level < tria.n_levels(); ++level)
+    {
+      DoFRenumbering::random(dof_handler, level);
+      DynamicSparsityPattern dsp_random(dof_handler.n_dofs(level));
+      MGTools::make_sparsity_pattern(dof_handler, dsp_random, level);
+
+      DoFRenumbering::cell_graph_Cuthill_McKee(dof_handler, level);
+      DynamicSparsityPattern dsp_renumbered(dof_handler.n_dofs(level));
+      MGTools::make_sparsity_pattern(dof_handler, dsp_renumbered, level);
+
+      check_bandwidth(dsp_random, dsp_renumbered);
+    }
+
+  // the non-reversed ordering must be valid as well
+  DoFRenumbering::cell_graph_Cuthill_McKee(dof_handler, false);
+
+  deallog << "OK for " << dim << 'd' << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2>();
+  test<3>();
+}
@@ -0,0 +1,175 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Check DoFTools::make_hanging_node_constraints() for DoFHandler objects
+// without hp-capabilities, for which the constraints are computed in
+// parallel: the same DoFs must be constrained as with an hp-DoFHandler that
+// uses the same element everywhere, with the same weights and
+// inhomogeneities, and the constraints must reproduce polynomials that lie
+// in the finite element space.
+
+#include <deal.II/base/function.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_system.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/hp/fe_collection.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/vector.h>
+
+#include <deal.II/numerics/vector_tools.h>
+
+#include "../tests.h"
+
+
+
+template <int dim>
+class Polynomial : public Function<dim>
+{
+public:
+  Polynomial(const unsigned int n_components, const unsigned int degree)
+    : Function<dim>(n_components)
+    , degree(degree)
+  {}
+
+  virtual double
+  value(const Point<dim> &p, const unsigned int component) const override
+  {
+    return std::pow(p[0], degree) + p[0] * p[dim - 1] + component;
+  }
+
+private:
+  const unsigned int degree;
+};
+
+
+
+template <int dim>
+void
+test(const FiniteElement<dim> &fe)
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_cube(tria, -1, 1);
+  tria.refine_global(2);
+  for (unsigned int step = 0; step < 2; ++step)
+    {
+      for (const auto &cell : tria.active_cell_iterators())
+        if (cell->center()[0] > 0 && cell->center()[dim - 1] > 0)
+          cell->set_refine_flag();
+      tria.execute_coarsening_and_refinement();
+    }
+
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+  AssertThrow(dof_handler.has_hp_capabilities() == false, ExcInternalError());
+
+  AffineConstraints<double> constraints;
+  DoFTools::make_hanging_node_constraints(dof_handler, constraints);
+  constraints.close();
+  AssertThrow(constraints.n_constraints() > 0, ExcInternalError());
+
+  // an hp-DoFHandler with the same element on all cells
+  DoFHandler<dim> hp_dof_handler(tria);
+  hp_dof_handler.distribute_dofs(hp::FECollection<dim>(fe, fe));
+  AssertThrow(hp_dof_handler.has_hp_capabilities(), ExcInternalError());
+  AssertThrow(hp_dof_handler.n_dofs() == dof_handler.n_dofs(),
+              ExcInternalError());
+
+  AffineConstraints<double> hp_constraints;
+  DoFTools::make_hanging_node_constraints(hp_dof_handler, hp_constraints);
+  hp_constraints.close();
+  AssertThrow(hp_constraints.n_constraints() == constraints.n_constraints(),
+              ExcInternalError());
+
+  // the two DoFHandler objects may enumerate the DoFs differently, so match
+  // them via the local DoF indices on each cell
+  std::vector<types::global_dof_index> dof_to_hp_dof(dof_handler.n_dofs());
+  std::vector<types::global_dof_index> local_dof_indices(fe.n_dofs_per_cell());
+  std::vector<types::global_dof_index> hp_local_dof_indices(
+    fe.n_dofs_per_cell());
+  for (const auto &cell : dof_handler.active_cell_iterators())
+    {
+      cell->get_dof_indices(local_dof_indices);
+      typename DoFHandler<dim>::active_cell_iterator(&tria,
+                                                     cell->level(),
+                                                     cell->index(),
+                                                     &hp_dof_handler)
+        ->get_dof_indices(hp_local_dof_indices);
+      for (unsigned int i = 0; i < fe.n_dofs_per_cell(); ++i)
+        dof_to_hp_dof[local_dof_indices[i]] = hp_local_dof_indices[i];
+    }
+
+  // each constraint line must coincide with the one computed for the
+  // hp-DoFHandler, including the entries and the inhomogeneity
+  for (const auto &line : constraints.get_lines())
+    {
+      const types::global_dof_index hp_index = dof_to_hp_dof[line.index];
+      AssertThrow(hp_constraints.is_constrained(hp_index), ExcInternalError());
+
+      const auto *hp_entries =
+        hp_constraints.get_constraint_entries(hp_index);
+      AssertThrow(hp_entries->size() == line.entries.size(),
+                  ExcInternalError());
+
+      std::map<types::global_dof_index, double> entries;
+      for (const auto &entry : line.entries)
+        entries[dof_to_hp_dof[entry.first]] = entry.second;
+      for (const auto &hp_entry : *hp_entries)
+        {
+          AssertThrow(entries.find(hp_entry.first) != entries.end(),
+                      ExcInternalError());
+          AssertThrow(std::abs(entries[hp_entry.first] - hp_entry.second) <
+                        1e-12,
+                      ExcInternalError());
+        }
+
+      AssertThrow(std::abs(hp_constraints.get_inhomogeneity(hp_index) -
+                           line.inhomogeneity) < 1e-12,
+                  ExcInternalError());
+    }
+
+  // the constraints must not change the interpolant of a polynomial in the
+  // finite element space
+  Vector<double> interpolant(dof_handler.n_dofs());
+  VectorTools::interpolate(dof_handler,
+                           Polynomial<dim>(fe.n_components(), fe.degree),
+                           interpolant);
+  Vector<double> constrained = interpolant;
+  constraints.distribute(constrained);
+  constrained -= interpolant;
+  AssertThrow(constrained.linfty_norm() < 1e-10 * interpolant.linfty_norm(),
+              ExcInternalError());
+
+  deallog << "OK for " << fe.get_name() << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2>(FE_Q<2>(2));
+  test<2>(FESystem<2>(FE_Q<2>(3), 2));
+  test<3>(FE_Q<3>(2));
+  test<3>(FESystem<3>(FE_Q<3>(2), 3));
+}
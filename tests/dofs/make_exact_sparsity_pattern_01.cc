@@ -0,0 +1,128 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Check that DoFTools::make_exact_sparsity_pattern() creates the same
+// sparsity pattern as DoFTools::make_sparsity_pattern() followed by a copy
+// from a DynamicSparsityPattern, with and without hanging node and boundary
+// constraints and with and without keeping constrained entries.
+
+#include <deal.II/base/function.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_system.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/hp/fe_collection.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/sparsity_pattern.h>
+
+#include <deal.II/numerics/vector_tools.h>
+
+#include "../tests.h"
+
+
+
+template <int dim>
+void
+compare(const DoFHandler<dim>           &dof_handler,
+        const AffineConstraints<double> &constraints,
+        const bool                       keep_constrained_dofs)
+{
+  DynamicSparsityPattern dsp(dof_handler.n_dofs());
+  DoFTools::make_sparsity_pattern(dof_handler,
+                                  dsp,
+                                  constraints,
+                                  keep_constrained_dofs);
+  SparsityPattern reference;
+  reference.copy_from(dsp);
+
+  SparsityPattern sparsity;
+  DoFTools::make_exact_sparsity_pattern(dof_handler,
+                                        sparsity,
+                                        constraints,
+                                        keep_constrained_dofs);
+
+  AssertThrow(sparsity.is_compressed(), ExcInternalError());
+  AssertThrow(sparsity.n_nonzero_elements() == reference.n_nonzero_elements(),
+              ExcInternalError());
+  AssertThrow(sparsity == reference, ExcInternalError());
+}
+
+
+
+template <int dim>
+void
+test(const hp::FECollection<dim> &fe)
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_ball(tria);
+  tria.refine_global(1);
+  for (const auto &cell : tria.active_cell_iterators())
+    if (cell->center()[0] > 0.2)
+      cell->set_refine_flag();
+  tria.execute_coarsening_and_refinement();
+
+  DoFHandler<dim> dof_handler(tria);
+  unsigned int    counter = 0;
+  for (const auto &cell : dof_handler.active_cell_iterators())
+    cell->set_active_fe_index(counter++ % fe.size());
+  dof_handler.distribute_dofs(fe);
+
+  AffineConstraints<double> constraints;
+  constraints.close();
+  compare(dof_handler, constraints, true);
+
+  constraints.clear();
+  DoFTools::make_hanging_node_constraints(dof_handler, constraints);
+  constraints.close();
+  compare(dof_handler, constraints, true);
+  compare(dof_handler, constraints, false);
+
+  constraints.clear();
+  DoFTools::make_hanging_node_constraints(dof_handler, constraints);
+  VectorTools::interpolate_boundary_values(
+    dof_handler,
+    0,
+    Functions::ZeroFunction<dim>(fe.n_components()),
+    constraints);
+  constraints.close();
+  compare(dof_handler, constraints, true);
+  compare(dof_handler, constraints, false);
+
+  deallog << "OK for " << fe[0].get_name();
+  for (unsigned int i = 1; i < fe.size(); ++i)
+    deallog << ", " << fe[i].get_name();
+  deallog << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2>(hp::FECollection<2>(FE_Q<2>(2)));
+  test<2>(hp::FECollection<2>(FESystem<2>(FE_Q<2>(3), 2)));
+  test<2>(hp::FECollection<2>(FE_Q<2>(1), FE_Q<2>(3)));
+  test<3>(hp::FECollection<3>(FE_Q<3>(2)));
+  test<3>(hp::FECollection<3>(FE_Q<3>(1), FE_Q<3>(3)));
+}
@@ -0,0 +1,118 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Check that FEValues::get_function_values() and get_function_gradients(),
+// which use sum factorization for scalar elements with tensor-product shape
+// functions on tensor-product quadrature formulas, agree with the sum over
+// the shape functions, also on curved cells.
+
+#include <deal.II/base/quadrature_lib.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_values.h>
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/vector.h>
+
+#include "../tests.h"
+
+
+
+template <int dim>
+void
+test(const FiniteElement<dim> &fe, const Quadrature<dim> &quadrature)
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_ball(tria);
+  tria.refine_global(1);
+
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  Vector<double> solution(dof_handler.n_dofs());
+  for (unsigned int i = 0; i < solution.size(); ++i)
+    solution(i) = random_value<double>();
+
+  const MappingQ<dim> mapping(3);
+
+  FEValues<dim> fe_values(mapping,
+                          fe,
+                          quadrature,
+                          update_values | update_gradients);
+
+  std::vector<double>                  values(quadrature.size());
+  std::vector<double>                  values_indices(quadrature.size());
+  std::vector<Tensor<1, dim>>          gradients(quadrature.size());
+  std::vector<Tensor<1, dim>>          gradients_indices(quadrature.size());
+  std::vector<types::global_dof_index> dof_indices(fe.n_dofs_per_cell());
+  for (const auto &cell : dof_handler.active_cell_iterators())
+    {
+      fe_values.reinit(cell);
+      cell->get_dof_indices(dof_indices);
+
+      fe_values.get_function_values(solution, values);
+      fe_values.get_function_gradients(solution, gradients);
+      fe_values.get_function_values(solution,
+                                    make_array_view(dof_indices),
+                                    values_indices);
+      fe_values.get_function_gradients(solution,
+                                       make_array_view(dof_indices),
+                                       gradients_indices);
+
+      for (const unsigned int q : fe_values.quadrature_point_indices())
+        {
+          double         value = 0;
+          Tensor<1, dim> gradient;
+          for (const unsigned int i : fe_values.dof_indices())
+            {
+              value += solution(dof_indices[i]) * fe_values.shape_value(i, q);
+              gradient += solution(dof_indices[i]) * fe_values.shape_grad(i, q);
+            }
+
+          AssertThrow(std::abs(values[q] - value) < 1e-12,
+                      ExcInternalError());
+          AssertThrow(std::abs(values_indices[q] - value) < 1e-12,
+                      ExcInternalError());
+          AssertThrow((gradients[q] - gradient).norm() <
+                        1e-10 * (1. + gradient.norm()),
+                      ExcInternalError());
+          AssertThrow((gradients_indices[q] - gradient).norm() <
+                        1e-10 * (1. + gradient.norm()),
+                      ExcInternalError());
+        }
+    }
+
+  deallog << "OK for " << fe.get_name() << " with " << quadrature.size()
+          << " quadrature points" << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2>(FE_Q<2>(3), QGauss<2>(4));
+  test<2>(FE_Q<2>(4), QGaussLobatto<2>(5));
+  test<2>(FE_DGQ<2>(2), QGauss<2>(2));
+  test<3>(FE_Q<3>(2), QGauss<3>(3));
+  test<3>(FE_DGQ<3>(3), QGauss<3>(5));
+}
@@ -0,0 +1,92 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Create a parallel::fullydistributed::Triangulation directly with
+// GridGenerator::subdivided_hyper_rectangle() and compare the locally
+// relevant cells with the ones of the serial mesh.
+
+#include <deal.II/base/mpi.h>
+
+#include <deal.II/distributed/fully_distributed_tria.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/grid/tria_description.h>
+
+#include "../tests.h"
+
+
+template <int dim>
+void
+test(const std::vector<unsigned int> &repetitions, const MPI_Comm comm)
+{
+  Point<dim> p1, p2;
+  for (unsigned int d = 0; d < dim; ++d)
+    {
+      p1[d] = -1.;
+      p2[d] = 1. + d;
+    }
+
+  parallel::fullydistributed::Triangulation<dim> tria(comm);
+  GridGenerator::subdivided_hyper_rectangle(tria, repetitions, p1, p2, true);
+
+  Triangulation<dim> serial_tria;
+  GridGenerator::subdivided_hyper_rectangle(
+    serial_tria, repetitions, p1, p2, true);
+
+  for (const auto &cell : tria.active_cell_iterators())
+    if (!cell->is_artificial())
+      {
+        const auto serial_cell = serial_tria.create_cell_iterator(cell->id());
+
+        for (const unsigned int v : cell->vertex_indices())
+          AssertThrow(cell->vertex(v) == serial_cell->vertex(v),
+                      ExcInternalError());
+        AssertThrow(cell->material_id() == serial_cell->material_id(),
+                    ExcInternalError());
+
+        // ghost cells may have faces at the boundary of the locally
+        // relevant part of the mesh, so only check locally owned cells
+        if (cell->is_locally_owned())
+          for (const unsigned int f : cell->face_indices())
+            AssertThrow(cell->face(f)->boundary_id() ==
+                          serial_cell->face(f)->boundary_id(),
+                        ExcInternalError());
+      }
+
+  deallog << "locally owned cells: " << tria.n_locally_owned_active_cells()
+          << " of " << tria.n_global_active_cells() << std::endl;
+}
+
+
+
+int
+main(int argc, char *argv[])
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  MPILogInitAll                    all;
+
+  const MPI_Comm comm = MPI_COMM_WORLD;
+
+  {
+    deallog.push("2d");
+    test<2>({4, 3}, comm);
+    deallog.pop();
+  }
+  {
+    deallog.push("3d");
+    test<3>({3, 2, 2}, comm);
+    deallog.pop();
+  }
+}
@@ -0,0 +1,106 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Write a parallel::fullydistributed::Triangulation to one vtu file per
+// process and read it back with GridIn::read_partitioned_vtu().
+
+#include <deal.II/base/mpi.h>
+
+#include <deal.II/distributed/fully_distributed_tria.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_in.h>
+#include <deal.II/grid/grid_out.h>
+#include <deal.II/grid/tria.h>
+
+#include "../tests.h"
+
+
+template <int dim>
+void
+test(const std::vector<unsigned int> &repetitions, const MPI_Comm comm)
+{
+  const unsigned int rank = Utilities::MPI::this_mpi_process(comm);
+
+  Point<dim> p1, p2;
+  for (unsigned int d = 0; d < dim; ++d)
+    p2[d] = 1. + d;
+
+  parallel::fullydistributed::Triangulation<dim> tria(comm);
+  GridGenerator::subdivided_hyper_rectangle(tria, repetitions, p1, p2, true);
+
+  const std::string file_prefix = "mesh_" + std::to_string(dim) + "d";
+  const std::string file_name =
+    (Utilities::MPI::n_mpi_processes(comm) == 1 ?
+       file_prefix + ".vtu" :
+       file_prefix + "_" + std::to_string(rank + 1) + ".vtu");
+  {
+    GridOut grid_out;
+    grid_out.set_flags(GridOutFlags::Vtu(true, true));
+    std::ofstream out(file_name);
+    grid_out.write_vtu(tria, out);
+  }
+
+  parallel::fullydistributed::Triangulation<dim> tria_in(comm);
+  GridIn<dim>                                    grid_in(tria_in);
+  grid_in.read_partitioned_vtu(file_prefix);
+
+  std::remove(file_name.c_str());
+
+  AssertThrow(tria_in.n_global_active_cells() == tria.n_global_active_cells(),
+              ExcInternalError());
+
+  for (const auto &cell : tria_in.active_cell_iterators())
+    if (!cell->is_artificial())
+      {
+        const auto other = tria.create_cell_iterator(cell->id());
+
+        AssertThrow(cell->subdomain_id() == other->subdomain_id(),
+                    ExcInternalError());
+        AssertThrow(cell->material_id() == other->material_id(),
+                    ExcInternalError());
+        for (const unsigned int v : cell->vertex_indices())
+          AssertThrow(cell->vertex(v) == other->vertex(v), ExcInternalError());
+        if (cell->is_locally_owned())
+          for (const unsigned int f : cell->face_indices())
+            AssertThrow(cell->face(f)->boundary_id() ==
+                          other->face(f)->boundary_id(),
+                        ExcInternalError());
+      }
+
+  deallog << "locally owned cells: " << tria_in.n_locally_owned_active_cells()
+          << " of " << tria_in.n_global_active_cells() << std::endl;
+}
+
+
+
+int
+main(int argc, char *argv[])
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  MPILogInitAll                    all;
+
+  const MPI_Comm comm = MPI_COMM_WORLD;
+
+  {
+    deallog.push("2d");
+    test<2>({4, 3}, comm);
+    deallog.pop();
+  }
+  {
+    deallog.push("3d");
+    test<3>({3, 2, 2}, comm);
+    deallog.pop();
+  }
+}
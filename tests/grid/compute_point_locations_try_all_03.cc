@@ -0,0 +1,108 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Test GridTools::compute_point_locations_try_all on a large number of
+// points on an adaptively refined mesh with a curved mapping, which makes
+// the function search for the points with several threads: every point
+// must be reported exactly once, either as missing or on a cell that
+// contains it, and the results must be the same when using a single thread.
+
+#include <deal.II/base/multithread_info.h>
+
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/grid_tools_cache.h>
+#include <deal.II/grid/tria.h>
+
+#include "../tests.h"
+
+
+template <int dim>
+void
+test()
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_ball(tria);
+  tria.refine_global(2);
+  for (const auto &cell : tria.active_cell_iterators())
+    if (cell->center()[0] > 0)
+      cell->set_refine_flag();
+  tria.execute_coarsening_and_refinement();
+
+  const MappingQ<dim>        mapping(3);
+  GridTools::Cache<dim, dim> cache(tria, mapping);
+
+  // points in the bounding box of the ball, so that some of them lie
+  // outside of the mesh
+  std::vector<Point<dim>> points;
+  for (unsigned int i = 0; i < 2000; ++i)
+    {
+      Point<dim> p = random_point<dim>();
+      for (unsigned int d = 0; d < dim; ++d)
+        p[d] = 2. * p[d] - 1.;
+      points.push_back(p);
+    }
+
+  const auto result = GridTools::compute_point_locations_try_all(cache, points);
+
+  const auto &cells   = std::get<0>(result);
+  const auto &qpoints = std::get<1>(result);
+  const auto &maps    = std::get<2>(result);
+  const auto &missing = std::get<3>(result);
+
+  std::vector<unsigned int> n_found(points.size(), 0);
+  for (unsigned int c = 0; c < cells.size(); ++c)
+    for (unsigned int q = 0; q < qpoints[c].size(); ++q)
+      {
+        ++n_found[maps[c][q]];
+        AssertThrow(cells[c]->reference_cell().contains_point(qpoints[c][q],
+                                                              1e-10),
+                    ExcInternalError());
+        AssertThrow(mapping.transform_unit_to_real_cell(cells[c],
+                                                        qpoints[c][q])
+                        .distance(points[maps[c][q]]) < 1e-8,
+                    ExcInternalError());
+      }
+  for (const unsigned int i : missing)
+    ++n_found[i];
+  for (const unsigned int n : n_found)
+    AssertThrow(n == 1, ExcInternalError());
+
+  // compare with the search on a single thread
+  const unsigned int n_threads = MultithreadInfo::n_threads();
+  MultithreadInfo::set_thread_limit(1);
+  const auto sequential_result =
+    GridTools::compute_point_locations_try_all(cache, points);
+  MultithreadInfo::set_thread_limit(n_threads);
+
+  AssertThrow(std::get<0>(sequential_result) == cells, ExcInternalError());
+  AssertThrow(std::get<1>(sequential_result) == qpoints, ExcInternalError());
+  AssertThrow(std::get<2>(sequential_result) == maps, ExcInternalError());
+  AssertThrow(std::get<3>(sequential_result) == missing, ExcInternalError());
+
+  deallog << "OK for " << dim << 'd' << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2>();
+  test<3>();
+}
@@ -0,0 +1,84 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Test that GridTools::compute_point_locations_try_all, which maps the
+// points around the same cell to the reference cell all at once, finds the
+// same cells and reference points as GridTools::find_active_cell_around_point
+// for points that lie clearly inside a cell of a curved mesh.
+
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/grid_tools_cache.h>
+#include <deal.II/grid/tria.h>
+
+#include "../tests.h"
+
+
+template <int dim>
+void
+test()
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_ball(tria);
+  tria.refine_global(2);
+
+  const MappingQ<dim>        mapping(4);
+  GridTools::Cache<dim, dim> cache(tria, mapping);
+
+  std::vector<Point<dim>> points;
+  for (unsigned int i = 0; i < 1000; ++i)
+    {
+      Point<dim> p = random_point<dim>();
+      for (unsigned int d = 0; d < dim; ++d)
+        p[d] = 1.4 * p[d] - 0.7;
+      points.push_back(p);
+    }
+
+  const auto result = GridTools::compute_point_locations_try_all(cache, points);
+
+  const auto &cells   = std::get<0>(result);
+  const auto &qpoints = std::get<1>(result);
+  const auto &maps    = std::get<2>(result);
+
+  unsigned int n_compared = 0;
+  for (unsigned int c = 0; c < cells.size(); ++c)
+    for (unsigned int q = 0; q < qpoints[c].size(); ++q)
+      if (cells[c]->reference_cell().contains_point(qpoints[c][q], -1e-4))
+        {
+          const auto cell_and_point =
+            GridTools::find_active_cell_around_point(cache,
+                                                     points[maps[c][q]]);
+          AssertThrow(cell_and_point.first == cells[c], ExcInternalError());
+          AssertThrow(cell_and_point.second.distance(qpoints[c][q]) < 1e-10,
+                      ExcInternalError());
+          ++n_compared;
+        }
+
+  AssertThrow(n_compared > points.size() / 2, ExcInternalError());
+
+  deallog << "OK for " << dim << 'd' << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2>();
+  test<3>();
+}
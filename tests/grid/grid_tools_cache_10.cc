@@ -0,0 +1,120 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Test GridTools::Cache::get_locally_owned_active_cells() against the data
+// obtained by looping over the active cell iterators, and make sure that the
+// cached view is rebuilt after the triangulation has been refined.
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools_cache.h>
+#include <deal.II/grid/tria.h>
+
+#include <atomic>
+
+#include "../tests.h"
+
+
+
+template <int dim>
+void
+check(const GridTools::Cache<dim> &cache)
+{
+  const Triangulation<dim> &tria  = cache.get_triangulation();
+  const auto               &cells = cache.get_locally_owned_active_cells();
+
+  AssertThrow(cells.n_cells() == tria.n_active_cells(), ExcInternalError());
+
+  unsigned int i = 0;
+  for (const auto &cell : tria.active_cell_iterators())
+    {
+      AssertThrow(cells.get_cell(i, tria) == cell, ExcInternalError());
+      AssertThrow(cells.active_cell_indices[i] == cell->active_cell_index(),
+                  ExcInternalError());
+      AssertThrow(cells.material_ids[i] == cell->material_id(),
+                  ExcInternalError());
+      AssertThrow(cells.measures[i] == cell->measure(), ExcInternalError());
+
+      AssertThrow(cells.vertices(i).size() == cell->n_vertices(),
+                  ExcInternalError());
+      for (const unsigned int v : cell->vertex_indices())
+        AssertThrow(cells.vertices(i)[v] == cell->vertex_index(v),
+                    ExcInternalError());
+
+      AssertThrow(cells.boundary_ids(i).size() == cell->n_faces(),
+                  ExcInternalError());
+      for (const unsigned int f : cell->face_indices())
+        AssertThrow(cells.boundary_ids(i)[f] == cell->face(f)->boundary_id(),
+                    ExcInternalError());
+      ++i;
+    }
+
+  // Accumulate some quantities with the parallel loop helpers.
+  std::vector<double> measures(tria.n_active_cells());
+  cells.parallel_for(
+    [&](const unsigned int c) {
+      measures[cells.active_cell_indices[c]] = cells.measures[c];
+    },
+    4);
+
+  std::atomic<unsigned int> n_boundary_faces(0);
+  cells.parallel_for_subranges(
+    [&](const unsigned int begin, const unsigned int end) {
+      unsigned int count = 0;
+      for (unsigned int c = begin; c < end; ++c)
+        for (const types::boundary_id b : cells.boundary_ids(c))
+          if (b != numbers::internal_face_boundary_id)
+            ++count;
+      n_boundary_faces += count;
+    },
+    4);
+
+  double measure = 0;
+  for (const double m : measures)
+    measure += m;
+
+  deallog << "n_cells: " << cells.n_cells() << " measure: " << measure
+          << " boundary faces: " << n_boundary_faces << std::endl;
+}
+
+
+
+template <int dim>
+void
+test()
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_cube(tria, -1, 1);
+  tria.refine_global(2);
+
+  GridTools::Cache<dim> cache(tria);
+  check(cache);
+
+  tria.begin_active()->set_refine_flag();
+  tria.execute_coarsening_and_refinement();
+  check(cache);
+
+  deallog << "OK for " << dim << 'd' << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<1>();
+  test<2>();
+  test<3>();
+}
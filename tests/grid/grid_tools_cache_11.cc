@@ -0,0 +1,127 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Test that the structures of GridTools::Cache that are updated
+// incrementally after a refinement cycle (the vertex to cell map, the used
+// vertices and their RTree, and the RTrees of cell bounding boxes) agree
+// with the ones computed from scratch, over several cycles that both refine
+// and coarsen cells.
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools_cache.h>
+#include <deal.II/grid/tria.h>
+
+#include "../tests.h"
+
+
+
+template <int dim>
+std::vector<std::pair<CellId, std::pair<Point<dim>, Point<dim>>>>
+sorted_entries(
+  const RTree<std::pair<BoundingBox<dim>,
+                        typename Triangulation<dim>::active_cell_iterator>>
+    &tree)
+{
+  std::vector<std::pair<CellId, std::pair<Point<dim>, Point<dim>>>> entries;
+  for (const auto &entry : tree)
+    entries.emplace_back(entry.second->id(),
+                         entry.first.get_boundary_points());
+  std::sort(entries.begin(),
+            entries.end(),
+            [](const auto &a, const auto &b) { return a.first < b.first; });
+  return entries;
+}
+
+
+
+template <int dim>
+std::vector<std::pair<unsigned int, Point<dim>>>
+sorted_entries(const RTree<std::pair<Point<dim>, unsigned int>> &tree)
+{
+  std::vector<std::pair<unsigned int, Point<dim>>> entries;
+  for (const auto &entry : tree)
+    entries.emplace_back(entry.second, entry.first);
+  std::sort(entries.begin(),
+            entries.end(),
+            [](const auto &a, const auto &b) { return a.first < b.first; });
+  return entries;
+}
+
+
+
+template <int dim>
+void
+compare(const GridTools::Cache<dim> &cache)
+{
+  // a new cache computes all structures from scratch
+  const GridTools::Cache<dim> reference(cache.get_triangulation());
+
+  AssertThrow(cache.get_vertex_to_cell_map() ==
+                reference.get_vertex_to_cell_map(),
+              ExcInternalError());
+  AssertThrow(cache.get_used_vertices() == reference.get_used_vertices(),
+              ExcInternalError());
+  AssertThrow(sorted_entries(cache.get_used_vertices_rtree()) ==
+                sorted_entries(reference.get_used_vertices_rtree()),
+              ExcInternalError());
+  AssertThrow(sorted_entries(cache.get_cell_bounding_boxes_rtree()) ==
+                sorted_entries(reference.get_cell_bounding_boxes_rtree()),
+              ExcInternalError());
+  AssertThrow(
+    sorted_entries(cache.get_locally_owned_cell_bounding_boxes_rtree()) ==
+      sorted_entries(reference.get_locally_owned_cell_bounding_boxes_rtree()),
+    ExcInternalError());
+}
+
+
+
+template <int dim>
+void
+test()
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(2);
+
+  GridTools::Cache<dim> cache(tria);
+  compare(cache);
+
+  for (unsigned int cycle = 0; cycle < 4; ++cycle)
+    {
+      for (const auto &cell : tria.active_cell_iterators())
+        if (cell->level() > 1 &&
+            static_cast<unsigned int>(cell->parent()->index()) % 2 ==
+              cycle % 2)
+          cell->set_coarsen_flag();
+        else if ((cell->active_cell_index() + cycle) % 5 == 0)
+          cell->set_refine_flag();
+      tria.execute_coarsening_and_refinement();
+
+      compare(cache);
+    }
+
+  deallog << "OK for " << dim << 'd' << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<1>();
+  test<2>();
+  test<3>();
+}
@@ -0,0 +1,108 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Test GridTools::compute_active_cell_hilbert_order() and
+// GridTools::partition_triangulation_hilbert(): on a uniformly refined
+// cube, cells that are consecutive along the Hilbert curve must be face
+// neighbors, and the partitions must be contiguous pieces of the curve of
+// (approximately) equal size or weight.
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/tria.h>
+
+#include "../tests.h"
+
+
+
+template <int dim>
+void
+test()
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(dim == 2 ? 3 : 2);
+
+  std::vector<typename Triangulation<dim>::active_cell_iterator> cells(
+    tria.n_active_cells());
+  for (const auto &cell : tria.active_cell_iterators())
+    cells[cell->active_cell_index()] = cell;
+
+  const std::vector<unsigned int> order =
+    GridTools::compute_active_cell_hilbert_order(tria);
+
+  // the order must be a permutation of the active cell indices
+  std::vector<unsigned int> sorted_order = order;
+  std::sort(sorted_order.begin(), sorted_order.end());
+  for (unsigned int i = 0; i < sorted_order.size(); ++i)
+    AssertThrow(sorted_order[i] == i, ExcInternalError());
+
+  // consecutive cells along the curve must share a face
+  for (unsigned int i = 1; i < order.size(); ++i)
+    {
+      bool is_neighbor = false;
+      for (const unsigned int f : cells[order[i]]->face_indices())
+        if (!cells[order[i]]->at_boundary(f) &&
+            cells[order[i]]->neighbor(f) == cells[order[i - 1]])
+          is_neighbor = true;
+      AssertThrow(is_neighbor, ExcInternalError());
+    }
+
+  // partition without weights and check the sizes of the partitions and
+  // that they are contiguous along the curve
+  GridTools::partition_triangulation_hilbert(3, tria);
+  std::vector<unsigned int> n_cells(3);
+  for (unsigned int i = 0; i < order.size(); ++i)
+    {
+      const types::subdomain_id id = cells[order[i]]->subdomain_id();
+      if (i > 0)
+        AssertThrow(id >= cells[order[i - 1]]->subdomain_id(),
+                    ExcInternalError());
+      ++n_cells[id];
+    }
+  deallog << "Cells per partition:";
+  for (const unsigned int n : n_cells)
+    deallog << ' ' << n;
+  deallog << std::endl;
+
+  // partition with weights and check that the weight of each partition
+  // differs from the average by at most the largest weight
+  std::vector<unsigned int> weights(tria.n_active_cells());
+  for (const auto &cell : tria.active_cell_iterators())
+    weights[cell->active_cell_index()] = (cell->center()[0] < 0.25 ? 5 : 1);
+  GridTools::partition_triangulation_hilbert(3, weights, tria);
+
+  std::vector<unsigned int> partition_weights(3);
+  for (const auto &cell : tria.active_cell_iterators())
+    partition_weights[cell->subdomain_id()] +=
+      weights[cell->active_cell_index()];
+  const unsigned int total_weight =
+    std::accumulate(weights.begin(), weights.end(), 0U);
+  for (const unsigned int w : partition_weights)
+    AssertThrow(std::abs(3. * w - total_weight) <= 3. * 5,
+                ExcInternalError());
+
+  deallog << "OK for " << dim << 'd' << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2>();
+  test<3>();
+}
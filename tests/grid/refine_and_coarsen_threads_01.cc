@@ -0,0 +1,187 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Check that the flag smoothing in prepare_coarsening_and_refinement() and
+// the creation and numbering of new objects in
+// execute_coarsening_and_refinement(), parts of which run in parallel, give
+// the same mesh independently of the number of threads. The meshes are large
+// enough for the loops over the cells of a level to be split into several
+// chunks. We also output a checksum of the numbering of cells, faces, lines,
+// and vertices, which was generated with the version of these functions that
+// only used a single thread, for meshes of hypercubes and of simplices.
+
+#include <deal.II/base/multithread_info.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/grid/tria_accessor.h>
+#include <deal.II/grid/tria_iterator.h>
+
+#include "../tests.h"
+
+
+
+// describe the mesh by the indices of the vertices, lines, faces, parent,
+// and children of all cells on all levels, as well as the locations of all
+// vertices, in a way that does not depend on rounding
+template <int dim>
+std::vector<std::int64_t>
+describe_mesh(const Triangulation<dim> &tria)
+{
+  std::vector<std::int64_t> description;
+  for (const auto &cell : tria.cell_iterators())
+    {
+      description.push_back(cell->level());
+      description.push_back(cell->index());
+      description.push_back(cell->is_active() ? -1 : cell->child_index(0));
+      description.push_back(cell->level() > 0 ? cell->parent_index() : -1);
+      for (const unsigned int v : cell->vertex_indices())
+        description.push_back(cell->vertex_index(v));
+      for (const unsigned int f : cell->face_indices())
+        {
+          description.push_back(cell->face_index(f));
+          description.push_back(cell->combined_face_orientation(f));
+        }
+      if (dim == 3)
+        for (const unsigned int l : cell->line_indices())
+          description.push_back(cell->line_index(l));
+    }
+
+  for (unsigned int v = 0; v < tria.n_vertices(); ++v)
+    if (tria.vertex_used(v))
+      for (unsigned int d = 0; d < dim; ++d)
+        description.push_back(
+          static_cast<std::int64_t>(std::round(tria.get_vertices()[v][d] *
+                                               (1 << 20))));
+
+  return description;
+}
+
+
+
+std::uint64_t
+checksum(const std::vector<std::int64_t> &description)
+{
+  std::uint64_t result = 0;
+  for (const std::int64_t entry : description)
+    result = result * 1000003 + static_cast<std::uint64_t>(entry);
+  return result;
+}
+
+
+
+// refine and coarsen a mesh of hypercubes a few times and return, for every
+// cycle, the description of the mesh
+template <int dim>
+std::vector<std::vector<std::int64_t>>
+refine_mesh()
+{
+  Triangulation<dim> tria(Triangulation<dim>::maximum_smoothing);
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(dim == 2 ? 6 : 4);
+
+  std::vector<std::vector<std::int64_t>> result;
+  for (unsigned int cycle = 0; cycle < 4; ++cycle)
+    {
+      for (const auto &cell : tria.active_cell_iterators())
+        {
+          const Point<dim> center = cell->center();
+          if (center.distance(Point<dim>()) < 0.2 + 0.2 * cycle &&
+              (cell->active_cell_index() % 3 != 0))
+            cell->set_refine_flag();
+          else if (center[0] > 0.5 || cell->active_cell_index() % 7 == 0)
+            cell->set_coarsen_flag();
+        }
+      tria.execute_coarsening_and_refinement();
+
+      types::global_cell_index index = 0;
+      for (const auto &cell : tria.active_cell_iterators())
+        {
+          AssertThrow(cell->active_cell_index() == index, ExcInternalError());
+          AssertThrow(cell->global_active_cell_index() == index,
+                      ExcInternalError());
+          ++index;
+        }
+      AssertThrow(index == tria.n_active_cells(), ExcInternalError());
+
+      for (unsigned int level = 0; level < tria.n_levels(); ++level)
+        {
+          types::global_cell_index level_index = 0;
+          for (const auto &cell : tria.cell_iterators_on_level(level))
+            AssertThrow(cell->global_level_cell_index() == level_index++,
+                        ExcInternalError());
+        }
+
+      result.push_back(describe_mesh(tria));
+    }
+
+  return result;
+}
+
+
+
+// refine a mesh of simplices globally a few times and return, for every
+// cycle, the description of the mesh
+template <int dim>
+std::vector<std::vector<std::int64_t>>
+refine_simplex_mesh()
+{
+  Triangulation<dim> tria;
+  GridGenerator::subdivided_hyper_cube_with_simplices(tria, dim == 2 ? 8 : 3);
+
+  std::vector<std::vector<std::int64_t>> result;
+  for (unsigned int cycle = 0; cycle < (dim == 2 ? 3 : 2); ++cycle)
+    {
+      tria.refine_global(1);
+      result.push_back(describe_mesh(tria));
+    }
+
+  return result;
+}
+
+
+
+template <int dim>
+void
+check(const std::string                                &name,
+      std::vector<std::vector<std::int64_t>> (*refine)())
+{
+  MultithreadInfo::set_thread_limit(1);
+  const auto serial_result = refine();
+
+  MultithreadInfo::set_thread_limit(testing_max_num_threads());
+  const auto parallel_result = refine();
+
+  AssertThrow(serial_result == parallel_result, ExcInternalError());
+
+  for (unsigned int cycle = 0; cycle < serial_result.size(); ++cycle)
+    deallog << name << ' ' << dim << "d, cycle " << cycle << ": "
+            << checksum(serial_result[cycle]) << std::endl;
+
+  deallog << "OK for " << name << ' ' << dim << 'd' << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  check<2>("hypercubes", &refine_mesh<2>);
+  check<3>("hypercubes", &refine_mesh<3>);
+  check<2>("simplices", &refine_simplex_mesh<2>);
+  check<3>("simplices", &refine_simplex_mesh<3>);
+}
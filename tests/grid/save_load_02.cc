@@ -0,0 +1,99 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Test Triangulation::load()/save() for an adaptively refined mesh, and
+// check that files whose triangulation data was written as a text archive
+// (as done by previous versions of save()) can still be loaded.
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <boost/archive/text_oarchive.hpp>
+
+#include "./tests.h"
+
+
+template <int dim>
+void
+compare(const Triangulation<dim> &tria_1, const Triangulation<dim> &tria_2)
+{
+  AssertThrow(tria_1.n_active_cells() == tria_2.n_active_cells(),
+              ExcInternalError());
+  AssertThrow(tria_1.n_vertices() == tria_2.n_vertices(), ExcInternalError());
+
+  for (auto cell_1 = tria_1.begin_active(), cell_2 = tria_2.begin_active();
+       cell_1 != tria_1.end();
+       ++cell_1, ++cell_2)
+    {
+      AssertThrow(cell_1->id() == cell_2->id(), ExcInternalError());
+      AssertThrow(cell_1->material_id() == cell_2->material_id(),
+                  ExcInternalError());
+      for (const unsigned int v : cell_1->vertex_indices())
+        AssertThrow(cell_1->vertex(v) == cell_2->vertex(v),
+                    ExcInternalError());
+    }
+}
+
+
+
+template <int dim>
+void
+test()
+{
+  const std::string filename = "save_load_02_" + std::to_string(dim) + "d_out";
+
+  Triangulation<dim> triangulation;
+  GridGenerator::hyper_cube(triangulation, -1., 1., true);
+  triangulation.refine_global(2);
+  for (const auto &cell : triangulation.active_cell_iterators())
+    if (cell->center()[0] < 0)
+      cell->set_refine_flag();
+  triangulation.execute_coarsening_and_refinement();
+  triangulation.begin_active()->set_material_id(7);
+
+  // binary archive
+  triangulation.save(filename);
+  {
+    Triangulation<dim> loaded;
+    loaded.load(filename);
+    compare(triangulation, loaded);
+    deallog << "binary: " << loaded.n_active_cells() << " cells" << std::endl;
+  }
+
+  // overwrite the triangulation data with a text archive as written by
+  // previous versions of save()
+  {
+    std::ofstream                 ofs(filename + "_triangulation.data");
+    boost::archive::text_oarchive oa(ofs, boost::archive::no_header);
+    triangulation.save(
+      oa, internal::CellAttachedDataSerializer<dim, dim>::version_number);
+  }
+  {
+    Triangulation<dim> loaded;
+    loaded.load(filename);
+    compare(triangulation, loaded);
+    deallog << "text: " << loaded.n_active_cells() << " cells" << std::endl;
+  }
+}
+
+
+int
+main()
+{
+  initlog();
+
+  test<2>();
+  test<3>();
+}
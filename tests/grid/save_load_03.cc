@@ -0,0 +1,105 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Check that Triangulation::load() refuses binary files that have been
+// written with a different format version or on a machine with a different
+// byte order or different sizes of the fundamental types
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include "./tests.h"
+
+
+
+// Replace the second line of the triangulation data, which holds the format
+// version and the platform description, by the given one
+void
+replace_platform_line(const std::string &filename, const std::string &line)
+{
+  std::string magic, platform, archive;
+  {
+    std::ifstream in(filename, std::ios::binary);
+    std::getline(in, magic);
+    std::getline(in, platform);
+    archive.assign(std::istreambuf_iterator<char>(in),
+                   std::istreambuf_iterator<char>());
+  }
+  std::ofstream out(filename, std::ios::binary);
+  out << magic << '\n' << line << '\n' << archive;
+}
+
+
+
+void
+try_load(const std::string &filename)
+{
+  Triangulation<2> loaded;
+  try
+    {
+      loaded.load(filename);
+      deallog << "loaded " << loaded.n_active_cells() << " cells"
+              << std::endl;
+    }
+  catch (const ExceptionBase &)
+    {
+      deallog << "load() threw an exception" << std::endl;
+    }
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  const std::string filename = "save_load_03_out";
+
+  Triangulation<2> triangulation;
+  GridGenerator::hyper_cube(triangulation);
+  triangulation.refine_global(2);
+
+  triangulation.save(filename);
+  try_load(filename);
+
+  std::string platform;
+  {
+    std::ifstream in(filename + "_triangulation.data", std::ios::binary);
+    std::getline(in, platform);
+    std::getline(in, platform);
+  }
+
+  // a format version from the future
+  replace_platform_line(filename + "_triangulation.data",
+                        "999" + platform.substr(platform.find(' ')));
+  try_load(filename);
+
+  // a machine with the opposite byte order
+  std::string other_platform = platform;
+  if (other_platform.find("little-endian") != std::string::npos)
+    other_platform.replace(other_platform.find("little-endian"),
+                           13,
+                           "big-endian");
+  else
+    other_platform.replace(other_platform.find("big-endian"),
+                           10,
+                           "little-endian");
+  replace_platform_line(filename + "_triangulation.data", other_platform);
+  try_load(filename);
+
+  // the original line again
+  replace_platform_line(filename + "_triangulation.data", platform);
+  try_load(filename);
+}
@@ -0,0 +1,109 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Check that the memory for user indices and user pointers is only allocated
+// once user data is set, and released again by clear_user_data()
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/grid/tria_accessor.h>
+#include <deal.II/grid/tria_iterator.h>
+
+#include "../tests.h"
+
+
+
+template <int dim>
+void
+test()
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(3);
+
+  const std::size_t memory_without_user_data = tria.memory_consumption();
+
+  // reading user data that has never been set gives zero
+  for (const auto &cell : tria.cell_iterators())
+    AssertThrow(cell->user_index() == 0, ExcInternalError());
+  AssertThrow(tria.memory_consumption() == memory_without_user_data,
+              ExcInternalError());
+
+  // clearing user data that has never been set does not allocate memory
+  for (const auto &cell : tria.cell_iterators())
+    {
+      cell->clear_user_index();
+      cell->clear_user_pointer();
+    }
+  AssertThrow(tria.memory_consumption() == memory_without_user_data,
+              ExcInternalError());
+
+  // set the user index on one cell, which allocates the user data for all
+  // cells
+  tria.begin_active()->set_user_index(42);
+  AssertThrow(tria.memory_consumption() - memory_without_user_data ==
+                sizeof(void *) * tria.n_raw_cells(tria.n_levels() - 1),
+              ExcInternalError());
+  deallog << "User indices on cells allocated" << std::endl;
+
+  // refining the mesh keeps the user data of existing cells and gives zero
+  // user indices to new cells
+  tria.begin_active()->set_refine_flag();
+  const typename Triangulation<dim>::cell_iterator first_cell =
+    tria.begin_active();
+  tria.execute_coarsening_and_refinement();
+  AssertThrow(first_cell->user_index() == 42, ExcInternalError());
+  for (unsigned int c = 0; c < first_cell->n_children(); ++c)
+    AssertThrow(first_cell->child(c)->user_index() == 0, ExcInternalError());
+
+  // user data on faces is only allocated for faces
+  if (dim > 1)
+    {
+      const std::size_t memory_before = tria.memory_consumption();
+      tria.begin_active()->face(0)->set_user_pointer(&tria);
+      AssertThrow(tria.begin_active()->face(0)->user_pointer() == &tria,
+                  ExcInternalError());
+      AssertThrow(tria.begin_active()->face(1)->user_pointer() == nullptr,
+                  ExcInternalError());
+      AssertThrow(tria.memory_consumption() - memory_before ==
+                    sizeof(void *) * tria.n_raw_faces(),
+                  ExcInternalError());
+      deallog << "User pointers on faces allocated" << std::endl;
+    }
+
+  tria.clear_user_data();
+  tria.refine_global(1);
+  tria.clear_user_data();
+
+  const std::size_t memory_after_clear = tria.memory_consumption();
+  tria.begin_active()->set_user_index(1);
+  tria.clear_user_data();
+  AssertThrow(tria.memory_consumption() == memory_after_clear,
+              ExcInternalError());
+
+  deallog << "OK for " << dim << 'd' << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<1>();
+  test<2>();
+  test<3>();
+}
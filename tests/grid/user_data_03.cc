@@ -0,0 +1,84 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Check that user indices and user pointers can be set concurrently on
+// different objects of a triangulation whose user data has not been
+// allocated yet
+
+#include <deal.II/base/parallel.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/grid/tria_accessor.h>
+#include <deal.II/grid/tria_iterator.h>
+
+#include "../tests.h"
+
+
+
+template <int dim>
+void
+test()
+{
+  Triangulation<dim> tria;
+  GridGenerator::subdivided_hyper_cube(tria, 4);
+  tria.refine_global(2);
+
+  std::vector<typename Triangulation<dim>::active_cell_iterator> cells;
+  for (const auto &cell : tria.active_cell_iterators())
+    cells.push_back(cell);
+
+  for (unsigned int round = 0; round < 3; ++round)
+    {
+      parallel::apply_to_subranges(
+        0U,
+        static_cast<unsigned int>(cells.size()),
+        [&](const unsigned int begin, const unsigned int end) {
+          for (unsigned int i = begin; i < end; ++i)
+            {
+              cells[i]->set_user_index(i + 1);
+              if (dim > 1)
+                cells[i]->face(0)->set_user_pointer(&tria);
+            }
+        },
+        1);
+
+      for (unsigned int i = 0; i < cells.size(); ++i)
+        {
+          AssertThrow(cells[i]->user_index() == i + 1, ExcInternalError());
+          if (dim > 1)
+            AssertThrow(cells[i]->face(0)->user_pointer() == &tria,
+                        ExcInternalError());
+        }
+
+      tria.clear_user_data();
+      for (const auto &cell : cells)
+        AssertThrow(cell->user_index() == 0, ExcInternalError());
+    }
+
+  deallog << "OK for " << dim << 'd' << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+  MultithreadInfo::set_thread_limit(4);
+
+  test<1>();
+  test<2>();
+  test<3>();
+}
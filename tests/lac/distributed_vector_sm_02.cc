@@ -0,0 +1,133 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Test update_ghost_values() and compress() of
+// LinearAlgebra::distributed::Vector if the data exchange within a
+// shared-memory domain is performed via the shared-memory segment. Two groups
+// of two processes each act as shared-memory domains, such that both the
+// shared-memory and the remote data exchange are exercised.
+
+#include <deal.II/base/mpi.h>
+
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include "../tests.h"
+
+
+
+template <typename Number>
+void
+test(const MPI_Comm comm_sm)
+{
+  const unsigned int my_rank = Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+  const unsigned int n_procs = Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD);
+
+  IndexSet is_local(10 * n_procs);
+  is_local.add_range(10 * my_rank, 10 * (my_rank + 1));
+
+  IndexSet is_ghost(10 * n_procs);
+  is_ghost.add_range(10 * ((my_rank + 1) % n_procs),
+                     10 * ((my_rank + 1) % n_procs) + 3);
+  is_ghost.add_range(10 * ((my_rank + n_procs - 1) % n_procs) + 7,
+                     10 * ((my_rank + n_procs - 1) % n_procs) + 10);
+  is_ghost.add_index(10 * ((my_rank + 2) % n_procs) + 5);
+
+  const auto partitioner =
+    std::make_shared<Utilities::MPI::Partitioner>(is_local,
+                                                  is_ghost,
+                                                  MPI_COMM_WORLD);
+
+  LinearAlgebra::distributed::Vector<Number> vector, reference;
+  vector.reinit(partitioner, comm_sm);
+  reference.reinit(partitioner);
+
+  // update_ghost_values()
+  for (const auto i : is_local)
+    {
+      vector(i)    = i;
+      reference(i) = i;
+    }
+
+  vector.update_ghost_values();
+  reference.update_ghost_values();
+
+  for (const auto i : is_ghost)
+    {
+      deallog << vector(i) << ' ';
+      AssertThrow(vector(i) == reference(i), ExcInternalError());
+    }
+  deallog << std::endl;
+
+  // compress(VectorOperation::add)
+  vector.zero_out_ghost_values();
+  reference.zero_out_ghost_values();
+  for (unsigned int i = 0; i < partitioner->locally_owned_size() +
+                                 partitioner->n_ghost_indices();
+       ++i)
+    {
+      vector.local_element(i) += 1.;
+      reference.local_element(i) += 1.;
+    }
+
+  vector.compress(VectorOperation::add);
+  reference.compress(VectorOperation::add);
+
+  for (const auto i : is_local)
+    {
+      deallog << vector(i) << ' ';
+      AssertThrow(vector(i) == reference(i), ExcInternalError());
+    }
+  deallog << std::endl;
+
+  for (unsigned int i = 0; i < partitioner->n_ghost_indices(); ++i)
+    AssertThrow(vector.local_element(partitioner->locally_owned_size() + i) ==
+                  Number(),
+                ExcInternalError());
+
+  // a vector initialized from the first one uses the same data exchange
+  LinearAlgebra::distributed::Vector<Number> copy;
+  copy.reinit(vector);
+  copy = vector;
+  copy.update_ghost_values();
+  reference.update_ghost_values();
+  for (const auto i : is_ghost)
+    {
+      deallog << copy(i) << ' ';
+      AssertThrow(copy(i) == reference(i), ExcInternalError());
+    }
+  deallog << std::endl;
+
+  deallog << "OK" << std::endl;
+}
+
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+  MPILogInitAll                    all;
+
+  AssertDimension(Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD), 4);
+
+  const unsigned int my_rank = Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+
+  MPI_Comm comm_sm;
+  MPI_Comm_split(MPI_COMM_WORLD, my_rank / 2, my_rank, &comm_sm);
+
+  test<double>(comm_sm);
+  test<float>(comm_sm);
+
+  MPI_Comm_free(&comm_sm);
+}
@@ -0,0 +1,97 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Test that LinearAlgebra::distributed::Vector sets up its shared-memory
+// data exchange again if reinit() is called with the same partitioner but a
+// different shared-memory communicator
+
+#include <deal.II/base/mpi.h>
+
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include "../tests.h"
+
+
+
+void
+check_ghost_values(LinearAlgebra::distributed::Vector<double> &vector)
+{
+  const auto &partitioner = *vector.get_partitioner();
+
+  for (const auto i : partitioner.locally_owned_range())
+    vector(i) = i;
+  vector.update_ghost_values();
+
+  for (const auto i : partitioner.ghost_indices())
+    AssertThrow(vector(i) == i, ExcInternalError());
+
+  vector.zero_out_ghost_values();
+}
+
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+  MPILogInitAll                    all;
+
+  AssertDimension(Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD), 4);
+
+  const unsigned int my_rank = Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+  const unsigned int n_procs = Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD);
+
+  // two different groupings of the processes into shared-memory domains
+  MPI_Comm comm_sm_a, comm_sm_b;
+  MPI_Comm_split(MPI_COMM_WORLD, my_rank / 2, my_rank, &comm_sm_a);
+  MPI_Comm_split(MPI_COMM_WORLD, my_rank % 2, my_rank, &comm_sm_b);
+
+  IndexSet is_local(10 * n_procs);
+  is_local.add_range(10 * my_rank, 10 * (my_rank + 1));
+
+  IndexSet is_ghost(10 * n_procs);
+  for (unsigned int p = 0; p < n_procs; ++p)
+    if (p != my_rank)
+      is_ghost.add_range(10 * p + 2, 10 * p + 5);
+
+  const auto partitioner =
+    std::make_shared<Utilities::MPI::Partitioner>(is_local,
+                                                  is_ghost,
+                                                  MPI_COMM_WORLD);
+
+  LinearAlgebra::distributed::Vector<double> vector;
+  vector.reinit(partitioner, comm_sm_a);
+  check_ghost_values(vector);
+  deallog << "First shared-memory communicator: OK" << std::endl;
+
+  vector.reinit(partitioner, comm_sm_b);
+  check_ghost_values(vector);
+  deallog << "Second shared-memory communicator: OK" << std::endl;
+
+  vector.reinit(partitioner);
+  check_ghost_values(vector);
+  deallog << "Without shared-memory communicator: OK" << std::endl;
+
+  // reinit() from another vector with the same partitioner but a different
+  // shared-memory communicator
+  LinearAlgebra::distributed::Vector<double> other;
+  other.reinit(partitioner, comm_sm_a);
+  vector.reinit(partitioner, comm_sm_b);
+  vector.reinit(other);
+  check_ghost_values(vector);
+  deallog << "Reinit from vector: OK" << std::endl;
+
+  MPI_Comm_free(&comm_sm_b);
+  MPI_Comm_free(&comm_sm_a);
+}
@@ -0,0 +1,143 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Test that the chart points cached by TransfiniteInterpolationManifold give
+// the same new points as the ones computed by pulling back the surrounding
+// points from scratch, also when the cache is so small that it is emptied
+// repeatedly
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/manifold_lib.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/grid/tria_accessor.h>
+#include <deal.II/grid/tria_iterator.h>
+
+#include "../tests.h"
+
+
+
+// create a ball whose interior is described by a transfinite interpolation
+// manifold that caches at most the given number of chart points
+template <int dim>
+void
+create_mesh(Triangulation<dim> &tria, const unsigned int max_cached_points)
+{
+  GridGenerator::hyper_ball(tria);
+  tria.set_all_manifold_ids(1);
+  tria.set_all_manifold_ids_on_boundary(0);
+  tria.set_manifold(0, SphericalManifold<dim>());
+
+  TransfiniteInterpolationManifold<dim> transfinite(max_cached_points);
+  transfinite.initialize(tria);
+  tria.set_manifold(1, transfinite);
+}
+
+
+
+template <int dim>
+void
+do_test()
+{
+  // the manifold of tria is used for all points in the order they are
+  // created, whereas the manifold of tria_fresh does not cache any points
+  // and the one of tria_small only a few. A manifold only computes points
+  // on the cells it is attached to, so each of them needs its own mesh.
+  Triangulation<dim> tria, tria_fresh, tria_small;
+  create_mesh(tria, 1U << 16);
+  create_mesh(tria_fresh, 0);
+  create_mesh(tria_small, 20);
+
+  const auto &manifold =
+    dynamic_cast<const TransfiniteInterpolationManifold<dim> &>(
+      tria.get_manifold(1));
+  const auto &manifold_fresh =
+    dynamic_cast<const TransfiniteInterpolationManifold<dim> &>(
+      tria_fresh.get_manifold(1));
+  const auto &manifold_small =
+    dynamic_cast<const TransfiniteInterpolationManifold<dim> &>(
+      tria_small.get_manifold(1));
+
+  for (const auto &cell : tria.active_cell_iterators())
+    {
+      std::vector<Point<dim>> points;
+      for (const unsigned int v : cell->vertex_indices())
+        points.push_back(cell->vertex(v));
+      for (const unsigned int l : cell->line_indices())
+        {
+          const std::array<Point<dim>, 2> vertices = {
+            {cell->line(l)->vertex(0), cell->line(l)->vertex(1)}};
+          const std::array<double, 2> weights = {{0.5, 0.5}};
+          points.push_back(manifold.get_new_point(make_array_view(vertices),
+                                                  make_array_view(weights)));
+        }
+      if (dim == 3)
+        for (const unsigned int f : cell->face_indices())
+          {
+            std::vector<Point<dim>> face_points;
+            for (const unsigned int v : cell->face(f)->vertex_indices())
+              face_points.push_back(cell->face(f)->vertex(v));
+            for (unsigned int l = 0; l < 4; ++l)
+              face_points.push_back(
+                points[cell->n_vertices() +
+                       GeometryInfo<dim>::face_to_cell_lines(f, l)]);
+            const std::vector<double> weights(face_points.size(),
+                                              1. / face_points.size());
+            points.push_back(
+              manifold.get_new_point(make_array_view(face_points),
+                                     make_array_view(weights)));
+          }
+
+      const std::vector<double> weights(points.size(), 1. / points.size());
+      const Point<dim>          p_cached =
+        manifold.get_new_point(make_array_view(points),
+                               make_array_view(weights));
+      const Point<dim> p_fresh =
+        manifold_fresh.get_new_point(make_array_view(points),
+                                     make_array_view(weights));
+      AssertThrow(p_cached.distance(p_fresh) < 1e-9 * cell->diameter(),
+                  ExcInternalError());
+      const Point<dim> p_small =
+        manifold_small.get_new_point(make_array_view(points),
+                                     make_array_view(weights));
+      AssertThrow(p_small.distance(p_fresh) < 1e-9 * cell->diameter(),
+                  ExcInternalError());
+
+      // a second query is answered entirely from the cache
+      AssertThrow(manifold.get_new_point(make_array_view(points),
+                                         make_array_view(weights)) == p_cached,
+                  ExcInternalError());
+    }
+
+  // refining the mesh gives the same vertices with and without the cache
+  tria.refine_global(2);
+  tria_fresh.refine_global(2);
+  AssertThrow(tria.n_vertices() == tria_fresh.n_vertices(), ExcInternalError());
+  for (unsigned int v = 0; v < tria.n_vertices(); ++v)
+    AssertThrow(tria.get_vertices()[v].distance(tria_fresh.get_vertices()[v]) <
+                  1e-9,
+                ExcInternalError());
+  deallog << "OK for dim=" << dim << " with " << tria.n_active_cells()
+          << " cells after refinement" << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  do_test<2>();
+  do_test<3>();
+}
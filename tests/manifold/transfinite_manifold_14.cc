@@ -0,0 +1,72 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Test that the mesh obtained by refining twice with a
+// TransfiniteInterpolationManifold does not depend on the state of its cache
+// of chart points: a mesh refined with all chart points of the first
+// refinement kept in the cache must have bitwise the same vertices as a mesh
+// refined with a cache that holds a single point per coarse cell and is
+// thus emptied all the time.
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/manifold_lib.h>
+#include <deal.II/grid/tria.h>
+
+#include "../tests.h"
+
+
+
+template <int dim>
+void
+do_test()
+{
+  Triangulation<dim> tria_kept, tria_emptied;
+  GridGenerator::hyper_ball(tria_kept);
+  GridGenerator::hyper_ball(tria_emptied);
+
+  TransfiniteInterpolationManifold<dim> manifold_kept;
+  TransfiniteInterpolationManifold<dim> manifold_emptied(
+    tria_emptied.n_cells());
+  for (auto [tria, manifold] : {std::make_pair(&tria_kept, &manifold_kept),
+                                std::make_pair(&tria_emptied,
+                                               &manifold_emptied)})
+    {
+      tria->set_all_manifold_ids(1);
+      tria->set_all_manifold_ids_on_boundary(0);
+      tria->set_manifold(0, SphericalManifold<dim>());
+      manifold->initialize(*tria);
+      tria->set_manifold(1, *manifold);
+      tria->refine_global(2);
+    }
+
+  AssertThrow(tria_kept.n_vertices() == tria_emptied.n_vertices(),
+              ExcInternalError());
+  for (unsigned int v = 0; v < tria_kept.n_vertices(); ++v)
+    AssertThrow(tria_kept.get_vertices()[v] == tria_emptied.get_vertices()[v],
+                ExcInternalError());
+
+  deallog << "OK for dim=" << dim << " with " << tria_kept.n_active_cells()
+          << " cells after refinement" << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  do_test<2>();
+  do_test<3>();
+}
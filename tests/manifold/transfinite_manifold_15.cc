@@ -0,0 +1,108 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// Test that TransfiniteInterpolationManifold does not use chart points
+// cached before a vertex of the coarse mesh was moved: the new points
+// computed after moving the vertex must be the same as the ones computed by
+// a manifold without a cache.
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/manifold_lib.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/grid/tria_accessor.h>
+#include <deal.II/grid/tria_iterator.h>
+
+#include "../tests.h"
+
+
+
+// return the centers of all active cells as computed by the manifold with
+// id 1
+template <int dim>
+std::vector<Point<dim>>
+compute_centers(const Triangulation<dim> &tria)
+{
+  std::vector<Point<dim>> centers;
+  for (const auto &cell : tria.active_cell_iterators())
+    {
+      std::vector<Point<dim>> vertices;
+      for (const unsigned int v : cell->vertex_indices())
+        vertices.push_back(cell->vertex(v));
+      const std::vector<double> weights(vertices.size(),
+                                        1. / vertices.size());
+      centers.push_back(
+        tria.get_manifold(1).get_new_point(make_array_view(vertices),
+                                           make_array_view(weights)));
+    }
+  return centers;
+}
+
+
+
+template <int dim>
+void
+do_test()
+{
+  Triangulation<dim> tria_cached, tria_fresh;
+  GridGenerator::hyper_ball(tria_cached);
+  GridGenerator::hyper_ball(tria_fresh);
+
+  TransfiniteInterpolationManifold<dim> manifold_cached;
+  TransfiniteInterpolationManifold<dim> manifold_fresh(0);
+  for (auto [tria, manifold] : {std::make_pair(&tria_cached, &manifold_cached),
+                                std::make_pair(&tria_fresh, &manifold_fresh)})
+    {
+      tria->set_all_manifold_ids(1);
+      tria->set_all_manifold_ids_on_boundary(0);
+      tria->set_manifold(0, SphericalManifold<dim>());
+      manifold->initialize(*tria);
+      tria->set_manifold(1, *manifold);
+      tria->refine_global(1);
+    }
+
+  // fill the cache with the chart points of the vertices of the active cells
+  compute_centers(tria_cached);
+
+  // move the first vertex of the coarse mesh that is in the interior of the
+  // ball a little, without telling the triangulation about it, such that the
+  // other vertices are still inside the coarse cells they were in before
+  for (Triangulation<dim> *tria : {&tria_cached, &tria_fresh})
+    for (const unsigned int v : tria->begin(0)->vertex_indices())
+      if (tria->begin(0)->vertex(v).norm() < 0.9)
+        {
+          tria->begin(0)->vertex(v) *= 0.9999;
+          break;
+        }
+
+  const std::vector<Point<dim>> centers_cached = compute_centers(tria_cached);
+  const std::vector<Point<dim>> centers_fresh  = compute_centers(tria_fresh);
+  for (unsigned int i = 0; i < centers_cached.size(); ++i)
+    AssertThrow(centers_cached[i].distance(centers_fresh[i]) < 1e-9,
+                ExcInternalError());
+
+  deallog << "OK for dim=" << dim << " with " << centers_cached.size()
+          << " cells" << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  do_test<2>();
+  do_test<3>();
+}
@@ -0,0 +1,117 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Check that MappingQ(1) computes the same quadrature points, Jacobians,
+// inverse Jacobians, JxW values and shape function gradients as MappingQ(2)
+// on meshes whose cells are affine images of the reference cell, for which
+// MappingQ(1) uses a shortcut, and on meshes with general cells.
+
+#include <deal.II/base/quadrature_lib.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_values.h>
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/tria.h>
+
+#include "../tests.h"
+
+
+
+template <int dim>
+void
+compare(const Triangulation<dim> &tria)
+{
+  const FE_Q<dim>     fe(2);
+  const QGauss<dim>   quadrature(3);
+  const MappingQ<dim> mapping_1(1);
+  const MappingQ<dim> mapping_2(2);
+  const UpdateFlags   flags = update_values | update_gradients |
+                            update_quadrature_points | update_jacobians |
+                            update_inverse_jacobians | update_JxW_values;
+  FEValues<dim> fe_values_1(mapping_1, fe, quadrature, flags);
+  FEValues<dim> fe_values_2(mapping_2, fe, quadrature, flags);
+
+  for (const auto &cell : tria.active_cell_iterators())
+    {
+      fe_values_1.reinit(cell);
+      fe_values_2.reinit(cell);
+
+      const double h = cell->diameter();
+      for (const unsigned int q : fe_values_1.quadrature_point_indices())
+        {
+          AssertThrow(fe_values_1.quadrature_point(q).distance(
+                        fe_values_2.quadrature_point(q)) < 1e-12 * h,
+                      ExcInternalError());
+          AssertThrow((Tensor<2, dim>(fe_values_1.jacobian(q)) -
+                       Tensor<2, dim>(fe_values_2.jacobian(q)))
+                          .norm() < 1e-12 * h,
+                      ExcInternalError());
+          AssertThrow((Tensor<2, dim>(fe_values_1.inverse_jacobian(q)) -
+                       Tensor<2, dim>(fe_values_2.inverse_jacobian(q)))
+                          .norm() < 1e-12 / h,
+                      ExcInternalError());
+          AssertThrow(std::abs(fe_values_1.JxW(q) - fe_values_2.JxW(q)) <
+                        1e-12 * std::pow(h, dim),
+                      ExcInternalError());
+          for (const unsigned int i : fe_values_1.dof_indices())
+            AssertThrow((fe_values_1.shape_grad(i, q) -
+                         fe_values_2.shape_grad(i, q))
+                            .norm() < 1e-10 / h,
+                        ExcInternalError());
+        }
+    }
+}
+
+
+
+template <int dim>
+void
+test()
+{
+  Triangulation<dim> tria;
+  GridGenerator::subdivided_hyper_cube(tria, 3);
+
+  // an affine map of the mesh keeps all cells affine images of the
+  // reference cell
+  GridTools::transform(
+    [](const Point<dim> &p) {
+      Point<dim> q = p;
+      q[0] += 0.5 * p[dim - 1];
+      q[dim - 1] *= 2.;
+      return q;
+    },
+    tria);
+  compare(tria);
+
+  // distorting the mesh creates general cells
+  GridTools::distort_random(0.2, tria, false, 1);
+  compare(tria);
+
+  deallog << "OK for " << dim << 'd' << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<1>();
+  test<2>();
+  test<3>();
+}
@@ -0,0 +1,120 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Test MappingQCache::initialize_on_demand() by comparison with MappingQ,
+// evaluating the mapping on several threads, after refinement of the mesh,
+// and through a copy of the mapping
+
+#include <deal.II/base/parallel.h>
+#include <deal.II/base/quadrature_lib.h>
+
+#include <deal.II/fe/fe_nothing.h>
+#include <deal.II/fe/fe_values.h>
+#include <deal.II/fe/mapping_q.h>
+#include <deal.II/fe/mapping_q_cache.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include "../tests.h"
+
+
+
+template <int dim>
+void
+compare(const Mapping<dim>       &mapping,
+        const Mapping<dim>       &mapping_cache,
+        const Triangulation<dim> &tria)
+{
+  std::vector<typename Triangulation<dim>::active_cell_iterator> cells;
+  for (const auto &cell : tria.active_cell_iterators())
+    cells.push_back(cell);
+
+  const FE_Nothing<dim> fe;
+  const QGauss<dim>     quadrature(3);
+
+  parallel::apply_to_subranges(
+    0U,
+    static_cast<unsigned int>(cells.size()),
+    [&](const unsigned int begin, const unsigned int end) {
+      FEValues<dim> fe_values(mapping,
+                              fe,
+                              quadrature,
+                              update_quadrature_points | update_JxW_values);
+      FEValues<dim> fe_values_cache(mapping_cache,
+                                    fe,
+                                    quadrature,
+                                    update_quadrature_points |
+                                      update_JxW_values);
+      for (unsigned int c = begin; c < end; ++c)
+        {
+          fe_values.reinit(cells[c]);
+          fe_values_cache.reinit(cells[c]);
+          for (const unsigned int q : fe_values.quadrature_point_indices())
+            {
+              AssertThrow((fe_values.quadrature_point(q) -
+                           fe_values_cache.quadrature_point(q))
+                              .norm() < 1e-12,
+                          ExcInternalError());
+              AssertThrow(std::abs(fe_values.JxW(q) - fe_values_cache.JxW(q)) <
+                            1e-12,
+                          ExcInternalError());
+            }
+        }
+    },
+    4);
+}
+
+
+
+template <int dim>
+void
+do_test(const unsigned int degree, const unsigned int degree_cache)
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_ball(tria);
+
+  MappingQ<dim>      mapping(degree);
+  MappingQCache<dim> mapping_cache(degree_cache);
+  mapping_cache.initialize_on_demand(mapping, tria);
+
+  compare(mapping, mapping_cache, tria);
+
+  // the cache gets cleared and re-filled without calling
+  // initialize_on_demand() again
+  tria.refine_global(1);
+  compare(mapping, mapping_cache, tria);
+
+  // copies share the cache with the original object
+  const auto mapping_clone = mapping_cache.clone();
+  tria.refine_global(1);
+  compare(mapping, *mapping_clone, tria);
+
+  deallog << "OK for degree " << degree << " with cache of degree "
+          << degree_cache << " in " << dim << 'D' << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+  MultithreadInfo::set_thread_limit(4);
+
+  do_test<2>(3, 3);
+  do_test<2>(2, 4);
+  do_test<3>(2, 2);
+  do_test<3>(2, 3);
+}
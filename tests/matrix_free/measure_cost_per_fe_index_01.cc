@@ -0,0 +1,131 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Test MatrixFreeTools::measure_cost_per_fe_index() for an hp-adaptive
+// MatrixFree object and feed the result into
+// parallel::CellWeights::fe_index_weighting()
+
+#include <deal.II/distributed/cell_weights.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/mapping_q1.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/hp/fe_collection.h>
+#include <deal.II/hp/q_collection.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+#include <deal.II/matrix_free/tools.h>
+
+#include "../tests.h"
+
+
+
+template <int dim>
+void
+test()
+{
+  using VectorType = LinearAlgebra::distributed::Vector<double>;
+
+  Triangulation<dim> tria;
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(3);
+
+  hp::FECollection<dim> fe_collection;
+  hp::QCollection<1>    quadrature_collection;
+  for (const unsigned int degree : {1, 2, 4})
+    {
+      fe_collection.push_back(FE_Q<dim>(degree));
+      quadrature_collection.push_back(QGauss<1>(degree + 1));
+    }
+
+  DoFHandler<dim> dof_handler(tria);
+  for (const auto &cell : dof_handler.active_cell_iterators())
+    cell->set_active_fe_index(cell->active_cell_index() % 3);
+  dof_handler.distribute_dofs(fe_collection);
+
+  AffineConstraints<double> constraints;
+  DoFTools::make_hanging_node_constraints(dof_handler, constraints);
+  constraints.close();
+
+  MatrixFree<dim, double> matrix_free;
+  matrix_free.reinit(MappingQ1<dim>(),
+                     dof_handler,
+                     constraints,
+                     quadrature_collection,
+                     typename MatrixFree<dim, double>::AdditionalData());
+
+  VectorType src, dst;
+  matrix_free.initialize_dof_vector(src);
+  matrix_free.initialize_dof_vector(dst);
+  src = 1.;
+
+  const std::vector<double> costs = MatrixFreeTools::measure_cost_per_fe_index(
+    matrix_free,
+    [](const MatrixFree<dim, double>               &matrix_free,
+       VectorType                                  &dst,
+       const VectorType                            &src,
+       const std::pair<unsigned int, unsigned int> &range) {
+      FEEvaluation<dim, -1> phi(matrix_free, range);
+      for (unsigned int cell = range.first; cell < range.second; ++cell)
+        {
+          phi.reinit(cell);
+          phi.gather_evaluate(src, EvaluationFlags::gradients);
+          for (const unsigned int q : phi.quadrature_point_indices())
+            phi.submit_gradient(phi.get_gradient(q), q);
+          phi.integrate_scatter(EvaluationFlags::gradients, dst);
+        }
+    },
+    dst,
+    src);
+
+  deallog << "Number of measured FE indices: " << costs.size() << std::endl;
+  for (const double cost : costs)
+    AssertThrow(cost > 0., ExcInternalError());
+
+  std::vector<float> weights;
+  for (const double cost : costs)
+    weights.push_back(100. * cost / costs[0]);
+
+  const auto weighting_function =
+    parallel::CellWeights<dim>::fe_index_weighting(weights);
+  for (const auto &cell : dof_handler.active_cell_iterators())
+    AssertThrow(weighting_function(cell, cell->get_fe()) ==
+                  static_cast<unsigned int>(
+                    std::trunc(weights[cell->active_fe_index()])),
+                ExcInternalError());
+
+  deallog << "OK" << std::endl;
+}
+
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+  initlog();
+
+  test<2>();
+  test<3>();
+}
@@ -0,0 +1,159 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// test the export_to_ghosted_array and import_from_ghosted_array functions of
+// the Partitioner with persistent MPI requests, repeatedly restarting the same
+// requests, and compare against the results of the non-persistent functions,
+// including the case of a ghost array for a larger ghost index set
+
+#include <deal.II/base/index_set.h>
+#include <deal.II/base/partitioner.h>
+#include <deal.II/base/utilities.h>
+
+#include <vector>
+
+#include "../tests.h"
+
+
+void
+check(const Utilities::MPI::Partitioner &part,
+      const unsigned int                 n_ghost_entries,
+      const unsigned int                 myid)
+{
+  std::vector<double>      locally_owned(part.locally_owned_size());
+  std::vector<double>      ghosts(n_ghost_entries), ghosts_ref(n_ghost_entries);
+  std::vector<double>      temp(part.n_import_indices());
+  std::vector<double>      temp_ref(part.n_import_indices());
+  std::vector<MPI_Request> requests, requests_ref;
+
+  part.export_to_ghosted_array_init_persistent(1,
+                                               make_array_view(temp),
+                                               make_array_view(ghosts),
+                                               requests);
+
+  for (unsigned int cycle = 0; cycle < 3; ++cycle)
+    {
+      for (unsigned int i = 0; i < locally_owned.size(); ++i)
+        locally_owned[i] = part.local_to_global(i) + 100 * cycle;
+
+      part.export_to_ghosted_array_start_persistent(
+        make_array_view(std::as_const(locally_owned)),
+        make_array_view(temp),
+        requests);
+      part.export_to_ghosted_array_finish_persistent(make_array_view(ghosts),
+                                                     requests);
+
+      part.export_to_ghosted_array_start(
+        0,
+        make_array_view(std::as_const(locally_owned)),
+        make_array_view(temp_ref),
+        make_array_view(ghosts_ref),
+        requests_ref);
+      part.export_to_ghosted_array_finish(make_array_view(ghosts_ref),
+                                          requests_ref);
+
+      AssertThrow(ghosts == ghosts_ref, ExcInternalError());
+    }
+  for (auto &request : requests)
+    MPI_Request_free(&request);
+  requests.clear();
+  deallog << "export OK" << std::endl;
+
+  std::vector<double> locally_owned_ref(locally_owned.size());
+  part.import_from_ghosted_array_init_persistent(2,
+                                                 make_array_view(ghosts),
+                                                 make_array_view(temp),
+                                                 requests);
+
+  for (unsigned int cycle = 0; cycle < 3; ++cycle)
+    {
+      for (unsigned int i = 0; i < ghosts.size(); ++i)
+        ghosts_ref[i] = ghosts[i] = 1 + i + cycle + myid;
+
+      part.import_from_ghosted_array_start_persistent(VectorOperation::add,
+                                                      make_array_view(ghosts),
+                                                      requests);
+      part.import_from_ghosted_array_finish_persistent(
+        VectorOperation::add,
+        make_array_view(std::as_const(temp)),
+        make_array_view(locally_owned),
+        make_array_view(ghosts),
+        requests);
+
+      part.import_from_ghosted_array_start(VectorOperation::add,
+                                           0,
+                                           make_array_view(ghosts_ref),
+                                           make_array_view(temp_ref),
+                                           requests_ref);
+      part.import_from_ghosted_array_finish(
+        VectorOperation::add,
+        make_array_view(std::as_const(temp_ref)),
+        make_array_view(locally_owned_ref),
+        make_array_view(ghosts_ref),
+        requests_ref);
+
+      AssertThrow(locally_owned == locally_owned_ref, ExcInternalError());
+      for (unsigned int i = 0; i < part.n_ghost_indices(); ++i)
+        AssertThrow(ghosts[i] == 0., ExcInternalError());
+    }
+  for (auto &request : requests)
+    MPI_Request_free(&request);
+  deallog << "import OK" << std::endl;
+}
+
+
+
+void
+test()
+{
+  const unsigned int myid    = Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+  const unsigned int numproc = Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD);
+
+  const unsigned int local_size  = 10;
+  const unsigned int global_size = local_size * numproc;
+
+  IndexSet local_owned(global_size);
+  local_owned.add_range(myid * local_size, (myid + 1) * local_size);
+
+  // ghost all entries of the two neighbors as a larger index set, and only
+  // some of them in the tight index set
+  IndexSet ghosts_large(global_size), ghosts_tight(global_size);
+  for (const unsigned int p :
+       {(myid + 1) % numproc, (myid + numproc - 1) % numproc})
+    if (p != myid)
+      {
+        ghosts_large.add_range(p * local_size, (p + 1) * local_size);
+        ghosts_tight.add_index(p * local_size + 1);
+        ghosts_tight.add_index(p * local_size + 7);
+      }
+
+  Utilities::MPI::Partitioner large(local_owned, ghosts_large, MPI_COMM_WORLD);
+  check(large, large.n_ghost_indices(), myid);
+
+  Utilities::MPI::Partitioner tight(local_owned, MPI_COMM_WORLD);
+  tight.set_ghost_indices(ghosts_tight, large.ghost_indices());
+  check(tight, tight.n_ghost_indices(), myid);
+  check(tight, large.n_ghost_indices(), myid);
+}
+
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+  MPILogInitAll                    log;
+  test();
+}
@@ -0,0 +1,168 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// test the data exchange of the Partitioner with neighborhood collectives
+// against the point-to-point exchange, with one process that neither has
+// ghost nor import indices, and check create_reordered_communicator()
+
+#include <deal.II/base/index_set.h>
+#include <deal.II/base/partitioner.h>
+#include <deal.II/base/utilities.h>
+
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <vector>
+
+#include "../tests.h"
+
+
+void
+test()
+{
+  const unsigned int myid    = Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+  const unsigned int numproc = Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD);
+
+  const unsigned int local_size  = 10;
+  const unsigned int global_size = local_size * numproc;
+
+  IndexSet local_owned(global_size);
+  local_owned.add_range(myid * local_size, (myid + 1) * local_size);
+
+  // the last process is not connected to any other process, the others
+  // ghost some entries of all other processes except the last one
+  IndexSet ghosts(global_size);
+  if (myid < numproc - 1)
+    for (unsigned int p = 0; p < numproc - 1; ++p)
+      if (p != myid)
+        {
+          ghosts.add_index(p * local_size + 2);
+          ghosts.add_range(p * local_size + 5, p * local_size + 5 + p + 1);
+        }
+
+  const auto reference =
+    std::make_shared<Utilities::MPI::Partitioner>(local_owned,
+                                                  ghosts,
+                                                  MPI_COMM_WORLD);
+  const auto partitioner =
+    std::make_shared<Utilities::MPI::Partitioner>(local_owned,
+                                                  ghosts,
+                                                  MPI_COMM_WORLD);
+  partitioner->setup_neighborhood_communication();
+  AssertThrow(partitioner->uses_neighborhood_collectives(),
+              ExcInternalError());
+
+  // export and import on the level of the partitioner
+  {
+    std::vector<double> locally_owned(local_size), locally_owned_ref;
+    for (unsigned int i = 0; i < local_size; ++i)
+      locally_owned[i] = myid * local_size + i;
+    std::vector<double> ghost_array(partitioner->n_ghost_indices());
+    std::vector<double> ghost_array_ref(ghost_array.size());
+    std::vector<double> temp(partitioner->n_import_indices());
+    std::vector<MPI_Request> requests;
+
+    partitioner->export_to_ghosted_array_start(
+      0,
+      make_array_view(std::as_const(locally_owned)),
+      make_array_view(temp),
+      make_array_view(ghost_array),
+      requests);
+    AssertDimension(requests.size(), 1);
+    partitioner->export_to_ghosted_array_finish(make_array_view(ghost_array),
+                                                requests);
+
+    reference->export_to_ghosted_array_start(
+      0,
+      make_array_view(std::as_const(locally_owned)),
+      make_array_view(temp),
+      make_array_view(ghost_array_ref),
+      requests);
+    reference->export_to_ghosted_array_finish(make_array_view(ghost_array_ref),
+                                              requests);
+    AssertThrow(ghost_array == ghost_array_ref, ExcInternalError());
+
+    for (unsigned int i = 0; i < ghost_array.size(); ++i)
+      ghost_array_ref[i] = ghost_array[i] = i + 1;
+    locally_owned_ref = locally_owned;
+
+    partitioner->import_from_ghosted_array_start(VectorOperation::add,
+                                                 0,
+                                                 make_array_view(ghost_array),
+                                                 make_array_view(temp),
+                                                 requests);
+    partitioner->import_from_ghosted_array_finish(
+      VectorOperation::add,
+      make_array_view(std::as_const(temp)),
+      make_array_view(locally_owned),
+      make_array_view(ghost_array),
+      requests);
+
+    reference->import_from_ghosted_array_start(VectorOperation::add,
+                                               0,
+                                               make_array_view(ghost_array_ref),
+                                               make_array_view(temp),
+                                               requests);
+    reference->import_from_ghosted_array_finish(
+      VectorOperation::add,
+      make_array_view(std::as_const(temp)),
+      make_array_view(locally_owned_ref),
+      make_array_view(ghost_array_ref),
+      requests);
+    AssertThrow(locally_owned == locally_owned_ref, ExcInternalError());
+
+    deallog << "Partitioner OK" << std::endl;
+  }
+
+  // the same exchange through a vector, repeated to check that no messages
+  // get mixed up
+  {
+    LinearAlgebra::distributed::Vector<double> v(partitioner), v_ref(reference);
+    for (unsigned int cycle = 0; cycle < 3; ++cycle)
+      {
+        for (const auto i : local_owned)
+          v(i) = v_ref(i) = i + cycle;
+        v.update_ghost_values();
+        v_ref.update_ghost_values();
+        for (const auto i : ghosts)
+          AssertThrow(v(i) == v_ref(i), ExcInternalError());
+
+        v.zero_out_ghost_values();
+        v_ref.zero_out_ghost_values();
+        for (const auto i : ghosts)
+          v(i) = v_ref(i) = 1. + cycle;
+        v.compress(VectorOperation::add);
+        v_ref.compress(VectorOperation::add);
+        for (const auto i : local_owned)
+          AssertThrow(v(i) == v_ref(i), ExcInternalError());
+      }
+    deallog << "Vector OK" << std::endl;
+  }
+
+  // a reordered communicator contains the same number of processes
+  MPI_Comm comm = reference->create_reordered_communicator();
+  deallog << "Size of reordered communicator: "
+          << Utilities::MPI::n_mpi_processes(comm) << std::endl;
+  Utilities::MPI::free_communicator(comm);
+}
+
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+  MPILogInitAll                    log;
+  test();
+}
@@ -0,0 +1,115 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// check update_ghost_values() of a parallel vector that sends the ghost
+// values in single precision, see set_ghost_exchange_precision()
+
+#include <deal.II/base/index_set.h>
+#include <deal.II/base/utilities.h>
+
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <iostream>
+#include <vector>
+
+#include "../tests.h"
+
+
+void
+test()
+{
+  const unsigned int myid    = Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+  const unsigned int numproc = Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD);
+
+  if (myid == 0)
+    deallog << "numproc=" << numproc << std::endl;
+
+  // each processor owns 10 indices and ghosts two entries of every other
+  // processor
+  IndexSet local_owned(numproc * 10);
+  local_owned.add_range(myid * 10, myid * 10 + 10);
+  IndexSet local_relevant(numproc * 10);
+  for (unsigned int p = 0; p < numproc; ++p)
+    if (p != myid)
+      {
+        local_relevant.add_index(p * 10 + 1);
+        local_relevant.add_index(p * 10 + 7);
+      }
+
+  LinearAlgebra::distributed::Vector<double> v(local_owned,
+                                               local_relevant,
+                                               MPI_COMM_WORLD);
+  v.set_ghost_exchange_precision(true);
+
+  // values that are not representable in single precision
+  for (const auto i : local_owned)
+    v(i) = i + 1. / 3.;
+
+  v.update_ghost_values();
+
+  for (const auto i : local_owned)
+    AssertThrow(v(i) == i + 1. / 3., ExcInternalError());
+  for (const auto i : local_relevant)
+    AssertThrow(v(i) == static_cast<double>(static_cast<float>(i + 1. / 3.)),
+                ExcInternalError());
+
+  if (myid == 0)
+    deallog << "Bytes saved: " << v.n_bytes_saved_in_ghost_exchange()
+            << std::endl;
+
+  // a vector initialized from v uses the same setting
+  LinearAlgebra::distributed::Vector<double> w;
+  w.reinit(v);
+  w = v;
+  w.update_ghost_values();
+  for (const auto i : local_relevant)
+    AssertThrow(w(i) == v(i), ExcInternalError());
+
+  // send the ghost values in full precision again
+  v.zero_out_ghost_values();
+  v.set_ghost_exchange_precision(false);
+  v.update_ghost_values();
+  for (const auto i : local_relevant)
+    AssertThrow(v(i) == i + 1. / 3., ExcInternalError());
+
+  if (myid == 0)
+    deallog << "Bytes saved: " << v.n_bytes_saved_in_ghost_exchange() << ' '
+            << w.n_bytes_saved_in_ghost_exchange() << std::endl;
+
+  if (myid == 0)
+    deallog << "OK" << std::endl;
+}
+
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(
+    argc, argv, testing_max_num_threads());
+
+  unsigned int myid = Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+  deallog.push(Utilities::int_to_string(myid));
+
+  if (myid == 0)
+    {
+      initlog();
+      deallog << std::setprecision(4);
+
+      test();
+    }
+  else
+    test();
+}
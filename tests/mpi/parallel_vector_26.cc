@@ -0,0 +1,113 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// check the non-blocking reductions inner_product_async(), l2_norm_async(),
+// mean_value_async() and add_and_dot_async() of a parallel vector against
+// their blocking counterparts
+
+#include <deal.II/base/index_set.h>
+#include <deal.II/base/utilities.h>
+
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <iostream>
+#include <vector>
+
+#include "../tests.h"
+
+
+void
+test()
+{
+  const unsigned int myid    = Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+  const unsigned int numproc = Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD);
+
+  if (myid == 0)
+    deallog << "numproc=" << numproc << std::endl;
+
+  IndexSet local_owned(numproc * 10);
+  local_owned.add_range(myid * 10, myid * 10 + 10);
+
+  LinearAlgebra::distributed::Vector<double> v(local_owned, MPI_COMM_WORLD);
+  LinearAlgebra::distributed::Vector<double> w(local_owned, MPI_COMM_WORLD);
+  for (const auto i : local_owned)
+    {
+      v(i) = i;
+      w(i) = 1.;
+    }
+
+  // start several reductions at once and only then wait for them
+  auto dot  = v.inner_product_async(w);
+  auto norm = v.l2_norm_async();
+  auto mean = v.mean_value_async();
+
+  // the local work is done, so the vector may be changed in between
+  w *= 2.;
+  w /= 2.;
+
+  const double dot_value  = dot.get();
+  const double norm_value = norm.get();
+  const double mean_value = mean.get();
+  AssertThrow(dot_value == v * w, ExcInternalError());
+  AssertThrow(norm_value == v.l2_norm(), ExcInternalError());
+  AssertThrow(mean_value == v.mean_value(), ExcInternalError());
+
+  if (myid == 0)
+    deallog << "Dot: " << dot_value << " norm: " << norm_value
+            << " mean: " << mean_value << std::endl;
+
+  LinearAlgebra::distributed::Vector<double> u(v);
+  auto         add_dot       = v.add_and_dot_async(2., w, w);
+  const double reference     = u.add_and_dot(2., w, w);
+  const double add_dot_value = add_dot.get();
+  AssertThrow(add_dot_value == reference, ExcInternalError());
+  for (const auto i : local_owned)
+    AssertThrow(v(i) == u(i), ExcInternalError());
+
+  if (myid == 0)
+    deallog << "Add and dot: " << add_dot_value << std::endl;
+
+  // a reduction whose result is never requested is completed when the
+  // Future object goes out of scope
+  {
+    auto unused = v.l2_norm_async();
+    (void)unused;
+  }
+
+  if (myid == 0)
+    deallog << "OK" << std::endl;
+}
+
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(
+    argc, argv, testing_max_num_threads());
+
+  unsigned int myid = Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+  deallog.push(Utilities::int_to_string(myid));
+
+  if (myid == 0)
+    {
+      initlog();
+      deallog << std::setprecision(4);
+
+      test();
+    }
+  else
+    test();
+}
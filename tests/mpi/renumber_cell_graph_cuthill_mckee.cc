@@ -0,0 +1,123 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Test that DoFRenumbering::cell_graph_Cuthill_McKee() works in parallel for
+// active and level degrees of freedom: each processor renumbers its locally
+// owned DoFs within the set of indices it owned before.
+
+#include <deal.II/base/mpi.h>
+
+#include <deal.II/distributed/tria.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_renumbering.h>
+
+#include <deal.II/fe/fe_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+
+#include "../tests.h"
+
+
+
+void
+check_permutation(std::vector<types::global_dof_index> renumbering,
+                  const IndexSet                      &owned_dofs)
+{
+  AssertThrow(renumbering.size() == owned_dofs.n_elements(),
+              ExcInternalError());
+  std::sort(renumbering.begin(), renumbering.end());
+  for (unsigned int i = 0; i < renumbering.size(); ++i)
+    AssertThrow(renumbering[i] == owned_dofs.nth_index_in_set(i),
+                ExcInternalError());
+}
+
+
+
+template <int dim>
+void
+test()
+{
+  parallel::distributed::Triangulation<dim> tr(
+    MPI_COMM_WORLD,
+    Triangulation<dim>::limit_level_difference_at_vertices,
+    parallel::distributed::Triangulation<dim>::construct_multigrid_hierarchy);
+
+  GridGenerator::hyper_cube(tr, -1.0, 1.0);
+  tr.refine_global(6 - dim);
+  for (const auto &cell : tr.active_cell_iterators())
+    if (cell->is_locally_owned() && cell->center().norm() < 0.3)
+      cell->set_refine_flag();
+  tr.execute_coarsening_and_refinement();
+
+  DoFHandler<dim> dofh(tr);
+
+  const FE_Q<dim> fe(2);
+  dofh.distribute_dofs(fe);
+  dofh.distribute_mg_dofs();
+
+  for (unsigned int level = 0; level < tr.n_global_levels(); ++level)
+    {
+      const IndexSet owned_dofs = dofh.locally_owned_mg_dofs(level);
+
+      std::vector<types::global_dof_index> renumbering(
+        owned_dofs.n_elements());
+      DoFRenumbering::compute_cell_graph_Cuthill_McKee(renumbering,
+                                                       dofh,
+                                                       true,
+                                                       level);
+      check_permutation(renumbering, owned_dofs);
+
+      DoFRenumbering::cell_graph_Cuthill_McKee(dofh, level);
+      AssertThrow(dofh.locally_owned_mg_dofs(level) == owned_dofs,
+                  ExcInternalError());
+    }
+
+  const IndexSet owned_dofs = dofh.locally_owned_dofs();
+
+  std::vector<types::global_dof_index> renumbering(owned_dofs.n_elements());
+  DoFRenumbering::compute_cell_graph_Cuthill_McKee(renumbering, dofh);
+  check_permutation(renumbering, owned_dofs);
+
+  DoFRenumbering::cell_graph_Cuthill_McKee(dofh);
+  AssertThrow(dofh.locally_owned_dofs() == owned_dofs, ExcInternalError());
+
+  // the DoF indices on ghost cells must have been updated consistently
+  std::vector<types::global_dof_index> dof_indices(fe.n_dofs_per_cell());
+  for (const auto &cell : dofh.active_cell_iterators())
+    if (cell->is_locally_owned() || cell->is_ghost())
+      {
+        cell->get_dof_indices(dof_indices);
+        for (const auto index : dof_indices)
+          AssertThrow(index < dofh.n_dofs(), ExcInternalError());
+      }
+
+  deallog << "OK" << std::endl;
+}
+
+
+
+int
+main(int argc, char *argv[])
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  MPILogInitAll                    all;
+
+  deallog.push("2d");
+  test<2>();
+  deallog.pop();
+  deallog.push("3d");
+  test<3>();
+  deallog.pop();
+}
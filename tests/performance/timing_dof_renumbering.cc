@@ -0,0 +1,162 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+//
+// Description:
+//
+// A performance benchmark that compares DoFRenumbering::Cuthill_McKee()
+// with DoFRenumbering::cell_graph_Cuthill_McKee() on a 3d mesh with
+// quadratic elements. Starting from a random numbering, it measures the
+// time to compute each renumbering, as well as the time of sparse
+// matrix-vector products and of the setup and application of an ILU
+// preconditioner with the resulting numbering, which depend on the data
+// locality the numbering achieves.
+//
+// Status: experimental
+//
+
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/base/timer.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_renumbering.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/sparse_ilu.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/sparsity_pattern.h>
+#include <deal.II/lac/vector.h>
+
+#include <deal.II/numerics/matrix_creator.h>
+
+#include "performance_test_driver.h"
+
+using namespace dealii;
+
+dealii::ConditionalOStream debug_output(std::cout, false);
+
+
+
+// Renumber the DoFs with the given function, starting from a random
+// numbering, then assemble a Laplace matrix and measure matrix-vector
+// products and an ILU preconditioner with it. The times are added to the
+// respective entry of @p timer.
+template <int dim, typename RenumberingFunction>
+void
+run(const Triangulation<dim>     &triangulation,
+    const RenumberingFunction    &renumber,
+    std::map<std::string, Timer> &timer)
+{
+  const FE_Q<dim> fe(2);
+  DoFHandler<dim> dof_handler(triangulation);
+  dof_handler.distribute_dofs(fe);
+  DoFRenumbering::random(dof_handler);
+
+  timer["renumber"].start();
+  renumber(dof_handler);
+  timer["renumber"].stop();
+
+  DynamicSparsityPattern dsp(dof_handler.n_dofs());
+  DoFTools::make_sparsity_pattern(dof_handler, dsp);
+  SparsityPattern sparsity_pattern;
+  sparsity_pattern.copy_from(dsp);
+  debug_output << "DoFs: " << dof_handler.n_dofs()
+               << ", bandwidth: " << sparsity_pattern.bandwidth() << std::endl;
+
+  SparseMatrix<double> matrix(sparsity_pattern);
+  MatrixCreator::create_laplace_matrix(dof_handler, QGauss<dim>(3), matrix);
+  for (unsigned int i = 0; i < matrix.m(); ++i)
+    matrix.diag_element(i) += 1.;
+
+  Vector<double> src(dof_handler.n_dofs()), dst(dof_handler.n_dofs());
+  src = 1.;
+
+  timer["spmv"].start();
+  for (unsigned int i = 0; i < 50; ++i)
+    matrix.vmult(dst, src);
+  timer["spmv"].stop();
+
+  SparseILU<double> ilu;
+  timer["ilu"].start();
+  ilu.initialize(matrix);
+  for (unsigned int i = 0; i < 10; ++i)
+    ilu.vmult(dst, src);
+  timer["ilu"].stop();
+}
+
+
+
+std::tuple<Metric, unsigned int, std::vector<std::string>>
+describe_measurements()
+{
+  return {Metric::timing,
+          4,
+          {"cuthill_mckee_renumber",
+           "cuthill_mckee_spmv",
+           "cuthill_mckee_ilu",
+           "cell_graph_renumber",
+           "cell_graph_spmv",
+           "cell_graph_ilu"}};
+}
+
+
+
+Measurement
+perform_single_measurement()
+{
+  unsigned int n_refinements = 2;
+  switch (get_testing_environment())
+    {
+      case TestingEnvironment::light:
+        break;
+      case TestingEnvironment::medium:
+        n_refinements = 3;
+        break;
+      case TestingEnvironment::heavy:
+        n_refinements = 4;
+        break;
+    }
+
+  Triangulation<3> triangulation;
+  GridGenerator::hyper_ball(triangulation);
+  triangulation.refine_global(n_refinements);
+
+  std::map<std::string, Timer> cuthill_mckee_timer;
+  run<3>(
+    triangulation,
+    [](DoFHandler<3> &dof_handler) {
+      DoFRenumbering::Cuthill_McKee(dof_handler, true);
+    },
+    cuthill_mckee_timer);
+
+  std::map<std::string, Timer> cell_graph_timer;
+  run<3>(
+    triangulation,
+    [](DoFHandler<3> &dof_handler) {
+      DoFRenumbering::cell_graph_Cuthill_McKee(dof_handler);
+    },
+    cell_graph_timer);
+
+  return {cuthill_mckee_timer["renumber"].wall_time(),
+          cuthill_mckee_timer["spmv"].wall_time(),
+          cuthill_mckee_timer["ilu"].wall_time(),
+          cell_graph_timer["renumber"].wall_time(),
+          cell_graph_timer["spmv"].wall_time(),
+          cell_graph_timer["ilu"].wall_time()};
+}
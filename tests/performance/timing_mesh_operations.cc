@@ -0,0 +1,266 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+//
+// Description:
+//
+// A performance benchmark that isolates the mesh operations in the setup
+// phase of an adaptive computation: local refinement and coarsening of the
+// triangulation, distribution of degrees of freedom, the construction of
+// the search structures of GridTools::Cache, and the interpolation of a
+// solution with SolutionTransfer. The operations are measured for a 3d
+// hexahedral mesh, a 2d triangle mesh, a 3d tetrahedral mesh, and a 3d
+// hexahedral mesh that is refined anisotropically.
+//
+// After refinement, the meshes have about 6e4 (light), 5e5 (medium) and
+// 4e6 (heavy) active cells in the hexahedral and triangle cases, about
+// 4e4, 3e5 and 2e6 active cells in the tetrahedral case, and about 4e4,
+// 4e5 and 3e6 active cells in the anisotropic case.
+//
+// Status: experimental
+//
+
+#include <deal.II/base/function.h>
+#include <deal.II/base/timer.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_simplex_p.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools_cache.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/vector.h>
+
+#include <deal.II/numerics/solution_transfer.h>
+#include <deal.II/numerics/vector_tools.h>
+
+#include "performance_test_driver.h"
+
+using namespace dealii;
+
+dealii::ConditionalOStream debug_output(std::cout, false);
+
+
+
+template <int dim>
+class TestFunction : public Function<dim>
+{
+public:
+  virtual double
+  value(const Point<dim> &p, const unsigned int = 0) const override
+  {
+    double result = 1.;
+    for (unsigned int d = 0; d < dim; ++d)
+      result *= std::sin(numbers::PI * p[d]);
+    return result;
+  }
+};
+
+
+
+// Refine the cells in a ball in the center of the unit cube with the given
+// refinement case, then coarsen them again. The time for each of the mesh
+// operations is added to the respective entry of @p timer.
+template <int dim>
+void
+run(Triangulation<dim>           &triangulation,
+    const FiniteElement<dim>     &fe,
+    const RefinementCase<dim>    &refinement_case,
+    const bool                    coarsen,
+    std::map<std::string, Timer> &timer)
+{
+  DoFHandler<dim> dof_handler(triangulation);
+  dof_handler.distribute_dofs(fe);
+
+  Vector<double> solution(dof_handler.n_dofs());
+  VectorTools::interpolate(dof_handler, TestFunction<dim>(), solution);
+
+  const unsigned int coarse_level = triangulation.n_levels() - 1;
+  Point<dim>         center;
+  for (unsigned int d = 0; d < dim; ++d)
+    center[d] = 0.5;
+  for (const auto &cell : triangulation.active_cell_iterators())
+    if (cell->center().distance(center) < 0.3)
+      cell->set_refine_flag(refinement_case);
+
+  SolutionTransfer<dim> solution_transfer(dof_handler);
+  timer["solution_transfer"].start();
+  solution_transfer.prepare_for_coarsening_and_refinement(solution);
+  timer["solution_transfer"].stop();
+
+  timer["refine"].start();
+  triangulation.execute_coarsening_and_refinement();
+  timer["refine"].stop();
+
+  debug_output << "Number of active cells: " << triangulation.n_active_cells()
+               << std::endl;
+
+  timer["distribute_dofs"].start();
+  dof_handler.distribute_dofs(fe);
+  timer["distribute_dofs"].stop();
+
+  debug_output << "Number of degrees of freedom: " << dof_handler.n_dofs()
+               << std::endl;
+
+  timer["solution_transfer"].start();
+  solution.reinit(dof_handler.n_dofs());
+  solution_transfer.interpolate(solution);
+  timer["solution_transfer"].stop();
+
+  {
+    timer["cache"].start();
+    const GridTools::Cache<dim> cache(triangulation);
+    cache.get_vertex_to_cell_map();
+    cache.get_used_vertices_rtree();
+    cache.get_cell_bounding_boxes_rtree();
+    timer["cache"].stop();
+  }
+
+  if (coarsen)
+    {
+      for (const auto &cell : triangulation.active_cell_iterators())
+        if (static_cast<unsigned int>(cell->level()) > coarse_level)
+          cell->set_coarsen_flag();
+
+      timer["coarsen"].start();
+      triangulation.execute_coarsening_and_refinement();
+      timer["coarsen"].stop();
+
+      debug_output << "Number of active cells after coarsening: "
+                   << triangulation.n_active_cells() << std::endl;
+    }
+}
+
+
+
+std::tuple<Metric, unsigned int, std::vector<std::string>>
+describe_measurements()
+{
+  return {Metric::timing,
+          4,
+          {"hex_refine",
+           "hex_coarsen",
+           "hex_distribute_dofs",
+           "hex_cache",
+           "hex_solution_transfer",
+           "triangle_refine",
+           "triangle_distribute_dofs",
+           "triangle_cache",
+           "triangle_solution_transfer",
+           "tetrahedron_refine",
+           "tetrahedron_distribute_dofs",
+           "tetrahedron_cache",
+           "tetrahedron_solution_transfer",
+           "anisotropic_refine",
+           "anisotropic_coarsen",
+           "anisotropic_distribute_dofs",
+           "anisotropic_cache",
+           "anisotropic_solution_transfer"}};
+}
+
+
+
+Measurement
+perform_single_measurement()
+{
+  unsigned int n_hex_refinements         = 5;
+  unsigned int n_triangle_refinements    = 2;
+  unsigned int n_tetrahedron_refinements = 1;
+  switch (get_testing_environment())
+    {
+      case TestingEnvironment::light:
+        break;
+      case TestingEnvironment::medium:
+        n_hex_refinements         = 6;
+        n_triangle_refinements    = 4;
+        n_tetrahedron_refinements = 2;
+        break;
+      case TestingEnvironment::heavy:
+        n_hex_refinements         = 7;
+        n_triangle_refinements    = 5;
+        n_tetrahedron_refinements = 3;
+        break;
+    }
+
+  std::map<std::string, Timer> hex_timer;
+  {
+    Triangulation<3> triangulation;
+    GridGenerator::hyper_cube(triangulation);
+    triangulation.refine_global(n_hex_refinements);
+    run<3>(triangulation,
+           FE_Q<3>(2),
+           RefinementCase<3>::isotropic_refinement,
+           true,
+           hex_timer);
+  }
+
+  // Coarsening of simplex meshes is not supported, so only measure
+  // refinement here.
+  std::map<std::string, Timer> triangle_timer;
+  {
+    Triangulation<2> triangulation;
+    GridGenerator::subdivided_hyper_cube_with_simplices(triangulation, 32);
+    triangulation.refine_global(n_triangle_refinements);
+    run<2>(triangulation,
+           FE_SimplexP<2>(2),
+           RefinementCase<2>::isotropic_refinement,
+           false,
+           triangle_timer);
+  }
+
+  std::map<std::string, Timer> tetrahedron_timer;
+  {
+    Triangulation<3> triangulation;
+    GridGenerator::subdivided_hyper_cube_with_simplices(triangulation, 8);
+    triangulation.refine_global(n_tetrahedron_refinements);
+    run<3>(triangulation,
+           FE_SimplexP<3>(2),
+           RefinementCase<3>::isotropic_refinement,
+           false,
+           tetrahedron_timer);
+  }
+
+  std::map<std::string, Timer> anisotropic_timer;
+  {
+    Triangulation<3> triangulation;
+    GridGenerator::hyper_cube(triangulation);
+    triangulation.refine_global(n_hex_refinements);
+    run<3>(triangulation,
+           FE_Q<3>(2),
+           RefinementCase<3>::cut_xy,
+           true,
+           anisotropic_timer);
+  }
+
+  return {hex_timer["refine"].wall_time(),
+          hex_timer["coarsen"].wall_time(),
+          hex_timer["distribute_dofs"].wall_time(),
+          hex_timer["cache"].wall_time(),
+          hex_timer["solution_transfer"].wall_time(),
+          triangle_timer["refine"].wall_time(),
+          triangle_timer["distribute_dofs"].wall_time(),
+          triangle_timer["cache"].wall_time(),
+          triangle_timer["solution_transfer"].wall_time(),
+          tetrahedron_timer["refine"].wall_time(),
+          tetrahedron_timer["distribute_dofs"].wall_time(),
+          tetrahedron_timer["cache"].wall_time(),
+          tetrahedron_timer["solution_transfer"].wall_time(),
+          anisotropic_timer["refine"].wall_time(),
+          anisotropic_timer["coarsen"].wall_time(),
+          anisotropic_timer["distribute_dofs"].wall_time(),
+          anisotropic_timer["cache"].wall_time(),
+          anisotropic_timer["solution_transfer"].wall_time()};
+}
@@ -0,0 +1,188 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+//
+// Description:
+//
+// A performance benchmark that isolates the mesh operations of an adaptive
+// computation on a parallel::distributed::Triangulation: local refinement
+// (including the repartitioning done by p4est), distribution of degrees of
+// freedom, the interpolation of a solution with SolutionTransfer, an
+// explicit repartitioning with cell weights, and coarsening.
+//
+// After refinement, the mesh has about 6e4 (light), 5e5 (medium) and 4e6
+// (heavy) active cells.
+//
+// Status: experimental
+//
+
+#include <deal.II/base/function.h>
+#include <deal.II/base/timer.h>
+
+#include <deal.II/distributed/tria.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <deal.II/numerics/solution_transfer.h>
+#include <deal.II/numerics/vector_tools.h>
+
+#define ENABLE_MPI
+
+#include "performance_test_driver.h"
+
+using namespace dealii;
+
+dealii::ConditionalOStream debug_output(std::cout, false);
+
+
+
+template <int dim>
+class TestFunction : public Function<dim>
+{
+public:
+  virtual double
+  value(const Point<dim> &p, const unsigned int = 0) const override
+  {
+    double result = 1.;
+    for (unsigned int d = 0; d < dim; ++d)
+      result *= std::sin(numbers::PI * p[d]);
+    return result;
+  }
+};
+
+
+
+std::tuple<Metric, unsigned int, std::vector<std::string>>
+describe_measurements()
+{
+  return {Metric::timing,
+          4,
+          {"refine",
+           "distribute_dofs",
+           "solution_transfer",
+           "repartition",
+           "coarsen"}};
+}
+
+
+
+Measurement
+perform_single_measurement()
+{
+  constexpr unsigned int dim = 3;
+  using VectorType           = LinearAlgebra::distributed::Vector<double>;
+
+  std::map<std::string, Timer> timer;
+
+  parallel::distributed::Triangulation<dim> triangulation(MPI_COMM_WORLD);
+  GridGenerator::hyper_cube(triangulation);
+  switch (get_testing_environment())
+    {
+      case TestingEnvironment::light:
+        triangulation.refine_global(5);
+        break;
+      case TestingEnvironment::medium:
+        triangulation.refine_global(6);
+        break;
+      case TestingEnvironment::heavy:
+        triangulation.refine_global(7);
+        break;
+    }
+  const unsigned int coarse_level = triangulation.n_levels() - 1;
+
+  const FE_Q<dim> fe(2);
+  DoFHandler<dim> dof_handler(triangulation);
+  dof_handler.distribute_dofs(fe);
+
+  VectorType solution(dof_handler.locally_owned_dofs(),
+                      DoFTools::extract_locally_relevant_dofs(dof_handler),
+                      MPI_COMM_WORLD);
+  VectorTools::interpolate(dof_handler, TestFunction<dim>(), solution);
+  solution.update_ghost_values();
+
+  // Refine the cells in a ball in the center of the domain.
+  Point<dim> center;
+  for (unsigned int d = 0; d < dim; ++d)
+    center[d] = 0.5;
+  for (const auto &cell : triangulation.active_cell_iterators())
+    if (cell->is_locally_owned() && cell->center().distance(center) < 0.3)
+      cell->set_refine_flag();
+
+  {
+    SolutionTransfer<dim, VectorType> solution_transfer(dof_handler);
+    timer["solution_transfer"].start();
+    solution_transfer.prepare_for_coarsening_and_refinement(solution);
+    timer["solution_transfer"].stop();
+
+    timer["refine"].start();
+    triangulation.execute_coarsening_and_refinement();
+    timer["refine"].stop();
+
+    debug_output << "Number of active cells: "
+                 << triangulation.n_global_active_cells() << std::endl;
+
+    timer["distribute_dofs"].start();
+    dof_handler.distribute_dofs(fe);
+    timer["distribute_dofs"].stop();
+
+    debug_output << "Number of degrees of freedom: " << dof_handler.n_dofs()
+                 << std::endl;
+
+    timer["solution_transfer"].start();
+    solution.reinit(dof_handler.locally_owned_dofs(),
+                    DoFTools::extract_locally_relevant_dofs(dof_handler),
+                    MPI_COMM_WORLD);
+    solution_transfer.interpolate(solution);
+    timer["solution_transfer"].stop();
+  }
+
+  // Make the refined cells more expensive and move them around between
+  // processes.
+  triangulation.signals.weight.connect(
+    [coarse_level](
+      const typename parallel::distributed::Triangulation<dim>::cell_iterator
+        &cell,
+      const CellStatus) -> unsigned int {
+      return (static_cast<unsigned int>(cell->level()) > coarse_level) ? 4 : 1;
+    });
+
+  timer["repartition"].start();
+  triangulation.repartition();
+  timer["repartition"].stop();
+
+  triangulation.signals.weight.disconnect_all_slots();
+
+  // Finally, coarsen the refined cells again.
+  for (const auto &cell : triangulation.active_cell_iterators())
+    if (cell->is_locally_owned() &&
+        static_cast<unsigned int>(cell->level()) > coarse_level)
+      cell->set_coarsen_flag();
+
+  timer["coarsen"].start();
+  triangulation.execute_coarsening_and_refinement();
+  timer["coarsen"].stop();
+
+  return {timer["refine"].wall_time(),
+          timer["distribute_dofs"].wall_time(),
+          timer["solution_transfer"].wall_time(),
+          timer["repartition"].wall_time(),
+          timer["coarsen"].wall_time()};
+}
@@ -0,0 +1,98 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+//
+// Description:
+//
+// A performance benchmark for the global refinement of a 3d ball whose
+// interior is described by a TransfiniteInterpolationManifold, where most of
+// the time is spent in pulling back points to the chart space of the coarse
+// cells. The refinement is measured once with the default cache of chart
+// points of the manifold and once with the cache disabled.
+//
+// After refinement, the meshes have about 3e4 (light), 2e5 (medium) and 2e6
+// (heavy) active cells.
+//
+// Status: experimental
+//
+
+#include <deal.II/base/timer.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/manifold_lib.h>
+#include <deal.II/grid/tria.h>
+
+#include "performance_test_driver.h"
+
+using namespace dealii;
+
+dealii::ConditionalOStream debug_output(std::cout, false);
+
+
+
+// Refine a ball with a transfinite interpolation manifold in the interior
+// @p n_refinements times and return the time spent in the refinement.
+// The manifold caches at most @p max_cached_chart_points chart points.
+template <int dim>
+double
+run(const unsigned int n_refinements,
+    const unsigned int max_cached_chart_points)
+{
+  Triangulation<dim> triangulation;
+  GridGenerator::hyper_ball(triangulation);
+  triangulation.set_all_manifold_ids(1);
+  triangulation.set_all_manifold_ids_on_boundary(0);
+  triangulation.set_manifold(0, SphericalManifold<dim>());
+
+  TransfiniteInterpolationManifold<dim> transfinite(max_cached_chart_points);
+  transfinite.initialize(triangulation);
+  triangulation.set_manifold(1, transfinite);
+
+  Timer timer;
+  triangulation.refine_global(n_refinements);
+  timer.stop();
+
+  debug_output << "Number of active cells: " << triangulation.n_active_cells()
+               << std::endl;
+
+  return timer.wall_time();
+}
+
+
+
+std::tuple<Metric, unsigned int, std::vector<std::string>>
+describe_measurements()
+{
+  return {Metric::timing, 4, {"refine_cached", "refine_uncached"}};
+}
+
+
+
+Measurement
+perform_single_measurement()
+{
+  unsigned int n_refinements = 4;
+  switch (get_testing_environment())
+    {
+      case TestingEnvironment::light:
+        break;
+      case TestingEnvironment::medium:
+        n_refinements = 5;
+        break;
+      case TestingEnvironment::heavy:
+        n_refinements = 6;
+        break;
+    }
+
+  return {run<3>(n_refinements, 1U << 16), run<3>(n_refinements, 0)};
+}
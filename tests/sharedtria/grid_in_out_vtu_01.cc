@@ -0,0 +1,85 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Write a parallel::shared::Triangulation to a VTU file with the serialized
+// triangulation attached, and read it back into a serial triangulation
+
+#include <deal.II/distributed/shared_tria.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_in.h>
+#include <deal.II/grid/grid_out.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/grid/tria_accessor.h>
+#include <deal.II/grid/tria_iterator.h>
+
+#include <string>
+
+#include "../tests.h"
+
+
+
+template <int dim>
+void
+test()
+{
+  const unsigned int rank = Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+
+  parallel::shared::Triangulation<dim> tria(MPI_COMM_WORLD);
+  GridGenerator::hyper_ball(tria);
+  tria.begin_active()->set_refine_flag();
+  tria.execute_coarsening_and_refinement();
+
+  const std::string filename =
+    "grid_" + std::to_string(dim) + "_" + std::to_string(rank) + ".vtu";
+  {
+    std::ofstream out(filename);
+    GridOut       go;
+    go.set_flags(GridOutFlags::Vtu(true));
+    go.write_vtu(tria, out);
+  }
+
+  Triangulation<dim> tria2;
+  {
+    std::ifstream in(filename);
+    GridIn<dim>   gi;
+    gi.attach_triangulation(tria2);
+    gi.read_vtu(in);
+  }
+  std::remove(filename.c_str());
+
+  AssertThrow(tria2.n_active_cells() == tria.n_active_cells(),
+              ExcInternalError());
+  AssertThrow(tria2.n_levels() == tria.n_levels(), ExcInternalError());
+  for (auto cell = tria.begin_active(), cell2 = tria2.begin_active();
+       cell != tria.end();
+       ++cell, ++cell2)
+    AssertThrow(cell->center().distance(cell2->center()) < 1e-12,
+                ExcInternalError());
+
+  deallog << "OK for " << dim << 'd' << std::endl;
+}
+
+
+
+int
+main(int argc, char *argv[])
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+
+  MPILogInitAll all;
+
+  test<2>();
+  test<3>();
+}
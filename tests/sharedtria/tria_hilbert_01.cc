@@ -0,0 +1,73 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2025 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Create a parallel::shared::Triangulation that is partitioned with the
+// partition_hilbert scheme and compare against a serial triangulation
+// partitioned by GridTools::partition_triangulation_hilbert().
+
+#include <deal.II/distributed/shared_tria.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/tria.h>
+
+#include "../tests.h"
+
+
+
+template <int dim>
+void
+test()
+{
+  parallel::shared::Triangulation<dim> shared_tria(
+    MPI_COMM_WORLD,
+    Triangulation<dim>::none,
+    false,
+    parallel::shared::Triangulation<dim>::partition_hilbert);
+  GridGenerator::hyper_cube(shared_tria);
+  shared_tria.refine_global(dim == 2 ? 3 : 2);
+
+  Triangulation<dim> tria;
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(dim == 2 ? 3 : 2);
+  GridTools::partition_triangulation_hilbert(
+    Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD), tria);
+
+  auto cell = tria.begin_active();
+  for (const auto &shared_cell : shared_tria.active_cell_iterators())
+    {
+      AssertThrow(shared_cell->subdomain_id() == cell->subdomain_id(),
+                  ExcInternalError());
+      ++cell;
+    }
+
+  deallog << "n_locally_owned_active_cells: "
+          << shared_tria.n_locally_owned_active_cells() << std::endl;
+}
+
+
+
+int
+main(int argc, char *argv[])
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  MPILogInitAll                    all;
+
+  deallog.push("2d");
+  test<2>();
+  deallog.pop();
+  deallog.push("3d");
+  test<3>();
+  deallog.pop();
+}